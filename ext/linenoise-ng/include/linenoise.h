@@ -60,6 +60,7 @@ int linenoiseHistorySetMaxLen(int len);
 const char* linenoiseHistoryLine(int index);
 int linenoiseHistorySize(void);
 int linenoiseHistorySave(const char* filename);
+int linenoiseHistoryAppend(const char* filename, int index);
 int linenoiseHistoryLoad(const char* filename);
 void linenoiseHistoryFree(void);
 void linenoiseClearScreen(void);
@@ -122,6 +122,7 @@
 
 #endif /* _WIN32 */
 
+#include <stdint.h>
 #include <stdio.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -872,6 +873,7 @@ class InputBuffer {
   int incrementalHistorySearch(PromptBase& pi, int startChar);
   int completeLine(PromptBase& pi);
   void refreshLine(PromptBase& pi);
+  void insertPastedText(PromptBase& pi, const string& text);
 
  public:
   InputBuffer(char32_t* buffer, char* widthArray, int bufferLen)
@@ -969,6 +971,7 @@ static const int END_KEY = 0x10C00000;
 static const int DELETE_KEY = 0x10E00000;
 static const int PAGE_UP_KEY = 0x11000000;
 static const int PAGE_DOWN_KEY = 0x11200000;
+static const int PASTE_START_KEY = 0x11400000;  // start of a bracketed paste
 
 static const char* unsupported_term[] = {"dumb", "cons25", "emacs", NULL};
 static linenoiseCompletionCallback* completionCallback = NULL;
@@ -988,7 +991,71 @@ static int atexit_registered = 0; /* register atexit just 1 time */
 static int historyMaxLen = LINENOISE_DEFAULT_HISTORY_MAX_LEN;
 static int historyLen = 0;
 static int historyIndex = 0;
-static char8_t** history = NULL;
+
+// History is kept in a ring buffer, so that dropping the oldest entry when it
+// is full does not move the remaining ones.
+struct HistoryEntry {
+  char8_t* line;
+  // trigrams of the line hashed into a bit set, used by the incremental search
+  // to skip lines which cannot contain the search text
+  uint64_t trigrams[2];
+};
+
+static HistoryEntry* history = NULL;
+static int historyStart = 0;  // slot of the oldest entry
+
+static HistoryEntry& historyEntry(int index) {
+  return history[(historyStart + index) % historyMaxLen];
+}
+
+static char8_t* historyLine(int index) { return historyEntry(index).line; }
+
+static void historyTrigrams(const char8_t* text, uint64_t* trigrams) {
+  trigrams[0] = trigrams[1] = 0;
+  if (text[0] == '\0' || text[1] == '\0') return;
+
+  for (const char8_t* p = text; p[2] != '\0'; ++p) {
+    const uint32_t bit =
+        ((uint32_t(p[0]) << 16 | uint32_t(p[1]) << 8 | p[2]) * 0x9E3779B1u) >>
+        25;
+    trigrams[bit >> 6] |= uint64_t(1) << (bit & 63);
+  }
+}
+
+// takes ownership of line
+static void historySetLine(int index, char8_t* line) {
+  HistoryEntry& entry = historyEntry(index);
+  free(entry.line);
+  entry.line = line;
+  if (line) historyTrigrams(line, entry.trigrams);
+}
+
+static void historyPopBack() {
+  --historyLen;
+  free(historyLine(historyLen));
+  historyEntry(historyLen).line = NULL;
+}
+
+/**
+ * Finds the next history line in the given direction which contains the UTF-8
+ * text, returns -1 if there's none.
+ */
+static int historyFind(int index, int direction, const char* text) {
+  uint64_t trigrams[2];
+  historyTrigrams(reinterpret_cast<const char8_t*>(text), trigrams);
+
+  for (index += direction; index >= 0 && index < historyLen;
+       index += direction) {
+    const HistoryEntry& entry = historyEntry(index);
+
+    if ((entry.trigrams[0] & trigrams[0]) == trigrams[0] &&
+        (entry.trigrams[1] & trigrams[1]) == trigrams[1] &&
+        strstr(reinterpret_cast<const char*>(entry.line), text) != NULL)
+      return index;
+  }
+
+  return -1;
+}
 
 // used to emulate Windows command prompt on down-arrow after a recall
 // we use -2 as our "not set" value because we add 1 to the previous index on
@@ -997,6 +1064,16 @@ static char8_t** history = NULL;
 static int historyPreviousIndex = -2;
 static bool historyRecallMostRecent = false;
 
+// Lines of a bracketed paste which precede the one being edited, they are
+// returned by linenoise() together with the edit buffer once Enter is pressed.
+static bool hasPastedInput = false;
+static string pastedInput;
+
+#ifndef _WIN32
+// input read ahead while looking for the end of a bracketed paste
+static string pendingInput;
+#endif
+
 static void linenoiseAtExit(void);
 
 static bool isUnsupportedTerm(void) {
@@ -1016,8 +1093,9 @@ static void beep() {
 
 void linenoiseHistoryFree(void) {
   if (history) {
-    for (int j = 0; j < historyLen; ++j) free(history[j]);
+    for (int j = 0; j < historyLen; ++j) free(historyLine(j));
     historyLen = 0;
+    historyStart = 0;
     free(history);
     history = 0;
   }
@@ -1066,6 +1144,10 @@ static int enableRawMode(void) {
   /* put terminal in raw mode after flushing */
   if (tcsetattr(0, TCSADRAIN, &raw) < 0) goto fatal;
   rawmode = 1;
+  /* enable bracketed paste, pasted text is wrapped in ESC [ 200 ~ and
+   * ESC [ 201 ~, terminals which don't support it ignore this */
+  if (write(1, "\x1b[?2004h", 8) == -1) {
+  }
   return 0;
 
 fatal:
@@ -1080,7 +1162,11 @@ static void disableRawMode(void) {
   console_in = 0;
   console_out = 0;
 #else
-  if (rawmode && tcsetattr(0, TCSADRAIN, &orig_termios) != -1) rawmode = 0;
+  if (rawmode) {
+    if (write(1, "\x1b[?2004l", 8) == -1) {
+    }
+    if (tcsetattr(0, TCSADRAIN, &orig_termios) != -1) rawmode = 0;
+  }
 #endif
 }
 
@@ -1418,11 +1504,17 @@ static char32_t readUnicodeCharacter(void) {
   while (true) {
     char8_t c;
 
-    /* Continue reading if interrupted by signal. */
     ssize_t nread;
-    do {
-      nread = read(0, &c, 1);
-    } while ((nread == -1) && (errno == EINTR));
+    if (!pendingInput.empty()) {
+      c = pendingInput[0];
+      pendingInput.erase(0, 1);
+      nread = 1;
+    } else {
+      /* Continue reading if interrupted by signal. */
+      do {
+        nread = read(0, &c, 1);
+      } while ((nread == -1) && (errno == EINTR));
+    }
 
     if (nread <= 0) return 0;
     if (c <= 0x7F) {  // short circuit ASCII
@@ -1659,7 +1751,13 @@ static char32_t escLeftBracket1Routine(char32_t c) {
   return doDispatch(c, escLeftBracket1Dispatch);
 }
 static char32_t escLeftBracket2Routine(char32_t c) {
-  return escFailureRoutine(c);  // Insert key, unused
+  // ESC [ 2 0 0 ~ starts a bracketed paste, ESC [ 2 ~ is the Insert key, unused
+  for (const char expected : {'0', '0', '~'}) {
+    c = readUnicodeCharacter();
+    if (c == 0) return 0;
+    if (c != static_cast<char32_t>(expected)) return escFailureRoutine(c);
+  }
+  return thisKeyMetaCtrl | PASTE_START_KEY;
 }
 static char32_t escLeftBracket3Routine(char32_t c) {
   c = readUnicodeCharacter();
@@ -1759,6 +1857,53 @@ static char32_t setMetaRoutine(char32_t c) {
 
 }  // namespace EscapeSequenceProcessing // move these out of global namespace
 
+/**
+ * Reads the text of a bracketed paste, once its start sequence was received.
+ * Text is read in big chunks up to the ESC [ 201 ~ sequence, anything after it
+ * is processed later as regular key strokes.
+ */
+static string readPastedText() {
+  static const char endSequence[] = "\x1b[201~";
+  const size_t endSequenceLength = sizeof(endSequence) - 1;
+  string text;
+  text.swap(pendingInput);
+  size_t searchFrom = 0;
+
+  while (true) {
+    const size_t end = text.find(endSequence, searchFrom);
+    if (end != string::npos) {
+      pendingInput = text.substr(end + endSequenceLength);
+      text.resize(end);
+      break;
+    }
+    if (text.length() > endSequenceLength) {
+      searchFrom = text.length() - endSequenceLength;
+    }
+
+    char chunk[4096];
+    ssize_t nread;
+    do {
+      nread = read(0, chunk, sizeof(chunk));
+    } while ((nread == -1) && (errno == EINTR));
+
+    if (nread <= 0) break;  // end of input, use whatever was received
+    text.append(chunk, nread);
+  }
+
+  // terminals send CR as the line separator
+  string result;
+  result.reserve(text.length());
+  for (size_t i = 0; i < text.length(); ++i) {
+    if (text[i] == '\r') {
+      result += '\n';
+      if (i + 1 < text.length() && text[i + 1] == '\n') ++i;
+    } else {
+      result += text[i];
+    }
+  }
+  return result;
+}
+
 #endif  // #ifndef _WIN32
 
 // linenoiseReadChar -- read a keystroke or keychord from the keyboard, and
@@ -2347,11 +2492,10 @@ int InputBuffer::incrementalHistorySearch(PromptBase& pi, int startChar) {
   // don't have to
   // special case it
   if (historyIndex == historyLen - 1) {
-    free(history[historyLen - 1]);
     bufferSize = sizeof(char32_t) * len + 1;
     unique_ptr<char[]> tempBuffer(new char[bufferSize]);
     copyString32to8(tempBuffer.get(), bufferSize, buf32);
-    history[historyLen - 1] = strdup8(tempBuffer.get());
+    historySetLine(historyLen - 1, strdup8(tempBuffer.get()));
   }
   int historyLineLength = len;
   int historyLinePosition = pos;
@@ -2461,7 +2605,7 @@ int InputBuffer::incrementalHistorySearch(PromptBase& pi, int startChar) {
           bufferSize = historyLineLength + 1;
           unique_ptr<char32_t[]> tempUnicode(new char32_t[bufferSize]);
           copyString8to32(tempUnicode.get(), bufferSize, ucharCount,
-                          history[historyIndex]);
+                          historyLine(historyIndex));
           dynamicRefresh(dp, tempUnicode.get(), historyLineLength,
                          historyLinePosition);
         }
@@ -2510,8 +2654,11 @@ int InputBuffer::incrementalHistorySearch(PromptBase& pi, int startChar) {
       }
       activeHistoryLine = new char32_t[bufferSize];
       copyString8to32(activeHistoryLine, bufferSize, ucharCount,
-                      history[historyIndex]);
+                      historyLine(historyIndex));
       if (dp.searchTextLen > 0) {
+        size_t searchTextSize = sizeof(char32_t) * dp.searchTextLen + 1;
+        unique_ptr<char[]> searchText8(new char[searchTextSize]);
+        copyString32to8(searchText8.get(), searchTextSize, dp.searchText.get());
         bool found = false;
         int historySearchIndex = historyIndex;
         int lineLength = static_cast<int>(ucharCount);
@@ -2536,15 +2683,17 @@ int InputBuffer::incrementalHistorySearch(PromptBase& pi, int startChar) {
             historyLineLength = lineLength;
             historyLinePosition = lineSearchPos;
             break;
-          } else if ((dp.direction > 0) ? (historySearchIndex < historyLen - 1)
-                                        : (historySearchIndex > 0)) {
-            historySearchIndex += dp.direction;
-            bufferSize = strlen8(history[historySearchIndex]) + 1;
+          }
+          // jump straight to the next line which contains the search text
+          historySearchIndex =
+              historyFind(historySearchIndex, dp.direction, searchText8.get());
+          if (historySearchIndex >= 0) {
+            bufferSize = strlen8(historyLine(historySearchIndex)) + 1;
             delete[] activeHistoryLine;
             activeHistoryLine = nullptr;
             activeHistoryLine = new char32_t[bufferSize];
             copyString8to32(activeHistoryLine, bufferSize, ucharCount,
-                            history[historySearchIndex]);
+                            historyLine(historySearchIndex));
             lineLength = static_cast<int>(ucharCount);
             lineSearchPos =
                 (dp.direction > 0) ? 0 : (lineLength - dp.searchTextLen);
@@ -2561,7 +2710,7 @@ int InputBuffer::incrementalHistorySearch(PromptBase& pi, int startChar) {
       bufferSize = historyLineLength + 1;
       activeHistoryLine = new char32_t[bufferSize];
       copyString8to32(activeHistoryLine, bufferSize, ucharCount,
-                      history[historyIndex]);
+                      historyLine(historyIndex));
       dynamicRefresh(dp, activeHistoryLine, historyLineLength,
                      historyLinePosition);  // draw user's text with our prompt
     }
@@ -2617,6 +2766,96 @@ static bool gotResize = false;
 #endif
 static int keyType = 0;
 
+static string toUtf8(const char32_t* text, size_t length) {
+  size_t bufferSize = sizeof(char32_t) * length + 1;
+  unique_ptr<char[]> buffer(new char[bufferSize]);
+  size_t count = 0;
+  copyString32to8(buffer.get(), bufferSize, &count, text, length);
+  return string(buffer.get(), count);
+}
+
+/**
+ * Inserts pasted text at the cursor position, redrawing the line just once.
+ *
+ * Pasted text is never accepted on its own. If it contains line breaks, the
+ * lines up to the last one are displayed above a new prompt and kept aside,
+ * the last line is left in the buffer for editing, and linenoise() returns all
+ * of them once Enter is pressed. Text which doesn't fit into the buffer is
+ * truncated.
+ */
+void InputBuffer::insertPastedText(PromptBase& pi, const string& text) {
+  const size_t lastNewline = text.rfind('\n');
+  string line = text;
+
+  if (lastNewline != string::npos) {
+    const string complete = toUtf8(buf32, pos) + text.substr(0, lastNewline);
+    const size_t firstNewline = complete.find('\n');
+
+    if (hasPastedInput) pastedInput += '\n';
+    pastedInput += complete;
+    hasPastedInput = true;
+
+    // display the first line as if it was typed, and the rest below it
+    const size_t after = static_cast<size_t>(len - pos);
+    unique_ptr<char32_t[]> after32(new char32_t[after]);
+    memcpy(after32.get(), buf32 + pos, sizeof(char32_t) * after);
+
+    unique_ptr<char32_t[]> line32(new char32_t[complete.length() + 1]);
+    size_t count = 0;
+    copyString8to32(line32.get(), complete.length() + 1, count,
+                    complete.substr(0, firstNewline).c_str());
+    if (count > static_cast<size_t>(buflen)) count = buflen;
+    memcpy(buf32, line32.get(), sizeof(char32_t) * count);
+    buf32[count] = 0;
+    len = pos = static_cast<int>(count);
+    recomputeCharacterWidths(buf32, charWidths, len);
+    refreshLine(pi);
+
+    printf("\n");
+    if (firstNewline != string::npos) {
+      printf("%s\n", complete.c_str() + firstNewline + 1);
+    }
+    fflush(stdout);
+
+    // display a new prompt, the text which followed the cursor is kept after
+    // the last line
+    if (!pi.write()) return;
+#ifndef _WIN32
+    // we have to generate our own newline on line wrap on Linux
+    if (pi.promptIndentation == 0 && pi.promptExtraLines > 0)
+      if (write(1, "\n", 1) == -1) return;
+#endif
+    pi.promptCursorRowOffset = pi.promptExtraLines;
+    pi.promptPreviousInputLen = 0;
+    memcpy(buf32, after32.get(), sizeof(char32_t) * after);
+    len = static_cast<int>(after);
+    pos = 0;
+    buf32[len] = 0;
+    line = text.substr(lastNewline + 1);
+  }
+
+  unique_ptr<char32_t[]> input32(new char32_t[line.length() + 1]);
+  size_t count = 0;
+  copyString8to32(input32.get(), line.length() + 1, count, line.c_str());
+
+  if (count > static_cast<size_t>(buflen - len)) {
+    count = buflen - len;
+    beep();
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    if (isControlChar(input32[i])) input32[i] = ' ';
+  }
+
+  memmove(buf32 + pos + count, buf32 + pos, sizeof(char32_t) * (len - pos));
+  memcpy(buf32 + pos, input32.get(), sizeof(char32_t) * count);
+  len += static_cast<int>(count);
+  pos += static_cast<int>(count);
+  buf32[len] = 0;
+  recomputeCharacterWidths(buf32, charWidths, len);
+  refreshLine(pi);
+}
+
 int InputBuffer::getInputLine(PromptBase& pi) {
   keyType = 0;
 
@@ -2651,6 +2890,9 @@ int InputBuffer::getInputLine(PromptBase& pi) {
   // keystroke
   int terminatingKeystroke = -1;
 
+  // text was pasted since the prompt was displayed
+  bool pasted = false;
+
   // if there is already text in the buffer, display it first
   if (len > 0) {
     refreshLine(pi);
@@ -2693,6 +2935,11 @@ int InputBuffer::getInputLine(PromptBase& pi) {
     }
 
     if (c == 0) {
+      // input has ended, pasted text is accepted only with Enter
+      if (pasted) {
+        historyPopBack();
+        return -1;
+      }
       return len;
     }
 
@@ -2768,8 +3015,7 @@ int InputBuffer::getInputLine(PromptBase& pi) {
         killRing.lastAction = KillRing::actionOther;
         historyRecallMostRecent = false;
         errno = EAGAIN;
-        --historyLen;
-        free(history[historyLen]);
+        historyPopBack();
         // we need one last refresh with the cursor at the end of the line
         // so we don't display the next prompt over the previous input line
         pos = len;  // pass len as pos for EOL
@@ -2811,8 +3057,7 @@ int InputBuffer::getInputLine(PromptBase& pi) {
           --len;
           refreshLine(pi);
         } else if (len == 0) {
-          --historyLen;
-          free(history[historyLen]);
+          historyPopBack();
           return -1;
         }
         break;
@@ -2910,8 +3155,7 @@ int InputBuffer::getInputLine(PromptBase& pi) {
         pos = len;  // pass len as pos for EOL
         refreshLine(pi);
         historyPreviousIndex = historyRecallMostRecent ? historyIndex : -2;
-        --historyLen;
-        free(history[historyLen]);
+        historyPopBack();
         return len;
 
       case ctrlChar('K'):  // ctrl-K, kill from cursor to end of line
@@ -2954,11 +3198,10 @@ int InputBuffer::getInputLine(PromptBase& pi) {
         // we don't
         // have to special case it
         if (historyIndex == historyLen - 1) {
-          free(history[historyLen - 1]);
           size_t tempBufferSize = sizeof(char32_t) * len + 1;
           unique_ptr<char[]> tempBuffer(new char[tempBufferSize]);
           copyString32to8(tempBuffer.get(), tempBufferSize, buf32);
-          history[historyLen - 1] = strdup8(tempBuffer.get());
+          historySetLine(historyLen - 1, strdup8(tempBuffer.get()));
         }
         if (historyLen > 1) {
           if (c == UP_ARROW_KEY) {
@@ -2980,7 +3223,7 @@ int InputBuffer::getInputLine(PromptBase& pi) {
           }
           historyRecallMostRecent = true;
           size_t ucharCount = 0;
-          copyString8to32(buf32, buflen, ucharCount, history[historyIndex]);
+          copyString8to32(buf32, buflen, ucharCount, historyLine(historyIndex));
           len = pos = static_cast<int>(ucharCount);
           refreshLine(pi);
         }
@@ -3153,11 +3396,10 @@ int InputBuffer::getInputLine(PromptBase& pi) {
         // we don't
         // have to special case it
         if (historyIndex == historyLen - 1) {
-          free(history[historyLen - 1]);
           size_t tempBufferSize = sizeof(char32_t) * len + 1;
           unique_ptr<char[]> tempBuffer(new char[tempBufferSize]);
           copyString32to8(tempBuffer.get(), tempBufferSize, buf32);
-          history[historyLen - 1] = strdup8(tempBuffer.get());
+          historySetLine(historyLen - 1, strdup8(tempBuffer.get()));
         }
         if (historyLen > 1) {
           historyIndex =
@@ -3165,12 +3407,21 @@ int InputBuffer::getInputLine(PromptBase& pi) {
           historyPreviousIndex = -2;
           historyRecallMostRecent = true;
           size_t ucharCount = 0;
-          copyString8to32(buf32, buflen, ucharCount, history[historyIndex]);
+          copyString8to32(buf32, buflen, ucharCount, historyLine(historyIndex));
           len = pos = static_cast<int>(ucharCount);
           refreshLine(pi);
         }
         break;
 
+#ifndef _WIN32
+      case PASTE_START_KEY:  // bracketed paste, insert all of it at once
+        killRing.lastAction = KillRing::actionOther;
+        historyRecallMostRecent = false;
+        pasted = true;
+        insertPastedText(pi, readPastedText());
+        break;
+#endif
+
       // not one of our special characters, maybe insert it in the buffer
       default:
         killRing.lastAction = KillRing::actionOther;
@@ -3341,12 +3592,22 @@ char* linenoise(const char* prompt) {
       int count = ib.getInputLine(pi);
       disableRawMode();
       printf("\n");
+      string pasted;
+      if (hasPastedInput) {
+        // lines were already displayed by the input buffer
+        pasted.swap(pastedInput);
+        pasted += '\n';
+        hasPastedInput = false;
+      }
       if (count == -1) {
         return NULL;
       }
       size_t bufferSize = sizeof(char32_t) * ib.length() + 1;
       unique_ptr<char[]> buf8(new char[bufferSize]);
       copyString32to8(buf8.get(), bufferSize, buf32);
+      if (!pasted.empty()) {
+        return strdup((pasted + buf8.get()).c_str());  // caller must free
+      }
       return strdup(buf8.get());  // caller must free buffer
     }
   } else {  // input not from a terminal, we should work with piped input, i.e.
@@ -3380,12 +3641,12 @@ int linenoiseHistoryAdd(const char* line) {
     return 0;
   }
   if (history == NULL) {
-    history =
-        reinterpret_cast<char8_t**>(malloc(sizeof(char8_t*) * historyMaxLen));
+    history = reinterpret_cast<HistoryEntry*>(
+        calloc(historyMaxLen, sizeof(HistoryEntry)));
     if (history == NULL) {
       return 0;
     }
-    memset(history, 0, (sizeof(char*) * historyMaxLen));
+    historyStart = 0;
   }
   char8_t* linecopy = strdup8(line);
   if (!linecopy) {
@@ -3402,24 +3663,25 @@ int linenoiseHistoryAdd(const char* line) {
   }
 
   // prevent duplicate history entries
-  if (historyLen > 0 && history[historyLen - 1] != nullptr &&
-      strcmp(reinterpret_cast<char const*>(history[historyLen - 1]),
+  if (historyLen > 0 && historyLine(historyLen - 1) != nullptr &&
+      strcmp(reinterpret_cast<char const*>(historyLine(historyLen - 1)),
              reinterpret_cast<char const*>(linecopy)) == 0) {
     free(linecopy);
     return 0;
   }
 
   if (historyLen == historyMaxLen) {
-    free(history[0]);
-    memmove(history, history + 1, sizeof(char*) * (historyMaxLen - 1));
+    free(historyLine(0));
+    historyEntry(0).line = NULL;
+    historyStart = (historyStart + 1) % historyMaxLen;
     --historyLen;
     if (--historyPreviousIndex < -1) {
       historyPreviousIndex = -2;
     }
   }
 
-  history[historyLen] = linecopy;
   ++historyLen;
+  historySetLine(historyLen - 1, linecopy);
   return 1;
 }
 
@@ -3428,9 +3690,17 @@ int linenoiseHistoryDelete(int index) {
     return 0;
   }
 
-  if (history[index]) {
-    free(history[index]);
-    memmove(history + index, history + index + 1, sizeof(char*) * (historyLen - index - 1));
+  if (historyLine(index)) {
+    free(historyLine(index));
+    if (index == 0) {
+      historyEntry(0).line = NULL;
+      historyStart = (historyStart + 1) % historyMaxLen;
+    } else {
+      for (int i = index; i < historyLen - 1; ++i) {
+        historyEntry(i) = historyEntry(i + 1);
+      }
+      historyEntry(historyLen - 1).line = NULL;
+    }
     --historyLen;
   }
   return 1;
@@ -3442,20 +3712,21 @@ int linenoiseHistorySetMaxLen(int len) {
   }
   if (history) {
     int tocopy = historyLen;
-    char8_t** newHistory =
-        reinterpret_cast<char8_t**>(malloc(sizeof(char8_t*) * len));
+    HistoryEntry* newHistory =
+        reinterpret_cast<HistoryEntry*>(calloc(len, sizeof(HistoryEntry)));
     if (newHistory == NULL) {
       return 0;
     }
     if (len < tocopy) {
       tocopy = len;
     }
-    memcpy(newHistory, history + historyLen - tocopy,
-           sizeof(char8_t*) * tocopy);
     for (int i = 0; i < historyLen - tocopy; i++)
-      free(history[i]);
+      free(historyLine(i));
+    for (int i = 0; i < tocopy; i++)
+      newHistory[i] = historyEntry(historyLen - tocopy + i);
     free(history);
     history = newHistory;
+    historyStart = 0;
   }
   historyMaxLen = len;
   if (historyLen > historyMaxLen) {
@@ -3474,36 +3745,46 @@ int linenoiseHistorySize(void) {
 const char* linenoiseHistoryLine(int index) {
   if (index < 0 || index >= historyLen) return NULL;
 
-  return reinterpret_cast<char const*>(history[index]);
+  return reinterpret_cast<char const*>(historyLine(index));
 }
 
-/* Save the history in the specified file. On success 0 is returned
- * otherwise -1 is returned. */
-int linenoiseHistorySave(const char* filename) {
+static int historyWrite(const char* filename, int first, bool append) {
 #if _WIN32
-  FILE* fp = fopen(filename, "wt");
+  FILE* fp = fopen(filename, append ? "at" : "wt");
 #else
-  int fd = open(filename, O_CREAT | O_TRUNC | O_WRONLY, S_IRUSR | S_IWUSR);
+  int fd = open(filename, O_CREAT | O_WRONLY | (append ? O_APPEND : O_TRUNC),
+                S_IRUSR | S_IWUSR);
   if (fd < 0) {
     return -1;
   }
 
-  FILE* fp = fdopen(fd, "wt");
+  FILE* fp = fdopen(fd, append ? "at" : "wt");
 #endif
 
   if (fp == NULL) {
     return -1;
   }
 
-  for (int j = 0; j < historyLen; ++j) {
-    if (history[j][0] != '\0') {
-      fprintf(fp, "%s\n", history[j]);
+  for (int j = first; j < historyLen; ++j) {
+    if (historyLine(j)[0] != '\0') {
+      fprintf(fp, "%s\n", historyLine(j));
     }
   }
 
-  fclose(fp);
+  return fclose(fp) == 0 ? 0 : -1;
+}
 
-  return 0;
+/* Save the history in the specified file. On success 0 is returned
+ * otherwise -1 is returned. */
+int linenoiseHistorySave(const char* filename) {
+  return historyWrite(filename, 0, false);
+}
+
+/* Append the history entries starting with the given index to the specified
+ * file. On success 0 is returned otherwise -1 is returned. */
+int linenoiseHistoryAppend(const char* filename, int index) {
+  if (index < 0) index = 0;
+  return historyWrite(filename, index, true);
 }
 
 /* Load the history from the specified file. If the file does not exist
@@ -36,6 +36,7 @@
 #include "modules/adminapi/mod_dba.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/mysql/session_pool.h"
 #include "mysqlshdk/libs/mysql/replication.h"
 #include "mysqlshdk/libs/mysql/user_privileges.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
@@ -1807,18 +1808,13 @@ std::string get_report_host_address(
             instance_address.c_str());
   try {
     std::shared_ptr<mysqlshdk::db::ISession> session =
-        mysqlshdk::db::mysql::Session::create();
-    session->connect(target_cnx_opts);
+        mysqlshdk::db::mysql::open_pooled_session(target_cnx_opts);
     mysqlshdk::mysql::Instance target_instance(session);
     log_debug("Successfully connected to instance");
 
     // Get the instance report host value.
     md_address = mysqlshdk::mysql::get_report_host(target_instance) + ":" +
                  std::to_string(target_cnx_opts.get_port());
-
-    session->close();
-    log_debug("Closed connection to the instance '%s'.",
-              instance_address.c_str());
   } catch (std::exception &err) {
     log_debug("Failed to connect to instance '%s': %s",
               instance_address.c_str(), err.what());
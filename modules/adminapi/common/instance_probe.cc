@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/adminapi/common/instance_probe.h"
+
+#include <atomic>
+
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/utils_connection.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlsh {
+namespace dba {
+
+std::vector<Instance_probe> probe_instances(
+    const std::vector<mysqlshdk::db::Connection_options> &instances,
+    const Probe_function &probe, std::chrono::milliseconds connect_timeout,
+    std::size_t max_threads) {
+  std::vector<Instance_probe> results(instances.size());
+  std::atomic<std::size_t> next{0};
+
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    auto &connection = results[i].connection;
+    connection = instances[i];
+
+    if (!connection.has(mysqlshdk::db::kConnectTimeout))
+      connection.set(mysqlshdk::db::kConnectTimeout,
+                     {std::to_string(connect_timeout.count())});
+  }
+
+  const auto probe_next = [&results, &next, &probe]() {
+    std::size_t i = 0;
+
+    while ((i = next++) < results.size()) {
+      auto &result = results[i];
+      const auto address = result.connection.as_uri(
+          mysqlshdk::db::uri::formats::only_transport());
+      std::shared_ptr<mysqlshdk::db::ISession> session;
+
+      try {
+        log_info("Opening a new session to the instance: %s", address.c_str());
+        session = mysqlshdk::db::mysql::Session::create();
+        session->connect(result.connection);
+      } catch (const std::exception &e) {
+        result.connect_error = e.what();
+        log_warning("Could not open connection to %s: %s.", address.c_str(),
+                    e.what());
+        continue;
+      }
+
+      try {
+        if (probe) probe(i, session);
+      } catch (...) {
+        result.error = std::current_exception();
+      }
+
+      session->close();
+    }
+  };
+
+  const auto threads = worker_thread_count(max_threads, instances.size());
+
+  if (threads <= 1) {
+    probe_next();
+  } else {
+    Worker_threads workers;
+
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers.start(probe_next);
+    }
+
+    workers.join();
+  }
+
+  return results;
+}
+
+}  // namespace dba
+}  // namespace mysqlsh
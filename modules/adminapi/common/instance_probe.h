@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_ADMINAPI_COMMON_INSTANCE_PROBE_H_
+#define MODULES_ADMINAPI_COMMON_INSTANCE_PROBE_H_
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/session.h"
+
+namespace mysqlsh {
+namespace dba {
+
+/**
+ * Outcome of probing a single instance.
+ */
+struct Instance_probe {
+  /// Connection options used to reach the instance.
+  mysqlshdk::db::Connection_options connection;
+  /// Error which prevented the connection, empty if instance is reachable.
+  std::string connect_error;
+  /// Exception thrown by the probe function.
+  std::exception_ptr error;
+};
+
+/**
+ * Called in a worker thread with an open session to the instance at the given
+ * position, each call needs to store its results separately.
+ */
+using Probe_function = std::function<void(
+    std::size_t index, const std::shared_ptr<mysqlshdk::db::ISession> &)>;
+
+/**
+ * Connects to the given instances and probes them concurrently.
+ *
+ * Each instance is handled by its own thread (up to max_threads), which opens
+ * a session, passes it to the probe function and closes it. Function returns
+ * once all instances were processed, so that the caller can make decisions
+ * once the complete picture is known. Total time is bound by the slowest
+ * instance, rather than by the sum of their times. When sessions are recorded
+ * or replayed, instances are probed one by one, in their order.
+ *
+ * @param instances connection options of the instances, with credentials
+ * @param probe optional function called with session of reachable instances
+ * @param connect_timeout used if connection options do not specify one
+ * @param max_threads maximum number of instances probed at the same time
+ *
+ * @returns outcome of each instance, in order of the instances.
+ */
+std::vector<Instance_probe> probe_instances(
+    const std::vector<mysqlshdk::db::Connection_options> &instances,
+    const Probe_function &probe = {},
+    std::chrono::milliseconds connect_timeout =
+        std::chrono::milliseconds(mysqlshdk::db::k_default_connect_timeout),
+    std::size_t max_threads = 16);
+
+}  // namespace dba
+}  // namespace mysqlsh
+
+#endif  // MODULES_ADMINAPI_COMMON_INSTANCE_PROBE_H_
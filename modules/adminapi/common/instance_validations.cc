@@ -24,16 +24,26 @@
 #include "modules/adminapi/common/instance_validations.h"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "modules/adminapi/common/provision.h"
 #include "modules/adminapi/mod_dba.h"
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/libs/config/config_server_handler.h"
+#include "mysqlshdk/libs/db/mysql/session_pool.h"
 #include "mysqlshdk/libs/mysql/replication.h"
 #include "mysqlshdk/libs/textui/textui.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 
 // Naming convention for validations:
@@ -57,6 +67,90 @@ namespace mysqlsh {
 namespace dba {
 namespace checks {
 
+namespace {
+
+constexpr const char k_gr_compliance_skip_schemas[] =
+    "('mysql', 'sys', 'performance_schema', 'information_schema')";
+constexpr const char k_gr_compliance_skip_engines[] = "('InnoDB', 'MEMORY')";
+
+struct Schema_issues {
+  std::vector<std::string> bad_engine_tables;
+  std::vector<std::string> no_pk_tables;
+};
+
+/**
+ * Finds tables of the given schema which are not compatible with Group
+ * Replication. Rows are processed as they arrive, on_issue() is called for
+ * each of the incompatible tables, scan stops as soon as cancelled is set.
+ */
+void scan_schema(mysqlshdk::db::ISession *session, const std::string &schema,
+                 const std::atomic<bool> &cancelled,
+                 const std::function<void()> &on_issue,
+                 Schema_issues *issues) {
+  const auto fetch = [&](const std::string &query,
+                         std::vector<std::string> *tables) {
+    const auto result = session->query(query);
+    const mysqlshdk::db::IRow *row = nullptr;
+
+    while (!cancelled && (row = result->fetch_one()) != nullptr) {
+      tables->emplace_back(schema + "." + row->get_string(0));
+      on_issue();
+    }
+  };
+
+  fetch(shcore::sqlstring(std::string{"SELECT table_name "
+                                      "FROM information_schema.tables "
+                                      "WHERE table_schema = ? "
+                                      "AND engine NOT IN "} +
+                              k_gr_compliance_skip_engines,
+                          0)
+            << schema,
+        &issues->bad_engine_tables);
+
+  if (!cancelled) {
+    fetch(shcore::sqlstring(
+              "SELECT t.table_name "
+              "FROM information_schema.tables t "
+              "    LEFT JOIN (SELECT table_name "
+              "               FROM information_schema.statistics "
+              "               WHERE table_schema = ? "
+              "               GROUP BY table_name, index_name "
+              "               HAVING SUM(CASE "
+              "                   WHEN non_unique = 0 AND nullable <> 'YES' "
+              "                   THEN 1 ELSE 0 END) = COUNT(*) "
+              "              ) puks "
+              "    ON t.table_name = puks.table_name "
+              "WHERE t.table_schema = ? "
+              "    AND puks.table_name IS NULL "
+              "    AND t.table_type = 'BASE TABLE'",
+              0)
+              << schema << schema,
+          &issues->no_pk_tables);
+  }
+}
+
+void print_tables(const std::vector<Schema_issues> &issues,
+                  std::vector<std::string> Schema_issues::*tables,
+                  const char *warning) {
+  std::string list;
+
+  for (const auto &schema : issues) {
+    for (const auto &table : schema.*tables) {
+      if (!list.empty()) list.append(", ");
+      list.append(table);
+    }
+  }
+
+  if (!list.empty()) {
+    auto console = mysqlsh::current_console();
+    console->print_warning(warning);
+    list.append("\n");
+    console->println(list);
+  }
+}
+
+}  // namespace
+
 /**
  * Perform validation of schemas for compatibility issues with group
  * replication. If any issues are found, they're printed to the console.
@@ -65,93 +159,124 @@ namespace checks {
  * - GR compatible storage engines only (InnoDB and MEMORY)
  * - all tables must have a PK or a UNIQUE NOT NULL key
  *
+ * Each schema is scanned separately, if the session uses the classic
+ * protocol, schemas are distributed among additional sessions opened to the
+ * same instance. When recording or replaying sessions, only the given session
+ * is used, so that the queries are executed in a deterministic order.
+ *
+ * If options.max_issues is set, scan stops once that many incompatible tables
+ * are found and a note says that there may be more of them.
+ *
  * @param  session session for the schema. Must be authenticated with an account
  *          with SELECT access to all schemas.
+ * @param  options controls the number of sessions and the early exit.
  * @return         true if no issues found.
  */
-bool validate_schemas(std::shared_ptr<mysqlshdk::db::ISession> session) {
-  bool ok = true;
-  std::string k_gr_compliance_skip_schemas =
-      "('mysql', 'sys', 'performance_schema', 'information_schema')";
-  std::string k_gr_compliance_skip_engines = "('InnoDB', 'MEMORY')";
-
-  auto console = mysqlsh::current_console();
+bool validate_schemas(std::shared_ptr<mysqlshdk::db::ISession> session,
+                      const Schema_validation_options &options) {
+  std::vector<std::string> schemas;
 
   {
-    std::shared_ptr<mysqlshdk::db::IResult> result = session->query(
-        "SELECT table_schema, table_name, engine "
-        " FROM information_schema.tables "
-        " WHERE engine NOT IN " +
-        k_gr_compliance_skip_engines + " AND table_schema NOT IN " +
-        k_gr_compliance_skip_schemas);
-
-    auto row = result->fetch_one();
-    if (row) {
-      console->print_warning(
-          "The following tables use a storage engine that are not supported by "
-          "Group Replication:");
-      ok = false;
-      std::string tables;
-      while (row) {
-        if (!tables.empty()) tables.append(", ");
-        tables.append(row->get_string(0))
-            .append(".")
-            .append(row->get_string(1));
-        row = result->fetch_one();
+    const auto result = session->query(
+        std::string{"SELECT schema_name FROM information_schema.schemata "
+                    "WHERE schema_name NOT IN "} +
+        k_gr_compliance_skip_schemas + " ORDER BY schema_name");
+    const mysqlshdk::db::IRow *row = nullptr;
+
+    while ((row = result->fetch_one()) != nullptr)
+      schemas.emplace_back(row->get_string(0));
+  }
+
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions{session};
+
+  if (std::dynamic_pointer_cast<mysqlshdk::db::mysql::Session>(session)) {
+    const auto count =
+        mysqlsh::worker_thread_count(options.max_sessions, schemas.size());
+
+    while (sessions.size() < count) {
+      try {
+        sessions.emplace_back(mysqlshdk::db::mysql::open_pooled_session(
+            session->get_connection_options()));
+      } catch (const std::exception &e) {
+        log_info("Unable to open additional session to validate schemas: %s",
+                 e.what());
+        break;
       }
-      tables.append("\n");
-      console->println(tables);
     }
   }
+
+  std::vector<Schema_issues> issues(schemas.size());
+  std::atomic<size_t> next{0};
+  std::atomic<size_t> found{0};
+  std::atomic<bool> cancelled{false};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  const auto limit_reached = [&found, &options]() {
+    return options.max_issues > 0 && found >= options.max_issues;
+  };
+
+  const auto on_issue = [&]() {
+    ++found;
+    if (limit_reached()) cancelled = true;
+  };
+
+  const auto worker = [&](mysqlshdk::db::ISession *s) {
+    try {
+      size_t i = 0;
+
+      while (!cancelled && (i = next++) < schemas.size())
+        scan_schema(s, schemas[i], cancelled, on_issue, &issues[i]);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) error = std::current_exception();
+      cancelled = true;
+    }
+  };
+
   {
-    std::shared_ptr<mysqlshdk::db::IResult> result = session->query(
-        "SELECT t.table_schema, t.table_name "
-        "FROM information_schema.tables t "
-        "    LEFT JOIN (SELECT table_schema, table_name "
-        "               FROM information_schema.statistics "
-        "               GROUP BY table_schema, table_name, index_name "
-        "               HAVING SUM(CASE "
-        "                   WHEN non_unique = 0 AND nullable != 'YES' "
-        "                   THEN 1 ELSE 0 END) = COUNT(*) "
-        "              ) puks "
-        "    ON t.table_schema = puks.table_schema "
-        "        AND t.table_name = puks.table_name "
-        "WHERE puks.table_name IS NULL "
-        "    AND t.table_type = 'BASE TABLE' "
-        "    AND t.table_schema NOT IN " +
-        k_gr_compliance_skip_schemas);
-
-    auto row = result->fetch_one();
-    if (row) {
-      console->print_warning(
-          "The following tables do not have a Primary Key or equivalent "
-          "column: ");
-      ok = false;
-      std::string tables;
-      while (row) {
-        if (!tables.empty()) tables.append(", ");
-        tables.append(row->get_string(0))
-            .append(".")
-            .append(row->get_string(1));
-        row = result->fetch_one();
-      }
-      tables.append("\n");
-      console->println(tables);
+    mysqlsh::Worker_threads threads;
+
+    for (size_t i = 1; i < sessions.size(); ++i) {
+      const auto s = sessions[i].get();
+      threads.start([&worker, s]() { worker(s); });
     }
+
+    worker(session.get());
   }
-  if (!ok) {
-    console->print_info(
-        "Group Replication requires tables to use InnoDB and "
-        "have a PRIMARY KEY or PRIMARY KEY Equivalent (non-null "
-        "unique key). Tables that do not follow these "
-        "requirements will be readable but not updateable "
-        "when used with Group Replication. "
-        "If your applications make updates (INSERT, UPDATE or "
-        "DELETE) to these tables, ensure they use the InnoDB "
-        "storage engine and have a PRIMARY KEY or PRIMARY KEY "
-        "Equivalent.");
+
+  if (error) std::rethrow_exception(error);
+
+  if (0 == found) return true;
+
+  print_tables(issues, &Schema_issues::bad_engine_tables,
+               "The following tables use a storage engine that are not "
+               "supported by Group Replication:");
+  print_tables(issues, &Schema_issues::no_pk_tables,
+               "The following tables do not have a Primary Key or equivalent "
+               "column: ");
+
+  auto console = mysqlsh::current_console();
+
+  if (limit_reached()) {
+    console->print_note(shcore::str_format(
+        "Validation stopped after %zu incompatible tables were found, there "
+        "may be more.",
+        found.load()));
   }
-  return ok;
+
+  console->print_info(
+      "Group Replication requires tables to use InnoDB and "
+      "have a PRIMARY KEY or PRIMARY KEY Equivalent (non-null "
+      "unique key). Tables that do not follow these "
+      "requirements will be readable but not updateable "
+      "when used with Group Replication. "
+      "If your applications make updates (INSERT, UPDATE or "
+      "DELETE) to these tables, ensure they use the InnoDB "
+      "storage engine and have a PRIMARY KEY or PRIMARY KEY "
+      "Equivalent.");
+
+  return false;
 }
 
 /**
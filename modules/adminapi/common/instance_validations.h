@@ -41,7 +41,16 @@ namespace checks {
 
 void validate_host_address(mysqlshdk::mysql::IInstance *instance, bool verbose);
 
-bool validate_schemas(std::shared_ptr<mysqlshdk::db::ISession> session);
+struct Schema_validation_options {
+  /// Maximum number of sessions used to scan the schemas concurrently.
+  size_t max_sessions = 4;
+  /// Scan stops once this many incompatible tables are found, 0 means no
+  /// limit.
+  size_t max_issues = 0;
+};
+
+bool validate_schemas(std::shared_ptr<mysqlshdk::db::ISession> session,
+                      const Schema_validation_options &options = {});
 
 void validate_innodb_page_size(mysqlshdk::mysql::IInstance *instance);
 
@@ -22,6 +22,7 @@
  */
 
 #include <random>
+#include <utility>
 
 #include "db/mysqlx/mysqlxclient_clean.h"
 #include "modules/adminapi/common/metadata_storage.h"
@@ -48,6 +49,124 @@ MetadataStorage::MetadataStorage(
 
 MetadataStorage::~MetadataStorage() {}
 
+std::atomic<uint64_t> MetadataStorage::s_generation{0};
+
+MetadataStorage::Cache_scope::Cache_scope(
+    const std::shared_ptr<MetadataStorage> &md)
+    : _md(md) {
+  ++_md->m_cache_scopes;
+}
+
+MetadataStorage::Cache_scope::~Cache_scope() {
+  if (--_md->m_cache_scopes == 0) {
+    // snapshot needs to be validated again by the next scope
+    _md->m_snapshot_validated = false;
+  }
+}
+
+const Instance_definition *
+MetadataStorage::Snapshot::find_instance(const std::string &address) const {
+  const auto it = instance_by_address.find(address);
+  return it == instance_by_address.end() ? nullptr : &instances[it->second];
+}
+
+const MetadataStorage::Snapshot::Replicaset *
+MetadataStorage::Snapshot::find_replicaset(uint64_t rs_id) const {
+  const auto it = replicasets.find(rs_id);
+  return it == replicasets.end() ? nullptr : &it->second;
+}
+
+void MetadataStorage::invalidate_cache() const {
+  ++s_generation;
+  m_snapshot.reset();
+}
+
+const MetadataStorage::Snapshot *MetadataStorage::get_snapshot() const {
+  // uncommitted changes are not visible in GTID_EXECUTED, don't use the cache
+  // inside of a transaction
+  if (m_cache_scopes == 0 || _tx_deep > 0 || !_session) return nullptr;
+
+  if (m_snapshot && m_snapshot->generation != s_generation)
+    m_snapshot.reset();
+
+  try {
+    const auto get_gtid_executed = [this]() {
+      auto row = execute_sql("SELECT @@GLOBAL.gtid_executed")->fetch_one();
+      return row ? row->get_string(0) : std::string();
+    };
+
+    // GTID_EXECUTED is always read before the tables, if metadata changes in
+    // between, snapshot is going to be reloaded by the next scope
+    std::string gtid_executed;
+    bool has_gtid_executed = false;
+
+    if (m_snapshot && !m_snapshot_validated) {
+      gtid_executed = get_gtid_executed();
+      has_gtid_executed = true;
+      if (gtid_executed != m_snapshot->gtid_executed) m_snapshot.reset();
+    }
+
+    if (!m_snapshot) {
+      std::unique_ptr<Snapshot> snapshot(new Snapshot());
+      snapshot->generation = s_generation;
+      snapshot->gtid_executed =
+          has_gtid_executed ? gtid_executed : get_gtid_executed();
+
+      std::shared_ptr<mysqlshdk::db::IResult> result;
+      const mysqlshdk::db::IRow *row = nullptr;
+
+      result = execute_sql(
+          "SELECT replicaset_id, cluster_id, topology_type, active "
+          "FROM mysql_innodb_cluster_metadata.replicasets");
+
+      const auto get_string = [&row](uint32_t index) {
+        return row->is_null(index) ? std::string() : row->get_string(index);
+      };
+
+      while ((row = result->fetch_one())) {
+        auto &rs = snapshot->replicasets[row->get_uint(0)];
+        rs.cluster_id = row->get_uint(1);
+        rs.topology_type = get_string(2);
+        rs.active = !row->is_null(3) && row->get_int(3) == 1;
+      }
+
+      result = execute_sql(
+          "SELECT host_id, replicaset_id, mysql_server_uuid, instance_name, "
+          "role, "
+          "JSON_UNQUOTE(JSON_EXTRACT(addresses, '$.mysqlClassic')), "
+          "JSON_UNQUOTE(JSON_EXTRACT(addresses, '$.mysqlX')), "
+          "JSON_UNQUOTE(JSON_EXTRACT(addresses, '$.grLocal')) "
+          "FROM mysql_innodb_cluster_metadata.instances "
+          "ORDER BY instance_id");
+
+      while ((row = result->fetch_one())) {
+        Instance_definition instance;
+        instance.host_id = row->get_uint(0);
+        instance.replicaset_id = row->is_null(1) ? 0 : row->get_uint(1);
+        instance.uuid = get_string(2);
+        instance.label = get_string(3);
+        instance.role = get_string(4);
+        instance.endpoint = get_string(5);
+        instance.xendpoint = get_string(6);
+        instance.grendpoint = get_string(7);
+
+        snapshot->instance_by_address.emplace(instance.endpoint,
+                                              snapshot->instances.size());
+        snapshot->instances.push_back(std::move(instance));
+      }
+
+      m_snapshot = std::move(snapshot);
+    }
+  } catch (const std::exception &e) {
+    log_debug("DBA: Failed to load the metadata snapshot: %s", e.what());
+    m_snapshot.reset();
+    return nullptr;
+  }
+
+  m_snapshot_validated = true;
+  return m_snapshot.get();
+}
+
 std::shared_ptr<mysqlshdk::db::IResult> MetadataStorage::execute_sql(
     const std::string &sql, bool retry, const std::string &log_sql) const {
   std::shared_ptr<mysqlshdk::db::IResult> ret_val;
@@ -60,6 +179,8 @@ std::shared_ptr<mysqlshdk::db::IResult> MetadataStorage::execute_sql(
   if (!_session)
     throw shcore::Exception::metadata_error("The Metadata is inaccessible");
 
+  if (!shcore::str_ibeginswith(sql, "select")) invalidate_cache();
+
   int retry_count = kMaxReadOnlyRetries;
   while (retry_count > 0) {
     try {
@@ -116,7 +237,10 @@ void MetadataStorage::rollback() {
   // TODO(rennox): I think this is wrong, I thing rollback should be executed
   // whenever it is called, and it should actually set _tx_deep to 0.
   // I just put the logic as it was in the past, but needs to be reviewed
-  if (_tx_deep == 0) _session->execute("rollback");
+  if (_tx_deep == 0) {
+    invalidate_cache();
+    _session->execute("rollback");
+  }
 }
 
 uint64_t MetadataStorage::get_cluster_id(const std::string &cluster_name) {
@@ -138,6 +262,11 @@ uint64_t MetadataStorage::get_cluster_id(const std::string &cluster_name) {
 }
 
 uint64_t MetadataStorage::get_cluster_id(uint64_t rs_id) {
+  if (const auto snapshot = get_snapshot()) {
+    const auto rs = snapshot->find_replicaset(rs_id);
+    return rs ? rs->cluster_id : 0;
+  }
+
   uint64_t cluster_id = 0;
   shcore::sqlstring query;
 
@@ -535,6 +664,11 @@ void MetadataStorage::disable_replicaset(uint64_t rs_id) {
 }
 
 bool MetadataStorage::is_replicaset_active(uint64_t rs_id) {
+  if (const auto snapshot = get_snapshot()) {
+    const auto rs = snapshot->find_replicaset(rs_id);
+    return rs && rs->active;
+  }
+
   shcore::sqlstring query;
 
   query = shcore::sqlstring(
@@ -697,6 +831,8 @@ void MetadataStorage::load_cluster(const std::string &cluster_name,
 }
 
 bool MetadataStorage::is_replicaset_empty(uint64_t rs_id) {
+  if (get_snapshot()) return get_replicaset_count(rs_id) == 0;
+
   shcore::sqlstring query;
 
   query = shcore::sqlstring(
@@ -725,6 +861,14 @@ bool MetadataStorage::is_replicaset_empty(uint64_t rs_id) {
  * @return An integer with the number of instances in the replicaset.
  */
 uint64_t MetadataStorage::get_replicaset_count(uint64_t rs_id) const {
+  if (const auto snapshot = get_snapshot()) {
+    uint64_t count = 0;
+    for (const auto &instance : snapshot->instances) {
+      if (static_cast<uint64_t>(instance.replicaset_id) == rs_id) ++count;
+    }
+    return count;
+  }
+
   shcore::sqlstring query;
 
   query = shcore::sqlstring(
@@ -747,6 +891,11 @@ uint64_t MetadataStorage::get_replicaset_count(uint64_t rs_id) const {
 
 bool MetadataStorage::is_instance_on_replicaset(uint64_t rs_id,
                                                 const std::string &address) {
+  if (const auto snapshot = get_snapshot()) {
+    const auto instance = snapshot->find_instance(address);
+    return instance && static_cast<uint64_t>(instance->replicaset_id) == rs_id;
+  }
+
   shcore::sqlstring query;
 
   query = shcore::sqlstring(
@@ -834,6 +983,18 @@ std::vector<Instance_definition> MetadataStorage::get_replicaset_instances(
     uint64_t rs_id, bool with_state, const std::vector<std::string> &states,
     const std::shared_ptr<mysqlshdk::db::ISession> &alt_session) {
   std::vector<Instance_definition> ret_val;
+
+  // state of the members is not part of the snapshot
+  if (!with_state && states.empty() && !alt_session) {
+    if (const auto snapshot = get_snapshot()) {
+      for (const auto &instance : snapshot->instances) {
+        if (static_cast<uint64_t>(instance.replicaset_id) == rs_id)
+          ret_val.push_back(instance);
+      }
+      return ret_val;
+    }
+  }
+
   std::string statement;
   shcore::sqlstring query;
 
@@ -921,6 +1082,15 @@ MetadataStorage::get_replicaset_active_instances(
 
 Instance_definition MetadataStorage::get_instance(
     const std::string &instance_address) {
+  if (const auto snapshot = get_snapshot()) {
+    if (const auto instance = snapshot->find_instance(instance_address))
+      return *instance;
+
+    throw shcore::Exception::metadata_error("The instance with the address '" +
+                                            instance_address +
+                                            "' does not exist.");
+  }
+
   shcore::sqlstring query;
   Instance_definition ret_val;
 
@@ -967,15 +1137,23 @@ Instance_definition MetadataStorage::get_instance(
 
 mysqlshdk::gr::Topology_mode MetadataStorage::get_replicaset_topology_mode(
     uint64_t rs_id) {
-  // Execute query to obtain the topology mode from the metadata.
-  shcore::sqlstring query = shcore::sqlstring{
-      "SELECT topology_type FROM mysql_innodb_cluster_metadata.replicasets "
-      "WHERE replicaset_id = ?",
-      0};
-  query << rs_id;
-  query.done();
+  std::string topology_mode;
+  const auto snapshot = get_snapshot();
+  const auto rs = snapshot ? snapshot->find_replicaset(rs_id) : nullptr;
 
-  std::string topology_mode = execute_sql(query)->fetch_one()->get_string(0);
+  if (rs) {
+    topology_mode = rs->topology_type;
+  } else {
+    // Execute query to obtain the topology mode from the metadata.
+    shcore::sqlstring query = shcore::sqlstring{
+        "SELECT topology_type FROM mysql_innodb_cluster_metadata.replicasets "
+        "WHERE replicaset_id = ?",
+        0};
+    query << rs_id;
+    query.done();
+
+    topology_mode = execute_sql(query)->fetch_one()->get_string(0);
+  }
 
   // Convert topology mode string from metadata to enumeration value.
   if (topology_mode == "pm") {
@@ -32,6 +32,8 @@
  * should be redesigned and moved thre.
  */
 
+#include <atomic>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -179,11 +181,68 @@ class MetadataStorage : public std::enable_shared_from_this<MetadataStorage> {
     std::shared_ptr<MetadataStorage> _md;
   };
 
+  /**
+   * While an instance of this class exists, the functions which only read the
+   * instances and replicasets tables are answered from an in-memory snapshot
+   * of these tables, instead of querying the server each time.
+   *
+   * Snapshot is loaded on first use and dropped whenever the metadata is
+   * modified through any MetadataStorage object. Snapshot loaded by a
+   * previous scope is reused if GTID_EXECUTED of the server did not change
+   * since it was loaded, so changes done by other clients are always seen
+   * once a new scope is started.
+   */
+  class Cache_scope {
+   public:
+    explicit Cache_scope(const std::shared_ptr<MetadataStorage> &md);
+    Cache_scope(const Cache_scope &) = delete;
+    Cache_scope &operator=(const Cache_scope &) = delete;
+    ~Cache_scope();
+
+   private:
+    std::shared_ptr<MetadataStorage> _md;
+  };
+
  private:
+  struct Snapshot {
+    struct Replicaset {
+      uint64_t cluster_id;
+      std::string topology_type;
+      bool active;
+    };
+
+    std::string gtid_executed;
+    uint64_t generation;
+
+    // in the order of instance_id
+    std::vector<Instance_definition> instances;
+    std::map<std::string, size_t> instance_by_address;
+    std::map<uint64_t, Replicaset> replicasets;
+
+    const Instance_definition *find_instance(const std::string &address) const;
+    const Replicaset *find_replicaset(uint64_t rs_id) const;
+  };
+
   std::shared_ptr<mysqlshdk::db::ISession> _session;
   std::shared_ptr<mysqlshdk::innodbcluster::Metadata_mysql> _metadata_mysql;
   int _tx_deep;
 
+  int m_cache_scopes = 0;
+  mutable bool m_snapshot_validated = false;
+  mutable std::unique_ptr<Snapshot> m_snapshot;
+
+  // incremented on every write to the metadata done by this process
+  static std::atomic<uint64_t> s_generation;
+
+  /**
+   * Provides the snapshot of the metadata if caching is enabled.
+   *
+   * @returns snapshot or nullptr if there's no active Cache_scope or
+   *          snapshot could not be loaded
+   */
+  const Snapshot *get_snapshot() const;
+  void invalidate_cache() const;
+
   virtual void start_transaction();
   virtual void commit();
   virtual void rollback();
@@ -448,7 +448,7 @@ int ProvisioningInterface::start_replicaset(
 
   {
     auto map = get_connection_map(instance);
-    if (map->has_key("password")) (*map)["passwd"] = (*map)["password"];
+    if (map->has_key("password")) map->set("passwd", map->at("password"));
     args.push_back(shcore::Value(map));
   }
 
@@ -514,12 +514,12 @@ int ProvisioningInterface::join_replicaset(
 
   {
     auto map = get_connection_map(instance);
-    if (map->has_key("password")) (*map)["passwd"] = (*map)["password"];
+    if (map->has_key("password")) map->set("passwd", map->at("password"));
     args.push_back(shcore::Value(map));
   }
   {
     auto map = get_connection_map(peer);
-    if (map->has_key("password")) (*map)["passwd"] = (*map)["password"];
+    if (map->has_key("password")) map->set("passwd", map->at("password"));
     args.push_back(shcore::Value(map));
   }
 
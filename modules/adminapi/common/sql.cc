@@ -27,6 +27,7 @@
 #include <string>
 #include <utility>
 #include <vector>
+#include "mysqlshdk/libs/mysql/gtid_set.h"
 #include "utils/utils_sqlstring.h"
 
 namespace mysqlsh {
@@ -146,27 +147,21 @@ SlaveReplicationState get_slave_replication_state(
   if (slave_executed.empty()) {
     ret_val = SlaveReplicationState::New;
   } else {
-    std::string query;
-    query =
-        shcore::sqlstring("select gtid_subset(?, @@global.gtid_executed)", 0)
-        << slave_executed;
-
-    auto result = connection->query(query);
+    auto result = connection->query(
+        "select @@global.gtid_executed, @@global.gtid_purged");
     auto row = result->fetch_one();
 
-    int slave_is_subset = row->get_int(0);
+    const auto slave_gtids =
+        mysqlshdk::mysql::Gtid_set::from_string(slave_executed);
+    const auto executed =
+        mysqlshdk::mysql::Gtid_set::from_string(row->get_string(0));
 
-    if (1 == slave_is_subset) {
+    if (slave_gtids.is_subset(executed)) {
       // If purged has more gtids than the executed on the slave
       // it means some data will not be recoverable
-      query =
-          shcore::sqlstring("select gtid_subtract(@@global.gtid_purged, ?)", 0)
-          << slave_executed;
-
-      result = connection->query(query);
-      row = result->fetch_one();
-
-      std::string missed = row->get_string(0);
+      const auto missed =
+          mysqlshdk::mysql::Gtid_set::from_string(row->get_string(1)) -
+          slave_gtids;
 
       if (missed.empty())
         ret_val = SlaveReplicationState::Recoverable;
@@ -486,25 +481,6 @@ bool get_status_variable(std::shared_ptr<mysqlshdk::db::ISession> connection,
   return ret_val;
 }
 
-bool is_gtid_subset(std::shared_ptr<mysqlshdk::db::ISession> connection,
-                    const std::string &subset, const std::string &set) {
-  int ret_val = 0;
-  std::string query = shcore::sqlstring("SELECT GTID_SUBSET(?, ?)", 0)
-                      << subset << set;
-
-  try {
-    auto result = connection->query(query);
-    auto row = result->fetch_one();
-
-    if (row) ret_val = row->get_int(0);
-  } catch (mysqlshdk::db::Error &error) {
-    throw shcore::Exception::mysql_error_with_code_and_state(
-        error.what(), error.code(), error.sqlstate());
-  }
-
-  return (ret_val == 1);
-}
-
 /*
  * Get the master status information of the server and return a Map with the
  * retrieved information:
@@ -65,8 +65,6 @@ void set_global_variable(std::shared_ptr<mysqlshdk::db::ISession> connection,
 bool get_status_variable(std::shared_ptr<mysqlshdk::db::ISession> connection,
                          const std::string &name, std::string *value,
                          bool throw_on_error = true);
-bool is_gtid_subset(std::shared_ptr<mysqlshdk::db::ISession> connection,
-                    const std::string &subset, const std::string &set);
 shcore::Value get_master_status(
     std::shared_ptr<mysqlshdk::db::ISession> connection);
 std::vector<std::string> get_peer_seeds(
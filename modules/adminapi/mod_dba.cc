@@ -23,6 +23,7 @@
 
 #include <mysqld_error.h>
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <random>
 #include <string>
@@ -38,6 +39,7 @@
 
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/group_replication_options.h"
+#include "modules/adminapi/common/instance_probe.h"
 #include "modules/adminapi/common/metadata_management_mysql.h"
 #include "modules/adminapi/common/metadata_storage.h"
 #include "modules/adminapi/common/sql.h"
@@ -61,6 +63,7 @@
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/innodbcluster/cluster.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
+#include "mysqlshdk/libs/mysql/gtid_set.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/mysql/replication.h"
 #include "mysqlshdk/libs/mysql/utils.h"
@@ -2322,6 +2325,7 @@ shcore::Value Dba::reboot_cluster_from_complete_outage(
   shcore::Value::Array_type_ref remove_instances_ref, rejoin_instances_ref;
   std::vector<std::string> remove_instances_list, rejoin_instances_list,
       instances_lists_intersection;
+  std::vector<Reboot_instance_state> instances_state;
 
   std::string cluster_name;
   try {
@@ -2503,17 +2507,17 @@ shcore::Value Dba::reboot_cluster_from_complete_outage(
                                                  "to the cluster: '" +
                                                  cluster->get_name() + "'.");
       }
-      // Get the all the instances and their status
-      std::vector<std::pair<std::string, std::string>> instances_status =
-          get_replicaset_instances_status(cluster, options);
+      // Get the all the instances and their status, instances are probed
+      // concurrently and the validations below use the results
+      instances_state = get_reboot_instances_state(cluster, options);
 
       std::vector<std::string> non_reachable_rejoin_instances,
           non_reachable_instances;
 
       // get all non reachable instances
-      for (auto &instance : instances_status) {
-        if (!(instance.second.empty())) {
-          non_reachable_instances.push_back(instance.first);
+      for (const auto &instance : instances_state) {
+        if (!instance.connect_error.empty()) {
+          non_reachable_instances.push_back(instance.address);
         }
       }
       // get all the list of non-reachable instances that were specified on the
@@ -2556,14 +2560,14 @@ shcore::Value Dba::reboot_cluster_from_complete_outage(
     // 4.1 None of the instances can belong to a GR Group
     // 4.2 If any of the instances belongs to a GR group or is already managed
     // by the InnoDB Cluster, so include that information on the error message
-    validate_instances_status_reboot_cluster(cluster, group_session, options);
+    validate_instances_status_reboot_cluster(group_session, instances_state);
 
     // 5. Verify which of the online instances has the GTID superset.
     // 5.1 Skip the verification on the list of instances to be removed:
     // "removeInstances" 5.2 If the current session instance doesn't have the
     // GTID superset, error out with that information and including on the
     // message the instance with the GTID superset
-    validate_instances_gtid_reboot_cluster(cluster, options, group_session);
+    validate_instances_gtid_reboot_cluster(group_session, instances_state);
 
     // 6. Set the current session instance as the seed instance of the Cluster
     {
@@ -2651,27 +2655,23 @@ Cluster_check_info Dba::check_preconditions(
   return Cluster_check_info{};
 }
 
+namespace {
+
 /*
- * get_replicaset_instances_status:
- *
- * Given a cluster, this function verifies the connectivity status of all the
- * instances of the default replicaSet of the cluster. It returns a list of
- * pairs <instance_id, status>, on which 'status' is empty if the instance is
- * reachable, or if not reachable contains the connection failure error message
+ * Connection options of all the instances of the default replicaset of the
+ * cluster, except for the one the group session is connected to. Credentials
+ * are taken from the group session, unless they're given in the options.
  */
-std::vector<std::pair<std::string, std::string>>
-Dba::get_replicaset_instances_status(
-    std::shared_ptr<Cluster> cluster,
-    const shcore::Value::Map_type_ref &options) {
-  std::vector<std::pair<std::string, std::string>> instances_status;
-  std::string instance_address, conn_status;
-
-  // TODO(alfredo) This should be in the Cluster object
+std::vector<mysqlshdk::db::Connection_options> get_other_instances(
+    const std::shared_ptr<Cluster> &cluster,
+    const shcore::Value::Map_type_ref &options,
+    std::vector<std::string> *addresses) {
+  std::vector<mysqlshdk::db::Connection_options> instances;
 
   log_info("Checking instance status for cluster '%s'",
            cluster->get_name().c_str());
 
-  std::vector<Instance_definition> instances =
+  std::vector<Instance_definition> metadata_instances =
       cluster->get_default_replicaset()->get_instances_from_metadata();
 
   auto current_session_options =
@@ -2689,62 +2689,36 @@ Dba::get_replicaset_instances_status(
     mysqlsh::set_password_from_map(&current_session_options, options);
   }
 
-  // Iterate on all instances from the metadata
-  for (const auto &it : instances) {
-    instance_address = it.endpoint;
-    conn_status.clear();
-
+  for (const auto &it : metadata_instances) {
     // Skip the current session instance
-    if (instance_address == active_session_md_address) {
-      continue;
-    }
+    if (it.endpoint == active_session_md_address) continue;
 
     auto connection_options =
-        shcore::get_connection_options(instance_address, false);
+        shcore::get_connection_options(it.endpoint, false);
 
     connection_options.set_user(current_session_options.get_user());
     connection_options.set_password(current_session_options.get_password());
 
-    try {
-      log_info(
-          "Opening a new session to the instance to determine its status: %s",
-          instance_address.c_str());
-      auto session = get_session(connection_options);
-      session->close();
-    } catch (std::exception &e) {
-      conn_status = e.what();
-      log_warning("Could not open connection to %s: %s.",
-                  instance_address.c_str(), e.what());
-    }
-
-    // Add the <instance, connection_status> pair to the list
-    instances_status.emplace_back(instance_address, conn_status);
+    instances.emplace_back(std::move(connection_options));
+    addresses->emplace_back(it.endpoint);
   }
 
-  return instances_status;
+  return instances;
 }
 
-static void validate_instance_belongs_to_cluster(
-    std::shared_ptr<mysqlshdk::db::ISession> member_session,
-    const std::string &gr_group_name, const std::string &restore_function) {
-  // TODO(alfredo) gr_group_name should receive the group_name as stored
-  // in the metadata to validate if it matches the expected value
-  // if the name does not match, an error should be thrown asking for an option
-  // like update_mismatched_group_name to be set to ignore the validation error
-  // and adopt the new group name
-
-  GRInstanceType type = get_gr_instance_type(member_session);
-
-  std::string member_session_address =
-      member_session->get_connection_options().as_uri(only_transport());
-
+/*
+ * Throws if the given instance belongs to an InnoDB cluster or to a GR group.
+ */
+void validate_instance_not_in_group(GRInstanceType type,
+                                    const std::function<bool()> &has_quorum,
+                                    const std::string &address,
+                                    const std::string &restore_function) {
   switch (type) {
     case GRInstanceType::InnoDBCluster: {
-      std::string err_msg = "The MySQL instance '" + member_session_address +
+      std::string err_msg = "The MySQL instance '" + address +
                             "' belongs to an InnoDB Cluster and is reachable.";
       // Check if quorum is lost to add additional instructions to users.
-      mysqlshdk::mysql::Instance target_instance(member_session);
-      if (!mysqlshdk::gr::has_quorum(target_instance, nullptr, nullptr)) {
+      if (!has_quorum()) {
         err_msg += " Please use <Cluster>." + restore_function +
                    "() to restore from the quorum loss.";
       }
@@ -2753,7 +2727,7 @@ static void validate_instance_belongs_to_cluster(
 
     case GRInstanceType::GroupReplication:
       throw shcore::Exception::runtime_error(
-          "The MySQL instance '" + member_session_address +
+          "The MySQL instance '" + address +
           "' belongs "
           "GR group that is not managed as an "
           "InnoDB cluster. ");
@@ -2767,6 +2741,83 @@ static void validate_instance_belongs_to_cluster(
   }
 }
 
+}  // namespace
+
+/*
+ * get_replicaset_instances_status:
+ *
+ * Given a cluster, this function verifies the connectivity status of all the
+ * instances of the default replicaSet of the cluster. It returns a list of
+ * pairs <instance_id, status>, on which 'status' is empty if the instance is
+ * reachable, or if not reachable contains the connection failure error message
+ */
+std::vector<std::pair<std::string, std::string>>
+Dba::get_replicaset_instances_status(
+    std::shared_ptr<Cluster> cluster,
+    const shcore::Value::Map_type_ref &options) {
+  std::vector<std::pair<std::string, std::string>> instances_status;
+  std::vector<std::string> addresses;
+
+  // Instances are checked concurrently
+  const auto probes =
+      probe_instances(get_other_instances(cluster, options, &addresses));
+
+  for (std::size_t i = 0; i < probes.size(); ++i) {
+    instances_status.emplace_back(addresses[i], probes[i].connect_error);
+  }
+
+  return instances_status;
+}
+
+/*
+ * get_reboot_instances_state:
+ *
+ * This function is an auxiliary function to be used for the reboot_cluster
+ * operation. It connects to all the instances of the cluster (except for the
+ * one the current session is connected to) concurrently and reads everything
+ * which is needed by the reboot validations: the connectivity status, the GR
+ * state and the GTID_EXECUTED. Validations are done once all the results are
+ * in, so the time it takes does not grow with the number of instances.
+ */
+std::vector<Dba::Reboot_instance_state> Dba::get_reboot_instances_state(
+    std::shared_ptr<Cluster> cluster,
+    const shcore::Value::Map_type_ref &options) {
+  std::vector<std::string> addresses;
+  const auto instances = get_other_instances(cluster, options, &addresses);
+  std::vector<Reboot_instance_state> states(instances.size());
+
+  const auto probes = probe_instances(
+      instances,
+      [&states](std::size_t index,
+                const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+        auto &state = states[index];
+        state.type = get_gr_instance_type(session);
+
+        if (GRInstanceType::InnoDBCluster == state.type) {
+          mysqlshdk::mysql::Instance instance(session);
+          state.has_quorum =
+              mysqlshdk::gr::has_quorum(instance, nullptr, nullptr);
+        }
+
+        get_server_variable(session, "GLOBAL.GTID_EXECUTED",
+                            &state.gtid_executed);
+      });
+
+  for (std::size_t i = 0; i < probes.size(); ++i) {
+    auto &state = states[i];
+    state.address = addresses[i];
+    state.connect_error = probes[i].connect_error;
+    state.error = probes[i].error;
+
+    if (state.connect_error.empty() && !state.error) {
+      log_info("The instance: '%s' GLOBAL.GTID_EXECUTED is: %s",
+               state.address.c_str(), state.gtid_executed.c_str());
+    }
+  }
+
+  return states;
+}
+
 /*
  * validate_instances_status_reboot_cluster:
  *
@@ -2775,67 +2826,37 @@ static void validate_instance_belongs_to_cluster(
  * referent to the arguments list. Firstly, it verifies the status of the
  * current session instance to determine if it belongs to a GR group or is
  * already managed by the InnoDB Cluster.cluster_name If not, does the same
- * validation for the remaining reachable instances of the cluster.
+ * validation for the remaining reachable instances of the cluster, using
+ * the state read by get_reboot_instances_state().
  */
 void Dba::validate_instances_status_reboot_cluster(
-    std::shared_ptr<Cluster> cluster,
     std::shared_ptr<mysqlshdk::db::ISession> member_session,
-    shcore::Value::Map_type_ref options) {
-  // Validate the member we're connected to
-  validate_instance_belongs_to_cluster(
-      member_session, "",
-      get_member_name("forceQuorumUsingPartitionOf", naming_style));
-
-  mysqlshdk::db::Connection_options member_connection_options =
-      member_session->get_connection_options();
-
-  // Get the current session instance address
-  if (options) {
-    mysqlsh::set_user_from_map(&member_connection_options, options);
-    mysqlsh::set_password_from_map(&member_connection_options, options);
+    const std::vector<Reboot_instance_state> &instances) {
+  const auto restore_function =
+      get_member_name("forceQuorumUsingPartitionOf", naming_style);
 
-    shcore::Argument_map opt_map(*options);
-
-    // Case sensitive validation of the rest of the options, at this point the
-    // user and password should have been already removed
-    opt_map.ensure_keys({}, mysqlsh::dba::Dba::_reboot_cluster_opts,
-                        "the options");
-  }
+  // Validate the member we're connected to
+  validate_instance_not_in_group(
+      get_gr_instance_type(member_session),
+      [&member_session]() {
+        mysqlshdk::mysql::Instance target_instance(member_session);
+        return mysqlshdk::gr::has_quorum(target_instance, nullptr, nullptr);
+      },
+      member_session->get_connection_options().as_uri(only_transport()),
+      restore_function);
 
   // Verify all the remaining online instances for their status
-  std::vector<std::pair<std::string, std::string>> instances_status =
-      get_replicaset_instances_status(cluster, options);
-
-  for (const auto &value : instances_status) {
-    std::string instance_address = value.first;
-    std::string instance_status = value.second;
-
+  for (const auto &instance : instances) {
     // if the status is not empty it means the connection failed
     // so we skip this instance
-    if (!instance_status.empty()) {
-      continue;
-    }
+    if (!instance.connect_error.empty()) continue;
 
-    mysqlshdk::db::Connection_options connection_options =
-        shcore::get_connection_options(instance_address, false);
-    connection_options.set_user(member_connection_options.get_user());
-    connection_options.set_password(member_connection_options.get_password());
+    if (instance.error) std::rethrow_exception(instance.error);
 
-    std::shared_ptr<mysqlshdk::db::ISession> session;
-    try {
-      log_info("Opening a new session to the instance: %s",
-               instance_address.c_str());
-      session = get_session(connection_options);
-    } catch (std::exception &e) {
-      throw shcore::Exception::runtime_error("Could not open connection to " +
-                                             instance_address + "");
-    }
-
-    log_info("Checking state of instance '%s'", instance_address.c_str());
-    validate_instance_belongs_to_cluster(
-        session, "",
-        get_member_name("forceQuorumUsingPartitionOf", naming_style));
-    session->close();
+    log_info("Checking state of instance '%s'", instance.address.c_str());
+    validate_instance_not_in_group(
+        instance.type, [&instance]() { return instance.has_quorum; },
+        instance.address, restore_function);
   }
 }
 
@@ -2849,9 +2870,8 @@ void Dba::validate_instances_status_reboot_cluster(
  * message the instance with the GTID superset
  */
 void Dba::validate_instances_gtid_reboot_cluster(
-    std::shared_ptr<Cluster> cluster,
-    const shcore::Value::Map_type_ref &options,
-    const std::shared_ptr<mysqlshdk::db::ISession> &instance_session) {
+    const std::shared_ptr<mysqlshdk::db::ISession> &instance_session,
+    const std::vector<Reboot_instance_state> &instances) {
   /* GTID verification is done by verifying which instance has the GTID
    * superset.the In order to do so, a union of the global gtid executed and the
    * received transaction set must be done using:
@@ -2869,27 +2889,12 @@ void Dba::validate_instances_gtid_reboot_cluster(
    *
    * Total = A + B (union)
    *
-   * SELECT GTID_SUBSET("Total_instance1", "Total_instance2")
+   * GTID_SUBSET("Total_instance1", "Total_instance2"), evaluated locally
    */
 
-  std::pair<std::string, std::string> most_updated_instance;
-  std::shared_ptr<mysqlshdk::db::ISession> session;
-  std::string active_session_address;
-
-  // get the current session information
-  auto current_session_options = instance_session->get_connection_options();
-
   // Get the current session instance address
-  active_session_address = current_session_options.as_uri(only_transport());
-
-  if (options) {
-    mysqlsh::set_user_from_map(&current_session_options, options);
-    mysqlsh::set_password_from_map(&current_session_options, options);
-  }
-
-  // Get the cluster instances and their status
-  std::vector<std::pair<std::string, std::string>> instances_status =
-      get_replicaset_instances_status(cluster, options);
+  const std::string active_session_address =
+      instance_session->get_connection_options().as_uri(only_transport());
 
   // Get @@GLOBAL.GTID_EXECUTED
   std::string gtid_executed_current;
@@ -2900,73 +2905,37 @@ void Dba::validate_instances_gtid_reboot_cluster(
                     gtid_executed_current;
   log_info("%s", msg.c_str());
 
-  // Create a pair vector to store all the GTID_EXECUTED
-  std::vector<std::pair<std::string, std::string>> gtids;
-
-  // Insert the current session info
-  gtids.emplace_back(active_session_address, gtid_executed_current);
-
-  // Update most_updated_instance with the current session instance value
-  most_updated_instance =
-      std::make_pair(active_session_address, gtid_executed_current);
-
-  for (const auto &value : instances_status) {
-    std::string instance_address = value.first;
-    std::string instance_status = value.second;
+  // Start with the current session instance
+  std::string most_updated_instance = active_session_address;
+  auto most_updated_gtids =
+      mysqlshdk::mysql::Gtid_set::from_string(gtid_executed_current);
 
+  // Calculate the most up-to-date instance
+  // TODO(miguel): calculate the Total GTID executed. See comment above
+  for (const auto &instance : instances) {
     // if the status is not empty it means the connection failed
     // so we skip this instance
-    if (!instance_status.empty()) continue;
+    if (!instance.connect_error.empty()) continue;
 
-    auto connection_options =
-        shcore::get_connection_options(instance_address, false);
-    connection_options.set_user(current_session_options.get_user());
-    connection_options.set_password(current_session_options.get_password());
-
-    // Connect to the instance to obtain the GLOBAL.GTID_EXECUTED
-    try {
-      log_info("Opening a new session to the instance for gtid validations %s",
-               instance_address.c_str());
-      session = get_session(connection_options);
-    } catch (std::exception &e) {
-      throw shcore::Exception::runtime_error("Could not open a connection to " +
-                                             instance_address + ": " +
-                                             e.what() + ".");
-    }
+    if (instance.error) std::rethrow_exception(instance.error);
 
-    std::string gtid_executed;
-
-    // Get @@GLOBAL.GTID_EXECUTED
-    get_server_variable(session, "GLOBAL.GTID_EXECUTED", &gtid_executed);
-
-    // Close the session
-    session->close();
+    auto instance_gtids =
+        mysqlshdk::mysql::Gtid_set::from_string(instance.gtid_executed);
 
-    std::string msg = "The instance: '" + instance_address +
-                      "' GLOBAL.GTID_EXECUTED is: " + gtid_executed;
-    log_info("%s", msg.c_str());
-
-    // Add to the pair vector of gtids
-    gtids.emplace_back(instance_address, gtid_executed);
-  }
-
-  // Calculate the most up-to-date instance
-  // TODO(miguel): calculate the Total GTID executed. See comment above
-  for (auto &value : gtids) {
-    // Compare the gtid's: SELECT GTID_SUBSET("Total_instance1",
-    // "Total_instance2")
-    if (!is_gtid_subset(instance_session, value.second,
-                        most_updated_instance.second))
-      most_updated_instance = value;
+    // Compare the gtid's: GTID_SUBSET("Total_instance1", "Total_instance2")
+    if (!instance_gtids.is_subset(most_updated_gtids)) {
+      most_updated_instance = instance.address;
+      most_updated_gtids = std::move(instance_gtids);
+    }
   }
 
   // Check if the most updated instance is not the current session instance
-  if (!(most_updated_instance.first == active_session_address)) {
+  if (!(most_updated_instance == active_session_address)) {
     throw shcore::Exception::runtime_error(
         "The active session instance isn't the most updated "
         "in comparison with the ONLINE instances of the Cluster's "
         "metadata. Please use the most up to date instance: '" +
-        most_updated_instance.first + "'.");
+        most_updated_instance + "'.");
   }
 }
 
@@ -24,6 +24,7 @@
 #ifndef MODULES_ADMINAPI_MOD_DBA_H_
 #define MODULES_ADMINAPI_MOD_DBA_H_
 
+#include <exception>
 #include <map>
 #include <memory>
 #include <set>
@@ -145,18 +146,36 @@ class SHCORE_PUBLIC Dba : public shcore::Cpp_object_bridge,
   shcore::Value reboot_cluster_from_complete_outage(
       const shcore::Argument_list &args);
 
+  /**
+   * State of an instance of the cluster, read before the cluster is rebooted.
+   */
+  struct Reboot_instance_state {
+    /// Address of the instance, as stored in the metadata.
+    std::string address;
+    /// Error which prevented the connection, empty if instance is reachable.
+    std::string connect_error;
+    GRInstanceType type = GRInstanceType::Unknown;
+    /// Only checked if instance belongs to an InnoDB cluster.
+    bool has_quorum = false;
+    std::string gtid_executed;
+    /// Error which occurred while the state was being read.
+    std::exception_ptr error;
+  };
+
   virtual std::vector<std::pair<std::string, std::string>>
   get_replicaset_instances_status(std::shared_ptr<Cluster> cluster,
                                   const shcore::Value::Map_type_ref &options);
 
-  virtual void validate_instances_status_reboot_cluster(
+  virtual std::vector<Reboot_instance_state> get_reboot_instances_state(
       std::shared_ptr<Cluster> cluster,
+      const shcore::Value::Map_type_ref &options);
+
+  virtual void validate_instances_status_reboot_cluster(
       std::shared_ptr<mysqlshdk::db::ISession> member_session,
-      shcore::Value::Map_type_ref options);
+      const std::vector<Reboot_instance_state> &instances);
   virtual void validate_instances_gtid_reboot_cluster(
-      std::shared_ptr<Cluster> cluster,
-      const shcore::Value::Map_type_ref &options,
-      const std::shared_ptr<mysqlshdk::db::ISession> &instance_session);
+      const std::shared_ptr<mysqlshdk::db::ISession> &instance_session,
+      const std::vector<Reboot_instance_state> &instances);
   std::shared_ptr<ProvisioningInterface> get_provisioning_interface() {
     return _provisioning_interface;
   }
@@ -179,6 +179,13 @@ shcore::Value Cluster::call(const std::string &name,
                             const shcore::Argument_list &args) {
   // Throw an error if the cluster has already been dissolved
   assert_valid(name);
+
+  if (name == "disconnect" || !_metadata_storage)
+    return Cpp_object_bridge::call(name, args);
+
+  // metadata is read many times by a single operation, cache it until the
+  // call is finished
+  MetadataStorage::Cache_scope cache(_metadata_storage);
   return Cpp_object_bridge::call(name, args);
 }
 
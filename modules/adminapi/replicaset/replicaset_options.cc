@@ -23,6 +23,7 @@
 
 #include "modules/adminapi/replicaset/replicaset_options.h"
 #include "modules/adminapi/common/common.h"
+#include "mysqlshdk/libs/db/mysql/session_pool.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
 
 namespace mysqlsh {
@@ -69,7 +70,7 @@ void Replicaset_options::connect_to_members() {
 
       try {
         m_member_sessions[inst.classic_endpoint] =
-            mysqlshdk::db::mysql::open_session(opts);
+            mysqlshdk::db::mysql::open_pooled_session(opts);
       } catch (mysqlshdk::db::Error &e) {
         m_member_connect_errors[inst.classic_endpoint] = e.format();
       }
@@ -21,12 +21,19 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <exception>
+#include <functional>
+#include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/metadata_storage.h"
 #include "modules/adminapi/common/sql.h"
 #include "modules/adminapi/replicaset/replicaset_status.h"
+#include "mysqlshdk/libs/db/mysql/async_query_loop.h"
+#include "mysqlshdk/libs/db/mysql/session_pool.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
 
 namespace mysqlsh {
@@ -141,7 +148,7 @@ void Replicaset_status::connect_to_members() {
 
       try {
         m_member_sessions[inst.classic_endpoint] =
-            mysqlshdk::db::mysql::open_session(opts);
+            mysqlshdk::db::mysql::open_pooled_session(opts);
       } catch (mysqlshdk::db::Error &e) {
         m_member_connect_errors[inst.classic_endpoint] = e.format();
       }
@@ -387,25 +394,17 @@ shcore::Value Replicaset_status::applier_status(
   return shcore::Value(dict);
 }
 
-void Replicaset_status::collect_local_status(
-    shcore::Dictionary_t dict, const mysqlshdk::mysql::Instance &instance,
-    bool recovering) {
+std::vector<std::string> Replicaset_status::local_status_queries(
+    const mysqlshdk::utils::Version &version) {
   using mysqlshdk::utils::Version;
 
-  auto session = instance.get_session();
-  auto version = instance.get_version();
-
-  shcore::Dictionary_t recovery_node = shcore::make_dict();
-  shcore::Dictionary_t applier_node = shcore::make_dict();
-  shcore::Array_t recovery_workers = shcore::make_array();
-  shcore::Array_t applier_workers = shcore::make_array();
-
 #define TSDIFF(prefix, start, end) \
   "TIMESTAMPDIFF(MICROSECOND, " prefix "_" start ", " prefix "_" end ")"
 
 #define TSDIFF_NOW(prefix, start) \
   "TIMESTAMPDIFF(MICROSECOND, " prefix "_" start ", NOW(6))"
 
+  std::vector<std::string> queries;
   std::string sql;
 
   sql = "SELECT *";
@@ -429,23 +428,7 @@ void Replicaset_status::collect_local_status(
     sql += " AS CURRENT_IMMEDIATE_COMMIT_TO_NOW_TIME";
   }
   sql += " FROM performance_schema.replication_applier_status_by_worker";
-
-  // this can return multiple rows per channel for
-  // multi-threaded applier, otherwise just one. If MT, we also
-  // get stuff in the coordinator table
-  auto result = session->query(sql);
-  auto row = result->fetch_one_named();
-  while (row) {
-    std::string channel_name = row.get_string("CHANNEL_NAME");
-    if (channel_name == "group_replication_recovery") {
-      recovery_workers->push_back(applier_status(row));
-    }
-    if (channel_name == "group_replication_applier" &&
-        row.get_string("SERVICE_STATE") != "OFF") {
-      applier_workers->push_back(applier_status(row));
-    }
-    row = result->fetch_one_named();
-  }
+  queries.emplace_back(std::move(sql));
 
   sql = "SELECT *";
   if (version >= Version(8, 0, 0)) {
@@ -466,19 +449,7 @@ void Replicaset_status::collect_local_status(
     sql += " AS CURRENT_IMMEDIATE_COMMIT_TO_NOW_TIME";
   }
   sql += " FROM performance_schema.replication_applier_status_by_coordinator";
-  result = session->query(sql);
-  row = result->fetch_one_named();
-  while (row) {
-    std::string channel_name = row.get_string("CHANNEL_NAME");
-    if (channel_name == "group_replication_recovery") {
-      (*recovery_node)["coordinator"] = coordinator_status(row);
-    }
-    if (channel_name == "group_replication_applier" &&
-        row.get_string("SERVICE_STATE") != "OFF") {
-      (*applier_node)["coordinator"] = coordinator_status(row);
-    }
-    row = result->fetch_one_named();
-  }
+  queries.emplace_back(std::move(sql));
 
   sql = "SELECT *";
   if (version >= Version(8, 0, 0)) {
@@ -499,7 +470,109 @@ void Replicaset_status::collect_local_status(
     sql += " AS CURRENT_IMMEDIATE_COMMIT_TO_NOW_TIME";
   }
   sql += " FROM performance_schema.replication_connection_status";
-  result = session->query(sql);
+  queries.emplace_back(std::move(sql));
+
+  return queries;
+}
+
+Local_status_map Replicaset_status::query_local_status() {
+  Local_status_map status;
+  mysqlshdk::db::mysql::Async_query_loop loop;
+  std::exception_ptr error;
+  std::map<std::string, std::vector<std::string>> queries;
+  std::function<void(const std::string &, size_t)> add_query;
+
+  // the next query of a member is added once the previous one completes
+  add_query = [&](const std::string &endpoint, size_t index) {
+    const auto session =
+        std::static_pointer_cast<mysqlshdk::db::mysql::Session>(
+            m_member_sessions[endpoint]);
+
+    loop.add(session, queries[endpoint][index],
+             [&, endpoint, index](
+                 std::shared_ptr<mysqlshdk::db::IResult> result,
+                 std::exception_ptr e) {
+               if (e) {
+                 if (!error) error = e;
+                 return;
+               }
+
+               status[endpoint].emplace_back(std::move(result));
+
+               if (index + 1 < queries[endpoint].size())
+                 add_query(endpoint, index + 1);
+             });
+  };
+
+  for (const auto &member : m_member_sessions) {
+    const auto &session = member.second;
+
+    if (!session) continue;
+
+    queries[member.first] = local_status_queries(
+        mysqlshdk::mysql::Instance(session).get_version());
+
+    if (std::dynamic_pointer_cast<mysqlshdk::db::mysql::Session>(session)) {
+      // members execute their queries concurrently
+      add_query(member.first, 0);
+    } else {
+      for (const auto &sql : queries[member.first]) {
+        status[member.first].emplace_back(session->query(sql, true));
+      }
+    }
+  }
+
+  loop.run();
+
+  if (error) std::rethrow_exception(error);
+
+  return status;
+}
+
+void Replicaset_status::collect_local_status(
+    shcore::Dictionary_t dict, const mysqlshdk::mysql::Instance &instance,
+    const Local_status &results, bool recovering) {
+  using mysqlshdk::utils::Version;
+
+  auto version = instance.get_version();
+
+  shcore::Dictionary_t recovery_node = shcore::make_dict();
+  shcore::Dictionary_t applier_node = shcore::make_dict();
+  shcore::Array_t recovery_workers = shcore::make_array();
+  shcore::Array_t applier_workers = shcore::make_array();
+
+  // this can return multiple rows per channel for
+  // multi-threaded applier, otherwise just one. If MT, we also
+  // get stuff in the coordinator table
+  auto result = results[0];
+  auto row = result->fetch_one_named();
+  while (row) {
+    std::string channel_name = row.get_string("CHANNEL_NAME");
+    if (channel_name == "group_replication_recovery") {
+      recovery_workers->push_back(applier_status(row));
+    }
+    if (channel_name == "group_replication_applier" &&
+        row.get_string("SERVICE_STATE") != "OFF") {
+      applier_workers->push_back(applier_status(row));
+    }
+    row = result->fetch_one_named();
+  }
+
+  result = results[1];
+  row = result->fetch_one_named();
+  while (row) {
+    std::string channel_name = row.get_string("CHANNEL_NAME");
+    if (channel_name == "group_replication_recovery") {
+      (*recovery_node)["coordinator"] = coordinator_status(row);
+    }
+    if (channel_name == "group_replication_applier" &&
+        row.get_string("SERVICE_STATE") != "OFF") {
+      (*applier_node)["coordinator"] = coordinator_status(row);
+    }
+    row = result->fetch_one_named();
+  }
+
+  result = results[2];
   row = result->fetch_one_named();
   while (row) {
     std::string channel_name = row.get_string("CHANNEL_NAME");
@@ -575,8 +648,14 @@ shcore::Dictionary_t Replicaset_status::get_topology(
     const std::vector<mysqlshdk::gr::Member> &member_info,
     const mysqlshdk::mysql::Instance *primary_instance) {
   Member_stats_map member_stats = query_member_stats();
+  Local_status_map local_status;
+
+  if (!m_query_members.is_null() && *m_query_members) {
+    local_status = query_local_status();
+  }
 
   shcore::Dictionary_t dict = shcore::make_dict();
+  dict->reserve(m_instances.size());
 
   auto get_member = [&member_info](const std::string &uuid) {
     for (const auto &m : member_info) {
@@ -595,7 +674,7 @@ shcore::Dictionary_t Replicaset_status::get_topology(
 
       if (instance.get_session()) {
         collect_local_status(
-            member, instance,
+            member, instance, local_status[inst.classic_endpoint],
             minfo.state == mysqlshdk::gr::Member_state::RECOVERING);
         (*member)["autoRejoinRunning"] =
             shcore::Value(mysqlshdk::gr::is_running_gr_auto_rejoin(instance));
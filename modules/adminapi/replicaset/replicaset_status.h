@@ -25,6 +25,7 @@
 #define MODULES_ADMINAPI_REPLICASET_REPLICASET_STATUS_H_
 
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -40,6 +41,11 @@ typedef std::map<std::string, std::pair<mysqlshdk::db::Row_by_name,
                                         mysqlshdk::db::Row_by_name>>
     Member_stats_map;
 
+// results of Replicaset_status::local_status_queries()
+typedef std::vector<std::shared_ptr<mysqlshdk::db::IResult>> Local_status;
+
+typedef std::map<std::string, Local_status> Local_status_map;
+
 class Replicaset_status : public Command_interface {
  public:
   Replicaset_status(const ReplicaSet &replicaset,
@@ -124,9 +130,19 @@ class Replicaset_status : public Command_interface {
 
   shcore::Value applier_status(const mysqlshdk::db::Row_ref_by_name &row);
 
+  static std::vector<std::string> local_status_queries(
+      const mysqlshdk::utils::Version &version);
+
+  /**
+   * Executes local_status_queries() on all the members at once.
+   *
+   * @return results of the queries, by the endpoint of a member
+   */
+  Local_status_map query_local_status();
+
   void collect_local_status(shcore::Dictionary_t dict,
                             const mysqlshdk::mysql::Instance &instance,
-                            bool recovering);
+                            const Local_status &results, bool recovering);
 
   void feed_metadata_info(shcore::Dictionary_t dict,
                           const ReplicaSet::Instance_info &info);
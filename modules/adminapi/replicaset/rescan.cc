@@ -32,6 +32,7 @@
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/config/config.h"
 #include "mysqlshdk/libs/config/config_server_handler.h"
+#include "mysqlshdk/libs/db/mysql/session_pool.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 
 namespace mysqlsh {
@@ -117,13 +118,12 @@ void Rescan::ensure_unavailable_instances_not_auto_rejoining(
     instance_conn_opt.set_login_options_from(group_conn_opt);
     instance_conn_opt.set_ssl_connection_options_from(
         group_conn_opt.get_ssl_options());
-    auto session = mysqlshdk::db::mysql::Session::create();
     bool is_rejoining = false;
     try {
-      session->connect(instance_conn_opt);
+      auto session =
+          mysqlshdk::db::mysql::open_pooled_session(instance_conn_opt);
       is_rejoining = mysqlshdk::gr::is_running_gr_auto_rejoin(
           mysqlshdk::mysql::Instance(session));
-      session->close();
     } catch (const std::exception &e) {
       // if you cant connect to the instance then we assume it really is offline
       // or unreachable and it is not auto-rejoining
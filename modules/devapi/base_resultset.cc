@@ -28,7 +28,9 @@
 #include <string>
 
 #include "modules/mod_utils.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/include/shellcore/utils_help.h"
+#include "mysqlshdk/libs/db/prefetching_result.h"
 #include "scripting/common.h"
 #include "scripting/lang_base.h"
 #include "scripting/obj_date.h"
@@ -46,6 +48,17 @@ bool ShellBaseResult::operator==(const Object_bridge &other) const {
   return this == &other;
 }
 
+std::unique_ptr<mysqlshdk::db::IResult> ShellBaseResult::prefetch(
+    const std::shared_ptr<mysqlshdk::db::IResult> &result) {
+  const auto rows = current_shell_options()->get().result_prefetch_rows;
+
+  if (rows > 0 && result && result->has_resultset())
+    return std::unique_ptr<mysqlshdk::db::IResult>(
+        new mysqlshdk::db::Prefetching_result(result, rows));
+
+  return nullptr;
+}
+
 Column::Column(const mysqlshdk::db::Column &meta, shcore::Value type)
     : _c(meta), _type(type) {
   add_property("schemaName", "getSchemaName");
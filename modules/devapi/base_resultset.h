@@ -47,6 +47,15 @@ class ShellBaseResult : public shcore::Cpp_object_bridge {
   bool is_result() const { return class_name() == "Result"; }
   bool is_doc_result() const { return class_name() == "DocResult"; }
   bool is_row_result() const { return class_name() == "RowResult"; }
+
+ protected:
+  /**
+   * Returns a result which reads the rows of the given one ahead in a
+   * background thread, if this is enabled with the resultPrefetchRows option
+   * and there are rows to read, nullptr otherwise.
+   */
+  static std::unique_ptr<mysqlshdk::db::IResult> prefetch(
+      const std::shared_ptr<mysqlshdk::db::IResult> &result);
 };
 
 /**
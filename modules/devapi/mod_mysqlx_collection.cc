@@ -866,7 +866,7 @@ shcore::Value Collection::create_index_(const shcore::Argument_list &args) {
 
       // Moves "fields" to "constraint"
       if (index->has_key("fields")) {
-        std::swap((*index)["constraint"], (*index)["fields"]);
+        index->set("constraint", index->at("fields"));
         index->erase("fields");
 
         if ((*index)["constraint"].type == shcore::Array) {
@@ -875,7 +875,7 @@ shcore::Value Collection::create_index_(const shcore::Argument_list &args) {
               auto field = field_val.as_map();
               if (field->has_key("field")) {
                 // Moves "field" to "member"
-                std::swap((*field)["member"], (*field)["field"]);
+                field->set("member", field->at("field"));
                 field->erase("field");
 
                 // The options and srid values must be converted to UINT
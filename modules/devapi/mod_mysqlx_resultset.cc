@@ -56,6 +56,8 @@ BaseResult::BaseResult(std::shared_ptr<mysqlshdk::db::mysqlx::Result> result)
   add_property("warningCount", "getWarningCount");
   add_property("warningsCount", "getWarningsCount");
   add_property("warnings", "getWarnings");
+
+  m_prefetch = prefetch(_result);
 }
 
 BaseResult::~BaseResult() {}
@@ -115,7 +117,7 @@ shcore::Value BaseResult::get_member(const std::string &prop) const {
         new shcore::Value::Array_type);
     if (_result) {
       while (std::unique_ptr<mysqlshdk::db::Warning> warning =
-                 _result->fetch_one_warning()) {
+                 result()->fetch_one_warning()) {
         mysqlsh::Row *warning_row = new mysqlsh::Row();
         switch (warning->level) {
           case mysqlshdk::db::Warning::Level::Note:
@@ -171,7 +173,7 @@ int BaseResult::get_affected_items_count() {}
 
 int64_t BaseResult::get_affected_items_count() const {
   if (!_result) return -1;
-  return _result->get_affected_row_count();
+  return result()->get_affected_row_count();
 }
 
 // Documentation of getExecutionTime function
@@ -283,7 +285,7 @@ int BaseResult::get_warnings_count() {}
 #endif
 
 uint64_t BaseResult::get_warnings_count() const {
-  if (_result) return _result->get_warning_count();
+  if (_result) return result()->get_warning_count();
   return 0;
 }
 
@@ -437,7 +439,7 @@ int Result::get_auto_increment_value() {}
 #endif
 
 int64_t Result::get_auto_increment_value() const {
-  if (_result) return _result->get_auto_increment_value();
+  if (_result) return result()->get_auto_increment_value();
   return 0;
 }
 
@@ -537,7 +539,7 @@ shcore::Value DocResult::fetch_one(const shcore::Argument_list &args) const {
 
   try {
     if (_result) {
-      if (const mysqlshdk::db::IRow *r = _result->fetch_one()) {
+      if (const mysqlshdk::db::IRow *r = result()->fetch_one()) {
         ret_val = Value::parse(r->get_string(0));
       }
     }
@@ -832,7 +834,7 @@ shcore::Value RowResult::fetch_one(const shcore::Argument_list &args) const {
 
   try {
     if (_result) {
-      const mysqlshdk::db::IRow *row = _result->fetch_one();
+      const mysqlshdk::db::IRow *row = result()->fetch_one();
       if (row) {
         ret_val = shcore::Value::wrap(new mysqlsh::Row(_column_names, *row));
       }
@@ -925,7 +927,7 @@ Integer SqlResult::getAutoIncrementValue() {}
 int SqlResult::get_auto_increment_value() {}
 #endif
 int64_t SqlResult::get_auto_increment_value() const {
-  if (_result) return _result->get_auto_increment_value();
+  if (_result) return result()->get_auto_increment_value();
   return 0;
 }
 
@@ -967,7 +969,7 @@ Integer SqlResult::getAffectedRowCount() {}
 int SqlResult::get_affected_row_count() {}
 #endif
 int64_t SqlResult::get_affected_row_count() const {
-  if (_result) return _result->get_affected_row_count();
+  if (_result) return result()->get_affected_row_count();
   return 0;
 }
 
@@ -1004,7 +1006,7 @@ bool SqlResult::has_data() {}
 shcore::Value SqlResult::has_data(const shcore::Argument_list &args) const {
   args.ensure_count(0, get_function_name("hasData").c_str());
 
-  return Value(_result && _result->has_resultset());
+  return Value(_result && result()->has_resultset());
 }
 
 // Documentation of nextDataSet function
@@ -1050,7 +1052,7 @@ shcore::Value SqlResult::next_data_set(const shcore::Argument_list &args) {
               get_function_name("nextDataSet").c_str(),
               get_function_name("nextResult").c_str());
 
-  return shcore::Value(_result->next_resultset());
+  return shcore::Value(result()->next_resultset());
 }
 
 // Documentation of nextDataSet function
@@ -1075,7 +1077,7 @@ bool SqlResult::next_result() {}
 shcore::Value SqlResult::next_result(const shcore::Argument_list &args) {
   args.ensure_count(0, get_function_name("nextResult").c_str());
 
-  return shcore::Value(_result->next_resultset());
+  return shcore::Value(result()->next_resultset());
 }
 
 void SqlResult::append_json(shcore::JSON_dumper &dumper) const {
@@ -93,10 +93,16 @@ class SHCORE_PUBLIC BaseResult : public mysqlsh::ShellBaseResult {
   str get_execution_time();
 #endif
 
-  virtual mysqlshdk::db::IResult *get_result() { return _result.get(); };
+  virtual mysqlshdk::db::IResult *get_result() { return result(); };
 
  protected:
+  mysqlshdk::db::IResult *result() const {
+    return m_prefetch ? m_prefetch.get() : _result.get();
+  }
+
   std::shared_ptr<mysqlshdk::db::mysqlx::Result> _result;
+  // reads rows of _result ahead, if enabled
+  std::unique_ptr<mysqlshdk::db::IResult> m_prefetch;
 };
 
 /**
@@ -170,6 +176,12 @@ class SHCORE_PUBLIC DocResult : public BaseResult {
   virtual std::string class_name() const { return "DocResult"; }
   virtual void append_json(shcore::JSON_dumper &dumper) const;
 
+  // documents are returned when iterating from the scripting languages
+  virtual bool is_iterable() const { return true; }
+  virtual shcore::Value next_item() {
+    return fetch_one(shcore::Argument_list());
+  }
+
   shcore::Value get_metadata() const;
 
 #if DOXYGEN_JS
@@ -200,6 +212,12 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
   virtual std::string class_name() const { return "RowResult"; }
   virtual void append_json(shcore::JSON_dumper &dumper) const;
 
+  // rows are returned when iterating from the scripting languages
+  virtual bool is_iterable() const { return true; }
+  virtual shcore::Value next_item() {
+    return fetch_one(shcore::Argument_list());
+  }
+
   // C++ Interface
   int64_t get_column_count() const;
   std::vector<std::string> get_column_names() const;
@@ -98,6 +98,12 @@ class SHCORE_PUBLIC Interactive_object_wrapper : public Cpp_object_bridge {
     _target ? _target->set_member(index, value)
             : Cpp_object_bridge::set_member(index, value);
   }
+  virtual bool is_iterable() const {
+    return _target ? _target->is_iterable() : Cpp_object_bridge::is_iterable();
+  }
+  virtual Value next_item() {
+    return _target ? _target->next_item() : Cpp_object_bridge::next_item();
+  }
   virtual bool has_method(const std::string &name) const {
     return _target ? _target->has_method(name)
                    : Cpp_object_bridge::has_method(name);
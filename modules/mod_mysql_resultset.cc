@@ -77,6 +77,8 @@ ClassicResult::ClassicResult(
   _column_names.reset(new std::vector<std::string>());
   for (auto &cmd : _result->get_metadata())
     _column_names->push_back(cmd.get_column_label());
+
+  m_prefetch = prefetch(_result);
 }
 
 // Documentation of the hasData function
@@ -96,7 +98,7 @@ bool ClassicResult::has_data() {}
 shcore::Value ClassicResult::has_data(const shcore::Argument_list &args) const {
   args.ensure_count(0, get_function_name("hasData").c_str());
 
-  return Value(_result->has_resultset());
+  return Value(result()->has_resultset());
 }
 
 // Documentation of the fetchOne function
@@ -125,7 +127,7 @@ shcore::Value ClassicResult::fetch_one(
 
   try {
     if (_result) {
-      const mysqlshdk::db::IRow *row = _result->fetch_one();
+      const mysqlshdk::db::IRow *row = result()->fetch_one();
       if (row) {
         ret_val = shcore::Value::wrap(new mysqlsh::Row(_column_names, *row));
       }
@@ -137,7 +139,11 @@ shcore::Value ClassicResult::fetch_one(
 }
 
 const mysqlshdk::db::IRow *ClassicResult::fetch_one() const {
-  return _result->fetch_one();
+  return result()->fetch_one();
+}
+
+shcore::Value ClassicResult::next_item() {
+  return fetch_one(shcore::Argument_list());
 }
 
 // Documentation of nextDataSet function
@@ -183,7 +189,7 @@ shcore::Value ClassicResult::next_data_set(const shcore::Argument_list &args) {
               get_function_name("nextDataSet").c_str(),
               get_function_name("nextResult").c_str());
 
-  return shcore::Value(_result->next_resultset());
+  return shcore::Value(result()->next_resultset());
 }
 
 // Documentation of nextResult function
@@ -208,7 +214,7 @@ bool ClassicResult::next_result() {}
 shcore::Value ClassicResult::next_result(const shcore::Argument_list &args) {
   args.ensure_count(0, get_function_name("nextResult").c_str());
 
-  return shcore::Value(_result->next_resultset());
+  return shcore::Value(result()->next_resultset());
 }
 
 // Documentation of the fetchAll function
@@ -684,7 +690,7 @@ shcore::Value ClassicResult::get_member(const std::string &prop) const {
                   get_function_name("affectedItemsCount").c_str());
     }
 
-    return shcore::Value(_result->get_affected_row_count());
+    return shcore::Value(result()->get_affected_row_count());
   }
 
   if (prop == "warningCount" || prop == "warningsCount") {
@@ -694,7 +700,7 @@ shcore::Value ClassicResult::get_member(const std::string &prop) const {
                   get_function_name("warningsCount").c_str());
     }
 
-    return shcore::Value(_result->get_warning_count());
+    return shcore::Value(result()->get_warning_count());
   }
 
   if (prop == "warnings") {
@@ -702,7 +708,7 @@ shcore::Value ClassicResult::get_member(const std::string &prop) const {
         new shcore::Value::Array_type);
     if (_result) {
       while (std::unique_ptr<mysqlshdk::db::Warning> warning =
-                 _result->fetch_one_warning()) {
+                 result()->fetch_one_warning()) {
         mysqlsh::Row *warning_row = new mysqlsh::Row();
         switch (warning->level) {
           case mysqlshdk::db::Warning::Level::Note:
@@ -735,9 +741,9 @@ shcore::Value ClassicResult::get_member(const std::string &prop) const {
         mysqlshdk::utils::format_seconds(_result->get_execution_time()));
 
   if (prop == "autoIncrementValue")
-    return shcore::Value((int)_result->get_auto_increment_value());
+    return shcore::Value((int)result()->get_auto_increment_value());
 
-  if (prop == "info") return shcore::Value(_result->get_info());
+  if (prop == "info") return shcore::Value(result()->get_info());
 
   if (prop == "columnCount") {
     size_t count = _result->get_metadata().size();
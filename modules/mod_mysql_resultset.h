@@ -28,6 +28,7 @@
 #define _MOD_RESULT_H_
 
 #include <list>
+#include <memory>
 #include <string>
 #include <vector>
 #include "modules/devapi/base_resultset.h"
@@ -142,6 +143,10 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   virtual shcore::Value get_member(const std::string &prop) const;
   virtual void append_json(shcore::JSON_dumper &dumper) const;
 
+  // rows are returned when iterating from the scripting languages
+  virtual bool is_iterable() const { return true; }
+  virtual shcore::Value next_item();
+
   shcore::Value has_data(const shcore::Argument_list &args) const;
   virtual shcore::Value fetch_one(const shcore::Argument_list &args) const;
   virtual shcore::Value fetch_all(const shcore::Argument_list &args) const;
@@ -150,10 +155,16 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
 
   shcore::Value::Array_type_ref get_columns() const;
 
-  virtual mysqlshdk::db::IResult *get_result() { return _result.get(); };
+  virtual mysqlshdk::db::IResult *get_result() { return result(); };
 
  private:
+  mysqlshdk::db::IResult *result() const {
+    return m_prefetch ? m_prefetch.get() : _result.get();
+  }
+
   std::shared_ptr<mysqlshdk::db::mysql::Result> _result;
+  // reads rows of _result ahead, if enabled
+  std::unique_ptr<mysqlshdk::db::IResult> m_prefetch;
   std::shared_ptr<std::vector<std::string>> _column_names;
   mutable shcore::Value::Array_type_ref _columns;
 };
@@ -40,6 +40,7 @@
 #include "modules/mod_utils.h"
 #include "shellcore/utils_help.h"
 #include "utils/utils_general.h"
+#include "utils/utils_lexing.h"
 #include "utils/utils_path.h"
 #include "utils/utils_sqlstring.h"
 
@@ -48,6 +49,22 @@ using namespace mysqlsh;
 using namespace mysqlsh::mysql;
 using namespace shcore;
 
+namespace {
+
+/**
+ * Checks if the query has any identifier (!) placeholders, these cannot be
+ * bound to a prepared statement.
+ */
+bool has_identifier_placeholders(const std::string &query) {
+  for (mysqlshdk::utils::SQL_string_iterator it(query); it.valid(); ++it) {
+    if (*it == '!') return true;
+  }
+
+  return false;
+}
+
+}  // namespace
+
 // Documentation for ClassicSession class
 REGISTER_HELP_CLASS(ClassicSession, mysql);
 REGISTER_HELP(CLASSICSESSION_GLOBAL_BRIEF,
@@ -287,11 +304,17 @@ shcore::Value ClassicSession::execute_sql(const std::string &query,
     } else {
       Interruptible intr(this);
       try {
-        ClassicResult *result;
-        ret_val = Value::wrap(
-            result = new ClassicResult(
-                std::dynamic_pointer_cast<mysqlshdk::db::mysql::Result>(
-                    _session->query(sub_query_placeholders(query, args)))));
+        std::shared_ptr<mysqlshdk::db::IResult> result;
+
+        if (args && !args->empty() &&
+            _session->supports_prepared_statements() &&
+            !has_identifier_placeholders(query))
+          result = execute_prepared(query, args);
+        else
+          result = _session->query(sub_query_placeholders(query, args));
+
+        ret_val = Value::wrap(new ClassicResult(
+            std::dynamic_pointer_cast<mysqlshdk::db::mysql::Result>(result)));
       } catch (const mysqlshdk::db::Error &error) {
         throw shcore::Exception::mysql_error_with_code_and_state(
             error.what(), error.code(), error.sqlstate());
@@ -301,6 +324,48 @@ shcore::Value ClassicSession::execute_sql(const std::string &query,
   return ret_val;
 }
 
+std::shared_ptr<mysqlshdk::db::IResult> ClassicSession::execute_prepared(
+    const std::string &query, const shcore::Array_t &args) {
+  std::vector<mysqlshdk::db::mysql::Stmt_param> params;
+  params.reserve(args->size());
+
+  int i = 0;
+  for (const shcore::Value &value : *args) {
+    switch (value.type) {
+      case shcore::Integer:
+        params.emplace_back(value.as_int());
+        break;
+      case shcore::Bool:
+        params.emplace_back(static_cast<int64_t>(value.as_bool()));
+        break;
+      case shcore::Float:
+        params.emplace_back(value.as_double());
+        break;
+      case shcore::String:
+        params.emplace_back(value.get_string());
+        break;
+      case shcore::Null:
+        params.emplace_back();
+        break;
+      default:
+        throw Exception::argument_error(shcore::str_format(
+            "Invalid type for placeholder value at index #%i", i));
+    }
+    ++i;
+  }
+
+  try {
+    return _session->query_prepared(query, params);
+  } catch (const std::invalid_argument &e) {
+    throw Exception::argument_error(e.what());
+  } catch (const mysqlshdk::db::Error &e) {
+    if (e.code() != ER_UNSUPPORTED_PS) throw;
+  }
+
+  // the statement cannot be prepared, substitute placeholders on the client
+  return _session->query(sub_query_placeholders(query, args));
+}
+
 // We need to hide this from doxygen to avoif warnings
 #if !defined DOXYGEN_JS && !defined DOXYGEN_PY
 std::shared_ptr<ClassicResult> ClassicSession::execute_sql(
@@ -134,6 +134,8 @@ class SHCORE_PUBLIC ClassicSession
 
  private:
   virtual shcore::Object_bridge_ref raw_execute_sql(const std::string &query);
+  std::shared_ptr<mysqlshdk::db::IResult> execute_prepared(
+      const std::string &query, const shcore::Array_t &args);
 
  public:
   virtual SessionType session_type() const { return SessionType::Classic; }
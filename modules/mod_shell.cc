@@ -28,11 +28,13 @@
 #include "modules/devapi/base_database_object.h"
 #include "modules/devapi/mod_mysqlx_session.h"
 #include "modules/mod_mysql_session.h"
+#include "modules/mod_shell_parallel.h"
 #include "modules/mod_utils.h"
 #include "modules/mysqlxtest_utils.h"
 #include "mysqlshdk/libs/db/utils_connection.h"
 #include "mysqlshdk/shellcore/credential_manager.h"
 #include "shellcore/base_session.h"
+#include "shellcore/interrupt_handler.h"
 #include "shellcore/shell_notifications.h"
 #include "shellcore/utils_help.h"
 #include "utils/utils_general.h"
@@ -84,6 +86,7 @@ void Shell::init() {
   expose("disablePager", &Shell::disable_pager);
   expose("registerReport", &Shell::register_report, "name", "type", "report",
          "?description");
+  expose("parallel", &Shell::parallel, "jobs", "?options");
 }
 
 Shell::~Shell() {}
@@ -1421,4 +1424,173 @@ void Shell::register_report(const std::string &name, const std::string &type,
   m_reports->register_report(name, type, report, description);
 }
 
+REGISTER_HELP_FUNCTION(parallel, shell);
+REGISTER_HELP(SHELL_PARALLEL_BRIEF,
+              "Executes SQL statements on multiple sessions concurrently.");
+REGISTER_HELP(SHELL_PARALLEL_PARAM,
+              "@param jobs List of dictionaries describing the jobs.");
+REGISTER_HELP(SHELL_PARALLEL_PARAM1,
+              "@param options Optional dictionary with options that change "
+              "the function behavior.");
+REGISTER_HELP(SHELL_PARALLEL_RETURNS,
+              "@returns A list with the results of the jobs, in the same order "
+              "as the jobs.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL,
+              "Each job opens its own session and executes its statements in "
+              "order, jobs are executed concurrently by a pool of worker "
+              "threads. The function returns once all of the jobs are "
+              "finished.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL1,
+              "Each of the jobs is a dictionary with the following keys:");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL2,
+              "@li connection: the connection data of the server, as in "
+              "<<<connect>>>().");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL3,
+              "@li sql: a string with a single statement or a list of "
+              "statements.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL4,
+              "Password is not prompted for, if it's not given it's retrieved "
+              "using the configured credential helper.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL5,
+              "The options dictionary may contain the following options:");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL6,
+              "@li threads: maximum number of jobs executed concurrently, "
+              "default is 4.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL7,
+              "@li callback: a function called with the result of each job as "
+              "soon as the job is finished.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL8,
+              "Result of a job is a dictionary with the following keys:");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL9, "@li index: position of the job.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL10,
+              "@li connection: URI of the server, without the password.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL11,
+              "@li results: a list with results of the executed statements, "
+              "each of them is a dictionary with columns, rows, "
+              "affectedItemsCount and warningsCount keys.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL12,
+              "@li error: null, or message of the error which stopped the "
+              "job.");
+REGISTER_HELP(SHELL_PARALLEL_DETAIL13,
+              "Errors do not stop the other jobs. If the function is "
+              "interrupted with ^C, statements which are being executed are "
+              "killed and the remaining jobs are not started.");
+
+/**
+ * $(SHELL_PARALLEL_BRIEF)
+ *
+ * $(SHELL_PARALLEL_PARAM)
+ * $(SHELL_PARALLEL_PARAM1)
+ *
+ * $(SHELL_PARALLEL_RETURNS)
+ *
+ * $(SHELL_PARALLEL_DETAIL)
+ *
+ * $(SHELL_PARALLEL_DETAIL1)
+ * $(SHELL_PARALLEL_DETAIL2)
+ * $(SHELL_PARALLEL_DETAIL3)
+ *
+ * $(SHELL_PARALLEL_DETAIL4)
+ *
+ * $(SHELL_PARALLEL_DETAIL5)
+ * $(SHELL_PARALLEL_DETAIL6)
+ * $(SHELL_PARALLEL_DETAIL7)
+ *
+ * $(SHELL_PARALLEL_DETAIL8)
+ * $(SHELL_PARALLEL_DETAIL9)
+ * $(SHELL_PARALLEL_DETAIL10)
+ * $(SHELL_PARALLEL_DETAIL11)
+ * $(SHELL_PARALLEL_DETAIL12)
+ *
+ * $(SHELL_PARALLEL_DETAIL13)
+ */
+#if DOXYGEN_JS
+List Shell::parallel(List jobs, Dictionary options) {}
+#elif DOXYGEN_PY
+list Shell::parallel(list jobs, dict options) {}
+#endif
+shcore::Array_t Shell::parallel(const shcore::Array_t &jobs,
+                                const shcore::Dictionary_t &options) {
+  std::vector<Parallel_sql_job> sql_jobs;
+
+  for (const auto &job : *jobs) {
+    const std::string context = "job #" + std::to_string(sql_jobs.size() + 1);
+
+    if (job.type != shcore::Map)
+      throw shcore::Exception::argument_error(
+          "Argument #1 is expected to be a list of dictionaries");
+
+    shcore::Value connection;
+    shcore::Value sql;
+    shcore::Option_unpacker(job.as_map())
+        .required("connection", &connection)
+        .required("sql", &sql)
+        .end("at " + context);
+
+    Parallel_sql_job sql_job;
+    sql_job.connection = get_connection_options(connection);
+    sql_job.connection.set_default_connection_data();
+
+    // workers cannot prompt, stored password is used
+    if (!sql_job.connection.has_password())
+      shcore::Credential_manager::get().get_password(&sql_job.connection);
+
+    if (sql.type == shcore::String) {
+      sql_job.statements.emplace_back(sql.get_string());
+    } else if (sql.type == shcore::Array) {
+      for (const auto &statement : *sql.as_array()) {
+        if (statement.type != shcore::String)
+          throw shcore::Exception::argument_error(
+              "Option 'sql' of " + context +
+              " is expected to be a string or a list of strings");
+
+        sql_job.statements.emplace_back(statement.get_string());
+      }
+    } else {
+      throw shcore::Exception::argument_error(
+          "Option 'sql' of " + context +
+          " is expected to be a string or a list of strings");
+    }
+
+    sql_jobs.emplace_back(std::move(sql_job));
+  }
+
+  int64_t threads = 4;
+  shcore::Value callback;
+
+  if (options) {
+    shcore::Option_unpacker(options)
+        .optional("threads", &threads)
+        .optional("callback", &callback)
+        .end();
+  }
+
+  if (threads < 1)
+    throw shcore::Exception::argument_error(
+        "Option 'threads' is expected to be a positive integer");
+
+  if (callback && callback.type != shcore::Function)
+    throw shcore::Exception::argument_error(
+        "Option 'callback' is expected to be a function");
+
+  Parallel_sql_runner runner(static_cast<std::size_t>(threads));
+  Parallel_sql_runner::Result_callback on_result;
+
+  if (callback) {
+    const auto function = callback.as_function();
+    on_result = [&function](const shcore::Dictionary_t &result) {
+      shcore::Argument_list args;
+      args.push_back(shcore::Value(result));
+      function->invoke(args);
+    };
+  }
+
+  shcore::Interrupt_handler intr_handler([&runner]() {
+    runner.cancel();
+    return false;
+  });
+
+  return runner.run(sql_jobs, on_result);
+}
+
 }  // namespace mysqlsh
@@ -88,6 +88,7 @@ class SHCORE_PUBLIC Shell : public shcore::Cpp_object_bridge
   Undefined disablePager();
   Undefined registerReport(String name, String type, Function report,
                            Dictionary description);
+  List parallel(List jobs, Dictionary options);
 #elif DOXYGEN_PY
   Options options;
   Reports reports;
@@ -108,6 +109,7 @@ class SHCORE_PUBLIC Shell : public shcore::Cpp_object_bridge
   None enable_pager();
   None disable_pager();
   None register_report(str name, str type, Function report, dict description);
+  list parallel(list jobs, dict options);
 #endif
 
   shcore::Value list_credential_helpers(const shcore::Argument_list &args);
@@ -133,6 +135,9 @@ class SHCORE_PUBLIC Shell : public shcore::Cpp_object_bridge
                        const shcore::Function_base_ref &report,
                        const shcore::Dictionary_t &options);
 
+  shcore::Array_t parallel(const shcore::Array_t &jobs,
+                           const shcore::Dictionary_t &options);
+
  protected:
   void init();
 
@@ -49,83 +49,94 @@ REGISTER_HELP(OPTIONS_DETAIL2,
               "execution of an SQL script in batch "
               "mode shall continue if errors occur");
 REGISTER_HELP(OPTIONS_DETAIL3,
+              "@li credentialStore.cacheTtl: number of seconds the passwords "
+              "fetched from the credential helper are kept in memory, 0 "
+              "disables the cache");
+REGISTER_HELP(OPTIONS_DETAIL4,
               "@li credentialStore.excludeFilters: array of URLs for which "
               "automatic password storage is disabled, supports glob "
               "characters '*' and '?'");
-REGISTER_HELP(OPTIONS_DETAIL4,
+REGISTER_HELP(OPTIONS_DETAIL5,
               "@li credentialStore.helper: name of the credential helper to "
               "use to fetch/store passwords; a special value \"default\" is "
               "supported to use platform default helper; a special value "
               "\"@<disabled>\" is supported to disable the credential store");
-REGISTER_HELP(OPTIONS_DETAIL5,
+REGISTER_HELP(OPTIONS_DETAIL6,
+              "@li credentialStore.persistent: true to keep the credential "
+              "helper running between the requests, instead of starting it "
+              "for each of them");
+REGISTER_HELP(OPTIONS_DETAIL7,
               "@li credentialStore.savePasswords: controls automatic password "
               "storage, allowed values: \"always\", \"prompt\" or \"never\" ");
-REGISTER_HELP(OPTIONS_DETAIL6,
+REGISTER_HELP(OPTIONS_DETAIL8,
               "@li dba.gtidWaitTimeout: timeout value in seconds to wait for "
               "GTIDs to be synchronized");
-REGISTER_HELP(OPTIONS_DETAIL7,
+REGISTER_HELP(OPTIONS_DETAIL9,
               "@li defaultCompress: Enable compression in client/server "
               "protocol by default in global shell sessions.");
-REGISTER_HELP(OPTIONS_DETAIL8,
+REGISTER_HELP(OPTIONS_DETAIL10,
               "@li defaultMode: shell mode to use when shell is started, "
               "allowed values: \"js\", \"py\", \"sql\" or \"none\" ");
-REGISTER_HELP(OPTIONS_DETAIL9,
+REGISTER_HELP(OPTIONS_DETAIL11,
               "@li devapi.dbObjectHandles: true to enable schema collection "
               "and table name aliases in the db "
               "object, for DevAPI operations.");
-REGISTER_HELP(OPTIONS_DETAIL10,
+REGISTER_HELP(OPTIONS_DETAIL12,
               "@li history.autoSave: true "
               "to save command history when exiting the shell");
-REGISTER_HELP(OPTIONS_DETAIL11,
+REGISTER_HELP(OPTIONS_DETAIL13,
               "@li history.maxSize: number "
               "of entries to keep in command history");
-REGISTER_HELP(OPTIONS_DETAIL12,
+REGISTER_HELP(OPTIONS_DETAIL14,
               "@li history.sql.ignorePattern: colon separated list of glob "
               "patterns to filter"
               " out of the command history in SQL mode");
-REGISTER_HELP(OPTIONS_DETAIL13,
+REGISTER_HELP(OPTIONS_DETAIL15,
               "@li interactive: read-only, boolean "
               "value that indicates if the shell is "
               "running in interactive mode");
-REGISTER_HELP(OPTIONS_DETAIL14, "@li logLevel: current log level");
-REGISTER_HELP(OPTIONS_DETAIL15,
+REGISTER_HELP(OPTIONS_DETAIL16, "@li logLevel: current log level");
+REGISTER_HELP(OPTIONS_DETAIL17,
               "@li resultFormat: controls the type of "
               "output produced for SQL results.");
-REGISTER_HELP(OPTIONS_DETAIL16,
+REGISTER_HELP(OPTIONS_DETAIL18,
+              "@li resultPrefetchRows: number of rows of a query result to "
+              "read ahead in a background thread, 0 to disable");
+REGISTER_HELP(OPTIONS_DETAIL19,
               "@li pager: string which specifies the external command which is "
               "going to be used to display the paged output");
-REGISTER_HELP(OPTIONS_DETAIL17,
+REGISTER_HELP(OPTIONS_DETAIL20,
               "@li passwordsFromStdin: boolean value that indicates if the "
               "shell should read passwords from stdin instead of the tty");
-REGISTER_HELP(OPTIONS_DETAIL18,
+REGISTER_HELP(OPTIONS_DETAIL21,
               "@li sandboxDir: default path where the "
               "new sandbox instances for InnoDB "
               "cluster will be deployed");
 REGISTER_HELP(
-    OPTIONS_DETAIL19,
+    OPTIONS_DETAIL22,
     "@li showColumnTypeInfo: display column type information in SQL mode. "
     "Please be aware that "
     "output may depend on the protocol you are using to connect to the "
     "server, e.g. DbType field is approximated when using X protocol.");
-REGISTER_HELP(OPTIONS_DETAIL20,
+REGISTER_HELP(OPTIONS_DETAIL23,
               "@li showWarnings: boolean value to "
               "indicate whether warnings shall be "
               "included when printing an SQL result");
-REGISTER_HELP(OPTIONS_DETAIL21,
+REGISTER_HELP(OPTIONS_DETAIL24,
               "@li useWizards: read-only, boolean value "
               "to indicate if the Shell is using the "
               "interactive wrappers (wizard mode)");
 
-REGISTER_HELP(OPTIONS_DETAIL22,
+REGISTER_HELP(OPTIONS_DETAIL25,
               "The resultFormat option supports the following values:");
-REGISTER_HELP(OPTIONS_DETAIL23,
+REGISTER_HELP(OPTIONS_DETAIL26,
               "@li table: displays the output in table format (default)");
-REGISTER_HELP(OPTIONS_DETAIL24, "@li json: displays the output in JSON format");
+REGISTER_HELP(OPTIONS_DETAIL27, "@li json: displays the output in JSON format");
 REGISTER_HELP(
-    OPTIONS_DETAIL25,
+    OPTIONS_DETAIL28,
     "@li json/raw: displays the output in a JSON format but in a single line");
 REGISTER_HELP(
-    OPTIONS_DETAIL26,
+    OPTIONS_DETAIL29,
     "@li vertical: displays the outputs vertically, one line per column value");
 
 std::string &Options::append_descr(std::string &s_out, int indent,
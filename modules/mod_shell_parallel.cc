@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/mod_shell_parallel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "modules/mod_utils.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/db/mysql/session_pool.h"
+#include "mysqlshdk/libs/db/mysqlx/session.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "scripting/shexcept.h"
+
+namespace mysqlsh {
+
+namespace {
+
+shcore::Dictionary_t statement_result(mysqlshdk::db::IResult *result) {
+  const auto dict = shcore::make_dict();
+  const auto columns = shcore::make_array();
+  const auto rows = shcore::make_array();
+
+  for (const auto &column : result->get_metadata()) {
+    columns->emplace_back(column.get_column_label());
+  }
+
+  const mysqlshdk::db::IRow *row = nullptr;
+
+  while ((row = result->fetch_one()) != nullptr) {
+    const auto values = shcore::make_array();
+    *values = get_row_values(*row);
+    rows->emplace_back(values);
+  }
+
+  dict->set("affectedItemsCount",
+            shcore::Value(result->get_affected_row_count()));
+  dict->set("columns", shcore::Value(columns));
+  dict->set("rows", shcore::Value(rows));
+  dict->set("warningsCount", shcore::Value(result->get_warning_count()));
+
+  return dict;
+}
+
+}  // namespace
+
+Parallel_sql_runner::Parallel_sql_runner(std::size_t threads)
+    : m_threads(std::max<std::size_t>(threads, 1)) {}
+
+shcore::Array_t Parallel_sql_runner::run(
+    const std::vector<Parallel_sql_job> &jobs,
+    const Result_callback &on_result) {
+  m_next = 0;
+  m_results.assign(jobs.size(), nullptr);
+  m_finished.clear();
+  m_workers.clear();
+
+  const auto threads = worker_thread_count(m_threads, jobs.size());
+  // joined once the running statements are killed
+  Worker_threads workers;
+
+  shcore::on_leave_scope stop_workers([this]() {
+    // the callback may have thrown, the rest of the jobs is not needed
+    if (!m_cancelled && m_next < m_results.size()) {
+      m_cancelled = true;
+      kill_running_statements();
+    }
+  });
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    m_workers.emplace_back(new Worker());
+  }
+
+  for (const auto &worker : m_workers) {
+    const auto w = worker.get();
+    workers.start([this, &jobs, w]() { work(jobs, w); });
+  }
+
+  std::size_t reported = 0;
+
+  while (reported < jobs.size() && !m_cancelled) {
+    std::deque<std::size_t> finished;
+
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      // cancel() only sets the flag, wake up periodically to check it
+      m_job_done.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+        return !m_finished.empty() || m_cancelled;
+      });
+      std::swap(finished, m_finished);
+    }
+
+    for (const auto index : finished) {
+      ++reported;
+      if (on_result) on_result(m_results[index]);
+    }
+  }
+
+  if (m_cancelled) {
+    kill_running_statements();
+    throw shcore::cancelled("Parallel execution cancelled.");
+  }
+
+  workers.join();
+
+  const auto results = shcore::make_array();
+
+  for (auto &result : m_results) {
+    results->emplace_back(std::move(result));
+  }
+
+  return results;
+}
+
+void Parallel_sql_runner::work(const std::vector<Parallel_sql_job> &jobs,
+                               Worker *worker) {
+  std::size_t index = 0;
+
+  while (!m_cancelled && (index = m_next++) < jobs.size()) {
+    auto result = execute(index, jobs[index], worker);
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_results[index] = std::move(result);
+      m_finished.emplace_back(index);
+    }
+
+    m_job_done.notify_one();
+  }
+}
+
+shcore::Dictionary_t Parallel_sql_runner::execute(std::size_t index,
+                                                  const Parallel_sql_job &job,
+                                                  Worker *worker) {
+  const auto result = shcore::make_dict();
+  const auto statements = shcore::make_array();
+
+  result->set("connection", shcore::Value(job.connection.as_uri()));
+  result->set("error", shcore::Value::Null());
+  result->set("index", shcore::Value(static_cast<uint64_t>(index)));
+  result->set("results", shcore::Value(statements));
+
+  try {
+    std::shared_ptr<mysqlshdk::db::ISession> session;
+
+    if (job.connection.has_scheme() &&
+        job.connection.get_scheme() == "mysqlx") {
+      session = mysqlshdk::db::mysqlx::Session::create();
+      session->connect(job.connection);
+    } else {
+      session = mysqlshdk::db::mysql::open_pooled_session(job.connection);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      worker->session = session;
+    }
+
+    shcore::on_leave_scope release_session([worker]() {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      worker->session.reset();
+    });
+
+    for (const auto &sql : job.statements) {
+      if (m_cancelled) break;
+
+      statements->emplace_back(statement_result(session->query(sql).get()));
+    }
+  } catch (const mysqlshdk::db::Error &e) {
+    result->set("error", shcore::Value(e.format()));
+  } catch (const std::exception &e) {
+    result->set("error", shcore::Value(e.what()));
+  }
+
+  return result;
+}
+
+void Parallel_sql_runner::kill_running_statements() {
+  for (const auto &worker : m_workers) {
+    uint64_t connection_id = 0;
+    mysqlshdk::db::Connection_options connection;
+
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      if (!worker->session) continue;
+      connection_id = worker->session->get_connection_id();
+      connection = worker->session->get_connection_options();
+    }
+
+    try {
+      std::shared_ptr<mysqlshdk::db::ISession> session;
+
+      if (connection.has_scheme() && connection.get_scheme() == "mysqlx")
+        session = mysqlshdk::db::mysqlx::Session::create();
+      else
+        session = mysqlshdk::db::mysql::Session::create();
+
+      session->connect(connection);
+      session->executef("KILL QUERY ?", connection_id);
+      session->close();
+    } catch (const std::exception &e) {
+      log_warning("Error cancelling SQL query: %s", e.what());
+    }
+  }
+}
+
+}  // namespace mysqlsh
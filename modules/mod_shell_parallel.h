@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_MOD_SHELL_PARALLEL_H_
+#define MODULES_MOD_SHELL_PARALLEL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/session.h"
+
+namespace mysqlsh {
+
+/**
+ * Job executed by shell.parallel(), statements are executed in order, using
+ * a single session.
+ */
+struct Parallel_sql_job {
+  mysqlshdk::db::Connection_options connection;
+  std::vector<std::string> statements;
+};
+
+/**
+ * Executes SQL jobs on a pool of native threads.
+ *
+ * Each worker takes the next pending job, opens a session (classic sessions
+ * come from the process-wide session pool) and executes its statements.
+ * Results of a job are converted into a dictionary by the worker, so that the
+ * interpreter thread only needs to hand them to the script.
+ *
+ * Result of a job holds:
+ *  - index - position of the job,
+ *  - connection - URI of the server, without the password,
+ *  - results - list of dictionaries with columns, rows, affectedItemsCount
+ *    and warningsCount of each of the executed statements,
+ *  - error - null, or the error which stopped the job.
+ */
+class Parallel_sql_runner final {
+ public:
+  using Result_callback = std::function<void(const shcore::Dictionary_t &)>;
+
+  /**
+   * @param threads maximum number of jobs executed concurrently, only one is
+   *        used when sessions are recorded or replayed
+   */
+  explicit Parallel_sql_runner(std::size_t threads);
+
+  Parallel_sql_runner(const Parallel_sql_runner &) = delete;
+  Parallel_sql_runner &operator=(const Parallel_sql_runner &) = delete;
+
+  /**
+   * Executes the jobs, blocks until all of them are finished.
+   *
+   * @param jobs jobs to be executed
+   * @param on_result optional callback, called in the calling thread with the
+   *        result of each job, in order of completion
+   *
+   * @returns results of the jobs, in order of the jobs.
+   *
+   * @throws shcore::cancelled if cancel() was called
+   */
+  shcore::Array_t run(const std::vector<Parallel_sql_job> &jobs,
+                      const Result_callback &on_result = {});
+
+  /**
+   * Stops the execution: pending jobs are not started and run() kills the
+   * statements which are currently executed. Only sets a flag, can be called
+   * from any thread, including the interrupt handler.
+   */
+  void cancel() { m_cancelled = true; }
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::shared_ptr<mysqlshdk::db::ISession> session;
+  };
+
+  void work(const std::vector<Parallel_sql_job> &jobs, Worker *worker);
+
+  void kill_running_statements();
+
+  shcore::Dictionary_t execute(std::size_t index, const Parallel_sql_job &job,
+                               Worker *worker);
+
+  std::size_t m_threads;
+  std::atomic<bool> m_cancelled{false};
+  std::atomic<std::size_t> m_next{0};
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::vector<shcore::Dictionary_t> m_results;
+
+  std::mutex m_mutex;
+  std::condition_variable m_job_done;
+  // indexes of the jobs which finished, but were not reported yet
+  std::deque<std::size_t> m_finished;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_MOD_SHELL_PARALLEL_H_
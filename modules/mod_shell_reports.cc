@@ -557,7 +557,9 @@ class Shell_reports::Report_options : public shcore::Options {
       : m_report_name(std::move(r->m_name)),
         m_options(std::move(r->m_options)),
         m_argc(std::move(r->m_argc)),
-        m_formatter(std::move(r->m_formatter)) {
+        m_formatter(std::move(r->m_formatter)),
+        m_native(nullptr != std::dynamic_pointer_cast<Native_report_function>(
+                                r->m_function)) {
     // each report has an option to display help
     add_startup_options()(&m_show_help, false, shcore::opts::cmdline("--help"),
                           "Display this help and exit.");
@@ -660,6 +662,8 @@ class Shell_reports::Report_options : public shcore::Options {
 
   bool vertical() const { return m_vertical; }
 
+  bool native() const { return m_native; }
+
   void parse_args(const std::vector<std::string> &args) {
     // reset previous values and prepare for parsing
     reset();
@@ -842,6 +846,7 @@ class Shell_reports::Report_options : public shcore::Options {
   const Report::Options m_options;
   const Report::Argc m_argc;
   const Report::Formatter m_formatter;
+  const bool m_native;
   std::string m_help;
   bool m_show_help;
   bool m_vertical;
@@ -898,7 +903,7 @@ void Report::set_details(const std::vector<std::string> &details) {
 }
 
 void Report::set_options(const Options &options) {
-  std::set<std::string> long_names = {"help", "interval", "nocls"};
+  std::set<std::string> long_names = {"help", "interval", "nocls", "timing"};
   std::set<std::string> short_names = {"i"};
 
   if (type() == Report::Type::LIST) {
@@ -1129,6 +1134,11 @@ std::vector<std::string> Shell_reports::list_reports() const {
   return reports;
 }
 
+bool Shell_reports::is_native_report(const std::string &name) const {
+  const auto report = m_reports.find(normalize_report_name(name));
+  return m_reports.end() != report && report->second->native();
+}
+
 std::string Shell_reports::call_report(
     const std::string &name, const std::shared_ptr<ShellBaseSession> &session,
     const std::vector<std::string> &args) {
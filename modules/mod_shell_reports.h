@@ -268,6 +268,16 @@ class SHCORE_PUBLIC Shell_reports : public Extensible_object {
    */
   std::vector<std::string> list_reports() const;
 
+  /*
+   * Checks if the specified report is implemented in C++. Such reports do not
+   * use the scripting context, and can be called from a background thread.
+   *
+   * @param name - name of the report.
+   *
+   * @returns true if report exists and it is a native one.
+   */
+  bool is_native_report(const std::string &name) const;
+
   /*
    * Calls the specified report and provides its output in text form.
    *
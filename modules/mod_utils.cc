@@ -527,6 +527,7 @@ std::vector<shcore::Value> get_row_values(const mysqlshdk::db::IRow &row) {
   using shcore::Date;
   using shcore::Value;
   std::vector<Value> value_array;
+  value_array.reserve(row.num_fields());
 
   for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
     Value v;
@@ -22,6 +22,7 @@
  */
 
 #include "modules/util/mod_util.h"
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <vector>
@@ -31,10 +32,12 @@
 #include "modules/util/upgrade_check.h"
 #include "mysqlshdk/include/shellcore/base_session.h"
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/utils/document_parser.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -72,6 +75,13 @@ Util::Util(shcore::IShell_core *owner) : _shell_core(*owner) {
 #endif
 }
 
+namespace {
+
+// upper limit of sessions used to concurrently execute upgrade checks
+constexpr std::size_t k_upgrade_check_sessions = 4;
+
+}  // namespace
+
 static std::string format_upgrade_issue(const Upgrade_issue &problem) {
   std::stringstream ss;
   const char *item = "Schema";
@@ -503,21 +513,48 @@ shcore::Value Util::check_for_server_upgrade(
       }
     };
 
-    for (auto &check : checklist)
-      if (check->is_runnable()) {
-        try {
-          std::vector<Upgrade_issue> issues = check->run(session, opts);
-          for (const auto &issue : issues) update_counts(issue.level);
-          print->check_results(*check, issues);
-        } catch (const Upgrade_check::CheckConfigurationError &e) {
-          print->check_error(*check, e.what(), false);
-        } catch (const std::exception &e) {
-          print->check_error(*check, e.what());
-        }
-      } else {
-        update_counts(check->get_level());
-        print->manual_check(*check);
+    // checks are independent, additional sessions allow to run them
+    // concurrently (unless sessions are recorded or replayed)
+    const std::size_t runnable = std::count_if(
+        checklist.begin(), checklist.end(),
+        [](const std::unique_ptr<Upgrade_check> &c) { return c->is_runnable(); });
+    const auto session_count =
+        worker_thread_count(k_upgrade_check_sessions, runnable);
+    std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions{session};
+
+    while (sessions.size() < session_count) {
+      try {
+        sessions.emplace_back(
+            establish_session(session->get_connection_options(), false));
+      } catch (const std::exception &e) {
+        log_warning("Unable to open additional session for upgrade checks: %s",
+                    e.what());
+        break;
       }
+    }
+
+    run_upgrade_checks(
+        checklist, opts, sessions,
+        [&print, &update_counts](Upgrade_check *check,
+                                 std::vector<Upgrade_issue> &&issues,
+                                 std::exception_ptr error) {
+          if (check->is_runnable()) {
+            try {
+              if (error) std::rethrow_exception(error);
+              for (const auto &issue : issues) update_counts(issue.level);
+              print->check_results(*check, issues);
+            } catch (const Upgrade_check::CheckConfigurationError &e) {
+              print->check_error(*check, e.what(), false);
+            } catch (const std::exception &e) {
+              print->check_error(*check, e.what());
+            }
+          } else {
+            update_counts(check->get_level());
+            print->manual_check(*check);
+          }
+        });
+
+    for (std::size_t i = 1; i < sessions.size(); ++i) sessions[i]->close();
 
     std::string summary;
     if (errors > 0) {
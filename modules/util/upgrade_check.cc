@@ -23,13 +23,23 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <map>
 #include <sstream>
 #include <utility>
 
 #include "modules/util/upgrade_check.h"
+#include "mysqlshdk/include/scripting/shexcept.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/libs/config/config_file.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/mysqlx/session.h"
+#include "mysqlshdk/libs/db/row_copy.h"
 #include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
@@ -217,6 +227,19 @@ Sql_upgrade_check::Sql_upgrade_check(const char *name, const char *title,
 std::vector<Upgrade_issue> Sql_upgrade_check::run(
     std::shared_ptr<mysqlshdk::db::ISession> session,
     const Upgrade_check_options &options) {
+  const auto query_cache =
+      m_set_up.empty() ? options.query_cache.get() : nullptr;
+  std::size_t consumed = 0;
+
+  // shared queries which are not going to be fetched because of an error are
+  // released, otherwise their rows are kept until all the checks are done
+  shcore::on_leave_scope release_queries([this, query_cache, &consumed]() {
+    if (query_cache) {
+      for (auto i = consumed; i < m_queries.size(); ++i)
+        query_cache->release(m_queries[i]);
+    }
+  });
+
   if (m_minimal_version != nullptr &&
       Version(options.server_version) < Version(m_minimal_version))
     throw std::runtime_error(shcore::str_format(
@@ -226,13 +249,22 @@ std::vector<Upgrade_issue> Sql_upgrade_check::run(
   for (const auto &stm : m_set_up) session->execute(stm);
 
   std::vector<Upgrade_issue> issues;
+  const auto add_issue = [this, &issues](const mysqlshdk::db::IRow *row) {
+    Upgrade_issue issue = parse_row(row);
+    if (!issue.empty()) issues.emplace_back(std::move(issue));
+  };
+
   for (const auto &query : m_queries) {
-    //    puts(query.c_str());
-    auto result = session->query(query);
-    const mysqlshdk::db::IRow *row = nullptr;
-    while ((row = result->fetch_one()) != nullptr) {
-      Upgrade_issue issue = parse_row(row);
-      if (!issue.empty()) issues.emplace_back(std::move(issue));
+    const bool shared = query_cache && query_cache->is_shared(query);
+    ++consumed;
+
+    if (shared) {
+      const auto rows = query_cache->fetch(query, session.get());
+      for (const auto &row : *rows) add_issue(row.get());
+    } else {
+      auto result = session->query(query);
+      const mysqlshdk::db::IRow *row = nullptr;
+      while ((row = result->fetch_one()) != nullptr) add_issue(row);
     }
   }
 
@@ -489,23 +521,29 @@ Sql_upgrade_check::get_obsolete_sql_mode_flags_check() {
   const std::array<const char *, 9> modes = {
       {"DB2", "MSSQL", "MYSQL323", "MYSQL40", "NO_FIELD_OPTIONS",
        "NO_KEY_OPTIONS", "NO_TABLE_OPTIONS", "ORACLE", "POSTGRESQL"}};
-  std::vector<std::string> queries;
+
+  // each of the tables is scanned once, for all of the modes
+  std::string flags;
   for (const char *mode : modes) {
-    queries.emplace_back(shcore::str_format(
-        "select routine_schema, routine_name, concat(routine_type, ' uses "
-        "obsolete %s sql_mode') from information_schema.routines where "
-        "find_in_set('%s', sql_mode);",
-        mode, mode));
-    queries.emplace_back(shcore::str_format(
-        "select event_schema, event_name, 'EVENT uses obsolete %s sql_mode' "
-        "from information_schema.EVENTS where find_in_set('%s', sql_mode);",
-        mode, mode));
-    queries.emplace_back(shcore::str_format(
-        "select trigger_schema, trigger_name, 'TRIGGER uses obsolete %s "
-        "sql_mode' from information_schema.TRIGGERS where find_in_set('%s', "
-        "sql_mode);",
-        mode, mode));
+    flags += flags.empty() ? "(select " : " union all select ";
+    flags += (shcore::sqlstring("? as flag", 0) << mode).str();
   }
+  flags += ") f";
+
+  std::vector<std::string> queries;
+  queries.emplace_back(
+      "select routine_schema, routine_name, concat(routine_type, ' uses "
+      "obsolete ', f.flag, ' sql_mode') from information_schema.routines "
+      "join " +
+      flags + " on find_in_set(f.flag, sql_mode);");
+  queries.emplace_back(
+      "select event_schema, event_name, concat('EVENT uses obsolete ', "
+      "f.flag, ' sql_mode') from information_schema.EVENTS join " +
+      flags + " on find_in_set(f.flag, sql_mode);");
+  queries.emplace_back(
+      "select trigger_schema, trigger_name, concat('TRIGGER uses obsolete ', "
+      "f.flag, ' sql_mode') from information_schema.TRIGGERS join " +
+      flags + " on find_in_set(f.flag, sql_mode);");
 
   return std::unique_ptr<Sql_upgrade_check>(new Sql_upgrade_check(
       "sqlModeFlagCheck", "Usage of obsolete sql_mode flags",
@@ -618,6 +656,25 @@ bool UNUSED_VARIABLE(register_sharded_tablespaces) =
         "8.0.11", "8.0.13");
 }
 
+namespace {
+
+// Definitions of views and stored programs, shared by the checks which parse
+// them, columns are: schema, name, column, type of the object, definition.
+constexpr const char k_view_definitions[] =
+    "select table_schema, table_name, '', 'VIEW', UPPER(view_definition) from "
+    "information_schema.views";
+constexpr const char k_routine_definitions[] =
+    "select routine_schema, routine_name, '', routine_type, "
+    "UPPER(routine_definition) from information_schema.routines";
+constexpr const char k_trigger_definitions[] =
+    "select TRIGGER_SCHEMA, TRIGGER_NAME, '', 'TRIGGER', "
+    "UPPER(ACTION_STATEMENT) from information_schema.triggers";
+constexpr const char k_event_definitions[] =
+    "select event_schema, event_name, '', 'EVENT', UPPER(EVENT_DEFINITION) "
+    "from information_schema.events";
+
+}  // namespace
+
 class Removed_functions_check : public Sql_upgrade_check {
  private:
   const std::array<std::pair<std::string, const char *>, 71> functions{
@@ -697,17 +754,11 @@ class Removed_functions_check : public Sql_upgrade_check {
   Removed_functions_check()
       : Sql_upgrade_check(
             "removedFunctionsCheck", "Usage of removed functions",
-            {"select table_schema, table_name, '', 'VIEW', "
-             "UPPER(view_definition) from information_schema.views",
-             "select routine_schema, routine_name, '', routine_type, "
-             "UPPER(routine_definition) from information_schema.routines;",
+            {k_view_definitions, k_routine_definitions,
              "select TABLE_SCHEMA,TABLE_NAME,COLUMN_NAME, 'COLUMN'"
              ", UPPER(GENERATION_EXPRESSION) from "
              "information_schema.columns where extra regexp 'generated';",
-             "select TRIGGER_SCHEMA, TRIGGER_NAME, '', 'TRIGGER', "
-             "UPPER(ACTION_STATEMENT) from information_schema.triggers;",
-             "select event_schema, event_name, '', 'EVENT', "
-             "UPPER(EVENT_DEFINITION) from information_schema.events"},
+             k_trigger_definitions, k_event_definitions},
             Upgrade_issue::ERROR,
             "Following DB objects make use of functions that have "
             "been removed in version 8.0. Please make sure to update them to "
@@ -784,22 +835,8 @@ class Groupby_asc_syntax_check : public Sql_upgrade_check {
   Groupby_asc_syntax_check()
       : Sql_upgrade_check(
             "groupByAscCheck", "Usage of removed GROUP BY ASC/DESC syntax",
-            {"select table_schema, table_name, 'VIEW', "
-             "UPPER(view_definition) from information_schema.views where "
-             "UPPER(view_definition) like '%ASC%' or UPPER(view_definition) "
-             "like '%DESC%';",
-             "select routine_schema, routine_name, routine_type, "
-             "UPPER(routine_definition) from information_schema.routines where "
-             "UPPER(routine_definition) like '%ASC%' or "
-             "UPPER(routine_definition) like '%DESC%';",
-             "select TRIGGER_SCHEMA, TRIGGER_NAME, 'TRIGGER', "
-             "UPPER(ACTION_STATEMENT) from information_schema.triggers  where "
-             "UPPER(ACTION_STATEMENT) like '%ASC%' or UPPER(ACTION_STATEMENT) "
-             "like '%DESC%';",
-             "select event_schema, event_name, 'EVENT', "
-             "UPPER(EVENT_DEFINITION) from information_schema.events where "
-             "UPPER(event_definition) like '%ASC%' or UPPER(event_definition) "
-             "like '%DESC%';"},
+            {k_view_definitions, k_routine_definitions,
+             k_trigger_definitions, k_event_definitions},
             Upgrade_issue::ERROR,
             "The following DB objects use removed GROUP BY ASC/DESC syntax. "
             "They need to be altered so that ASC/DESC keyword is removed "
@@ -808,7 +845,13 @@ class Groupby_asc_syntax_check : public Sql_upgrade_check {
 
   Upgrade_issue parse_row(const mysqlshdk::db::IRow *row) override {
     Upgrade_issue res;
-    std::string definition = row->get_as_string(3);
+    std::string definition = row->get_as_string(4);
+
+    // definitions are shared with other checks, filter them here
+    if (definition.find("ASC") == std::string::npos &&
+        definition.find("DESC") == std::string::npos)
+      return res;
+
     mysqlshdk::utils::SQL_string_iterator it(definition);
     bool gb_found = false;
     std::string token;
@@ -828,11 +871,11 @@ class Groupby_asc_syntax_check : public Sql_upgrade_check {
           it.set_position(pos);
       } else if (gb_found && token == "ASC") {
         res.description =
-            row->get_as_string(2) + " uses removed GROUP BY ASC syntax";
+            row->get_as_string(3) + " uses removed GROUP BY ASC syntax";
         break;
       } else if (gb_found && token == "DESC") {
         res.description =
-            row->get_as_string(2) + " uses removed GROUP BY DESC syntax";
+            row->get_as_string(3) + " uses removed GROUP BY DESC syntax";
         break;
       }
     }
@@ -1234,4 +1277,223 @@ bool register_manual_checks() {
 bool UNUSED_VARIABLE(reg_manual_checks) = register_manual_checks();
 }  // namespace
 
+void Upgrade_check_query_cache::add_consumer(
+    const std::vector<std::string> &queries) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (const auto &query : queries) {
+    auto &entry = m_entries[query];
+    ++entry.consumers;
+    ++entry.pending;
+  }
+}
+
+bool Upgrade_check_query_cache::is_shared(const std::string &query) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto entry = m_entries.find(query);
+  return m_entries.end() != entry && entry->second.consumers > 1;
+}
+
+std::shared_ptr<const Upgrade_check_query_cache::Rows>
+Upgrade_check_query_cache::fetch(const std::string &query,
+                                 mysqlshdk::db::ISession *session) {
+  std::promise<std::shared_ptr<const Rows>> promise;
+  std::shared_future<std::shared_ptr<const Rows>> rows;
+  bool execute = false;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto entry = m_entries.find(query);
+    assert(m_entries.end() != entry);
+
+    if (!entry->second.started) {
+      entry->second.started = true;
+      entry->second.rows = promise.get_future().share();
+      execute = true;
+    }
+
+    rows = entry->second.rows;
+    consume(entry);
+  }
+
+  if (execute) {
+    try {
+      const auto result = session->query(query);
+      auto data = std::make_shared<Rows>();
+      const mysqlshdk::db::IRow *row = nullptr;
+
+      while ((row = result->fetch_one()) != nullptr)
+        data->emplace_back(shcore::make_unique<mysqlshdk::db::Row_copy>(*row));
+
+      promise.set_value(std::move(data));
+    } catch (...) {
+      promise.set_exception(std::current_exception());
+    }
+  }
+
+  return rows.get();
+}
+
+void Upgrade_check_query_cache::release(const std::string &query) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto entry = m_entries.find(query);
+
+  if (m_entries.end() != entry) consume(entry);
+}
+
+void Upgrade_check_query_cache::consume(
+    std::map<std::string, Entry>::iterator entry) {
+  // the last consumer releases the rows once it's done with them
+  if (--entry->second.pending == 0) m_entries.erase(entry);
+}
+
+namespace {
+
+void kill_queries(
+    const std::vector<std::shared_ptr<mysqlshdk::db::ISession>> &sessions) {
+  for (const auto &session : sessions) {
+    try {
+      const auto &connection = session->get_connection_options();
+      std::shared_ptr<mysqlshdk::db::ISession> kill_session;
+
+      if (connection.has_scheme() && connection.get_scheme() == "mysqlx")
+        kill_session = mysqlshdk::db::mysqlx::Session::create();
+      else
+        kill_session = mysqlshdk::db::mysql::Session::create();
+
+      kill_session->connect(connection);
+      kill_session->executef("KILL QUERY ?", session->get_connection_id());
+      kill_session->close();
+    } catch (const std::exception &e) {
+      log_warning("Error cancelling upgrade check query: %s", e.what());
+    }
+  }
+}
+
+}  // namespace
+
+void run_upgrade_checks(
+    const std::vector<std::unique_ptr<Upgrade_check>> &checklist,
+    const Upgrade_check_options &options,
+    const std::vector<std::shared_ptr<mysqlshdk::db::ISession>> &sessions,
+    const std::function<void(Upgrade_check *, std::vector<Upgrade_issue> &&,
+                             std::exception_ptr)> &on_result) {
+  assert(!sessions.empty());
+
+  Upgrade_check_options opts = options;
+  opts.query_cache = std::make_shared<Upgrade_check_query_cache>();
+
+  for (const auto &check : checklist) {
+    const auto sql_check = dynamic_cast<Sql_upgrade_check *>(check.get());
+
+    if (sql_check && sql_check->is_runnable())
+      opts.query_cache->add_consumer(sql_check->get_shareable_queries());
+  }
+
+  struct Result {
+    bool done = false;
+    std::vector<Upgrade_issue> issues;
+    std::exception_ptr error;
+  };
+
+  const auto run = [&opts](Upgrade_check *check,
+                           const std::shared_ptr<mysqlshdk::db::ISession> &s,
+                           Result *result) {
+    if (check->is_runnable()) {
+      try {
+        result->issues = check->run(s, opts);
+      } catch (...) {
+        result->error = std::current_exception();
+      }
+    }
+  };
+
+  std::atomic<bool> cancelled{false};
+
+  // ^C is forwarded to the checks which are running, they are stopped by
+  // killing their queries
+  shcore::Interrupt_handler intr_handler([&sessions, &cancelled]() {
+    cancelled = true;
+    kill_queries(sessions);
+    return false;
+  });
+
+  const auto check_cancelled = [&cancelled]() {
+    if (cancelled) throw shcore::cancelled("Upgrade check cancelled.");
+  };
+
+  // when sessions are recorded or replayed, checks are executed one by one,
+  // using the first session
+  const auto threads =
+      mysqlsh::worker_thread_count(sessions.size(), checklist.size());
+
+  if (threads == 1) {
+    for (const auto &check : checklist) {
+      check_cancelled();
+
+      Result result;
+      run(check.get(), sessions.front(), &result);
+
+      check_cancelled();
+      on_result(check.get(), std::move(result.issues), result.error);
+    }
+
+    return;
+  }
+
+  std::vector<Result> results(checklist.size());
+  std::mutex mutex;
+  std::condition_variable done;
+  std::atomic<std::size_t> next{0};
+  std::atomic<bool> finished{false};
+
+  const auto worker =
+      [&](const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+        std::size_t i = 0;
+
+        while (!finished && !cancelled && (i = next++) < checklist.size()) {
+          Result result;
+
+          // result is reported on every path, otherwise the calling thread
+          // would wait for it forever
+          shcore::on_leave_scope report([&, i]() {
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              results[i] = std::move(result);
+              results[i].done = true;
+            }
+
+            done.notify_all();
+          });
+
+          run(checklist[i].get(), session, &result);
+        }
+      };
+
+  mysqlsh::Worker_threads workers;
+  // workers are joined once they notice that they are not needed anymore
+  shcore::on_leave_scope stop_workers([&finished]() { finished = true; });
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    const auto &session = sessions[i];
+    workers.start([&worker, &session]() { worker(session); });
+  }
+
+  for (std::size_t i = 0; i < checklist.size(); ++i) {
+    Result result;
+
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      // interrupt handler does not notify, wake up periodically to check it
+      while (!results[i].done && !cancelled)
+        done.wait_for(lock, std::chrono::milliseconds(100));
+
+      check_cancelled();
+      result = std::move(results[i]);
+    }
+
+    on_result(checklist[i].get(), std::move(result.issues), result.error);
+  }
+}
+
 } /* namespace mysqlsh */
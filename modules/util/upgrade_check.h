@@ -24,10 +24,13 @@
 #ifndef MODULES_UTIL_UPGRADE_CHECK_H_
 #define MODULES_UTIL_UPGRADE_CHECK_H_
 
+#include <exception>
 #include <forward_list>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -56,10 +59,14 @@ struct Upgrade_issue {
   std::string get_db_object() const;
 };
 
+class Upgrade_check_query_cache;
+
 struct Upgrade_check_options {
   std::string server_version;
   std::string target_version;
   std::string config_path;
+  /// Results of the queries shared by several checks, optional.
+  std::shared_ptr<Upgrade_check_query_cache> query_cache;
 };
 
 std::string to_string(const Upgrade_issue &problem);
@@ -171,6 +178,14 @@ class Sql_upgrade_check : public Upgrade_check {
       std::shared_ptr<mysqlshdk::db::ISession> session,
       const Upgrade_check_options &options) override;
 
+  /**
+   * Queries which results can be shared with other checks, these are the
+   * queries which do not depend on the state of the session.
+   */
+  std::vector<std::string> get_shareable_queries() const {
+    return m_set_up.empty() ? m_queries : std::vector<std::string>();
+  }
+
  protected:
   virtual Upgrade_issue parse_row(const mysqlshdk::db::IRow *row);
   const char *get_description_internal() const override;
@@ -262,6 +277,76 @@ class Manual_check : public Upgrade_check {
   Upgrade_issue::Level m_level;
 };
 
+/**
+ * Holds results of the queries executed by more than one check, so that each
+ * of them is executed only once. Rows are kept until all of the checks which
+ * registered the query have consumed them.
+ */
+class Upgrade_check_query_cache {
+ public:
+  using Rows = std::vector<std::unique_ptr<mysqlshdk::db::IRow>>;
+
+  /**
+   * Registers a check which is going to execute the given queries.
+   */
+  void add_consumer(const std::vector<std::string> &queries);
+
+  /**
+   * Returns true if the query was registered by more than one check.
+   */
+  bool is_shared(const std::string &query) const;
+
+  /**
+   * Provides rows of the given shared query. The first caller executes the
+   * query using its session, remaining ones wait for the result.
+   *
+   * @throws whatever was thrown when the query was executed
+   */
+  std::shared_ptr<const Rows> fetch(const std::string &query,
+                                    mysqlshdk::db::ISession *session);
+
+  /**
+   * Called by a registered check which is not going to fetch rows of the
+   * given query, i.e. because it has failed before reaching it.
+   */
+  void release(const std::string &query);
+
+ private:
+  struct Entry {
+    int consumers = 0;
+    int pending = 0;
+    bool started = false;
+    std::shared_future<std::shared_ptr<const Rows>> rows;
+  };
+
+  void consume(std::map<std::string, Entry>::iterator entry);
+
+  mutable std::mutex m_mutex;
+  std::map<std::string, Entry> m_entries;
+};
+
+/**
+ * Executes the runnable checks from the given list, each of the sessions is
+ * used by a separate thread. Queries shared by several checks are executed
+ * once.
+ *
+ * @param checklist checks to be executed
+ * @param options options passed to each of the checks
+ * @param sessions sessions used to run the checks, must not be empty
+ * @param on_result called for each of the checks from the calling thread, in
+ *        the order of the checklist, receives issues found by the check or an
+ *        exception it has thrown (manual checks are not executed)
+ *
+ * @throws shcore::cancelled if interrupted with ^C, queries of the checks
+ *         which are running are killed
+ */
+void run_upgrade_checks(
+    const std::vector<std::unique_ptr<Upgrade_check>> &checklist,
+    const Upgrade_check_options &options,
+    const std::vector<std::shared_ptr<mysqlshdk::db::ISession>> &sessions,
+    const std::function<void(Upgrade_check *, std::vector<Upgrade_issue> &&,
+                             std::exception_ptr)> &on_result);
+
 } /* namespace mysqlsh */
 
 #endif  // MODULES_UTIL_UPGRADE_CHECK_H_
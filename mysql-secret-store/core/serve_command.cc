@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysql-secret-store/core/serve_command.h"
+
+#include <sstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <cstdio>
+#endif  // _WIN32
+
+namespace mysql {
+namespace secret_store {
+namespace core {
+
+std::string Serve_command::help() const {
+  return "Executes the requests read from the standard input, until it's "
+         "closed.";
+}
+
+void Serve_command::execute(std::istream *input, std::ostream *output) {
+#ifdef _WIN32
+  // lengths are given in bytes, disable the newline translation
+  _setmode(_fileno(stdin), _O_BINARY);
+  _setmode(_fileno(stdout), _O_BINARY);
+#endif  // _WIN32
+
+  std::string header;
+
+  while (std::getline(*input, header)) {
+    std::istringstream header_stream{header};
+    std::string name;
+    std::size_t length = 0;
+
+    if (!(header_stream >> name >> length)) {
+      throw std::runtime_error{"Invalid request header: " + header};
+    }
+
+    std::string request(length, '\0');
+
+    if (length > 0 && !input->read(&request[0], length)) {
+      throw std::runtime_error{"Unexpected end of request"};
+    }
+
+    std::istringstream command_input{request};
+    std::ostringstream command_output;
+    int exit_code = 0;
+
+    try {
+      const auto command = find(name);
+
+      if (nullptr == command) {
+        throw std::runtime_error{"Unknown command: '" + name + "'"};
+      }
+
+      command->execute(&command_input, &command_output);
+    } catch (const std::exception &ex) {
+      exit_code = 1;
+      command_output.str(ex.what());
+    }
+
+    const auto response = command_output.str();
+
+    *output << exit_code << ' ' << response.length() << '\n'
+            << response << std::flush;
+  }
+}
+
+Command *Serve_command::find(const std::string &name) const {
+  for (const auto &command : *m_commands) {
+    if (command->name() == name && command.get() != this) {
+      return command.get();
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace core
+}  // namespace secret_store
+}  // namespace mysql
@@ -24,6 +24,7 @@
 #ifndef MYSQL_SECRET_STORE_INCLUDE_MYSQL_SECRET_STORE_API_H_
 #define MYSQL_SECRET_STORE_INCLUDE_MYSQL_SECRET_STORE_API_H_
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
@@ -111,6 +112,24 @@ class Helper_name final {
 /**
  * Provides access to the operations supported by the secret store helper.
  */
+/**
+ * Options controlling how secret store helper is used.
+ */
+struct Helper_options {
+  /**
+   * Keep the helper process running between the requests, instead of starting
+   * it for each of them. Helpers which do not support this mode are started
+   * for each request.
+   */
+  bool persistent = false;
+
+  /**
+   * Secrets retrieved from the helper are cached in memory for this long,
+   * zero disables the cache.
+   */
+  std::chrono::milliseconds cache_ttl{0};
+};
+
 class Helper_interface final {
  public:
   /**
@@ -190,11 +209,12 @@ class Helper_interface final {
 
  private:
   friend std::unique_ptr<Helper_interface> get_helper(
-      const Helper_name &name) noexcept;
+      const Helper_name &name, const Helper_options &options) noexcept;
 
   class Helper_interface_impl;
 
-  explicit Helper_interface(const Helper_name &name) noexcept;
+  Helper_interface(const Helper_name &name,
+                   const Helper_options &options) noexcept;
 
   std::unique_ptr<Helper_interface_impl> m_impl;
 };
@@ -221,6 +241,18 @@ std::vector<Helper_name> get_available_helpers(
  */
 std::unique_ptr<Helper_interface> get_helper(const Helper_name &name) noexcept;
 
+/**
+ * Provides the specified secret store helper.
+ *
+ * @param name Name of the secret store helper to fetch.
+ * @param options Options controlling how helper is used.
+ *
+ * @returns Specified secret store helper or nullptr if helper cannot be
+ *          fetched.
+ */
+std::unique_ptr<Helper_interface> get_helper(
+    const Helper_name &name, const Helper_options &options) noexcept;
+
 /**
  * Sets a hook which is going to be used by the API to log messages.
  *
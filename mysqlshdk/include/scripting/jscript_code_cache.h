@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_INCLUDE_SCRIPTING_JSCRIPT_CODE_CACHE_H_
+#define MYSQLSHDK_INCLUDE_SCRIPTING_JSCRIPT_CODE_CACHE_H_
+
+#include <cstdint>
+#include <string>
+
+#include "scripting/common.h"
+
+namespace shcore {
+
+/**
+ * Persistent storage of the V8 code cache of JS sources.
+ *
+ * There's a single entry per key (usually the path of a script), which holds
+ * the code cache together with the hash of the source it was produced from.
+ * Entry is ignored if the source has changed since then, V8 validates the
+ * data on its own (i.e. rejects it after an upgrade or if flags changed).
+ *
+ * Errors are never reported to the caller, as the worst thing which can
+ * happen is that the script is compiled from scratch.
+ */
+class SHCORE_PUBLIC JScript_code_cache {
+ public:
+  /**
+   * Creates cache which stores data in the given directory, directory is
+   * created when the first entry is stored. Cache is disabled if directory
+   * is empty.
+   */
+  explicit JScript_code_cache(const std::string &directory);
+
+  /**
+   * Directory in the user configuration path.
+   */
+  static std::string default_directory();
+
+  bool enabled() const { return !m_directory.empty(); }
+
+  const std::string &directory() const { return m_directory; }
+
+  /**
+   * Path of the file which holds the entry for the given key.
+   */
+  std::string entry_path(const std::string &key) const;
+
+  /**
+   * Loads the code cache of the given source.
+   *
+   * @param key the key of the entry
+   * @param source the current contents of the script
+   * @param data receives the code cache
+   *
+   * @returns true if entry exists and it was produced from the same source.
+   */
+  bool load(const std::string &key, const std::string &source,
+            std::string *data) const;
+
+  /**
+   * Stores the code cache of the given source, replacing any previous entry.
+   */
+  void store(const std::string &key, const std::string &source,
+             const uint8_t *data, size_t length) const;
+
+  void remove(const std::string &key) const;
+
+ private:
+  std::string m_directory;
+};
+
+}  // namespace shcore
+
+#endif  // MYSQLSHDK_INCLUDE_SCRIPTING_JSCRIPT_CODE_CACHE_H_
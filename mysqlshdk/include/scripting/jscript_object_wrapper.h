@@ -55,7 +55,8 @@ class JScript_method_wrapper {
 
 class JScript_object_wrapper {
  public:
-  JScript_object_wrapper(JScript_context *context, bool indexed = false);
+  JScript_object_wrapper(JScript_context *context, bool indexed = false,
+                         bool iterable = false);
   ~JScript_object_wrapper();
 
   v8::Local<v8::Object> wrap(std::shared_ptr<Object_bridge> object);
@@ -84,6 +85,9 @@ class JScript_object_wrapper {
   static void handler_ienumerator(
       const v8::PropertyCallbackInfo<v8::Array> &info);
 
+  static void iterator(const v8::FunctionCallbackInfo<v8::Value> &args);
+  static void iterator_next(const v8::FunctionCallbackInfo<v8::Value> &args);
+
  private:
   JScript_context *_context;
   v8::Persistent<v8::ObjectTemplate> _object_template;
@@ -51,6 +51,7 @@ struct JScript_type_bridger {
 
   class JScript_object_wrapper *object_wrapper;
   class JScript_object_wrapper *indexed_object_wrapper;
+  class JScript_object_wrapper *iterable_object_wrapper;
   class JScript_function_wrapper *function_wrapper;
   class JScript_map_wrapper *map_wrapper;
   class JScript_array_wrapper *array_wrapper;
@@ -32,6 +32,8 @@ class Python_context;
 
 struct PyMemberCache {
   std::map<std::string, AutoPyObject> members;
+  // method objects returned to Python, reused by subsequent lookups
+  std::map<std::string, AutoPyObject> methods;
 };
 
 /*
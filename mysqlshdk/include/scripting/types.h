@@ -26,11 +26,13 @@
 
 #include "types_common.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/utils/nullable.h"
@@ -69,6 +71,8 @@ std::string type_description(Value_type type);
 class Object_bridge;
 typedef std::shared_ptr<Object_bridge> Object_bridge_ref;
 
+class Function_base;
+
 /** A generic value that can be used from any language we support.
 
  Anything that can be represented using this can be passed as a parameter to
@@ -116,9 +120,23 @@ struct SHCORE_PUBLIC Value {
   typedef std::vector<Value> Array_type;
   typedef std::shared_ptr<Array_type> Array_type_ref;
 
+  /**
+   * Dictionary of values.
+   *
+   * Entries are kept in a contiguous array sorted by key, which makes lookups
+   * and iteration cache friendly, while the iteration order is the same as
+   * the one of std::map (output of the maps does not depend on the order in
+   * which the keys were added).
+   *
+   * Adding a new key may move the existing entries, references and iterators
+   * to entries are not valid after the map is modified. Keys which are added
+   * out of order move all the entries which follow them, maps with many keys
+   * in arbitrary order should be built with assign().
+   */
   class SHCORE_PUBLIC Map_type {
    public:
-    typedef std::map<std::string, Value> container_type;
+    typedef std::vector<std::pair<std::string, Value>> container_type;
+    typedef container_type::value_type value_type;
     typedef container_type::const_iterator const_iterator;
     typedef container_type::iterator iterator;
 
@@ -154,60 +172,134 @@ struct SHCORE_PUBLIC Value {
       return iter->second.as_object<C>();
     }
 
-    const_iterator find(const std::string &k) const { return _map.find(k); }
-    iterator find(const std::string &k) { return _map.find(k); }
+    const_iterator find(const std::string &k) const {
+      const auto it = lower_bound(k);
+      return it != _map.end() && it->first == k ? it : _map.end();
+    }
+    iterator find(const std::string &k) {
+      const auto it = lower_bound(k);
+      return it != _map.end() && it->first == k ? it : _map.end();
+    }
 
-    void erase(const std::string &k) { _map.erase(k); }
+    void erase(const std::string &k) {
+      const auto it = find(k);
+      if (it != _map.end()) _map.erase(it);
+    }
     void clear() { _map.clear(); }
 
+    /**
+     * Preallocates space for the given number of entries, to be used when
+     * the size of the map is known before it is populated.
+     */
+    void reserve(size_t n) { _map.reserve(n); }
+
+    /**
+     * Replaces the contents of the map with the given entries, which can be
+     * in any order. If a key is repeated, the last value is kept, just like
+     * if the entries were added one by one with set().
+     */
+    void assign(container_type &&entries);
+
     const_iterator begin() const { return _map.begin(); }
     iterator begin() { return _map.begin(); }
 
     const_iterator end() const { return _map.end(); }
     iterator end() { return _map.end(); }
 
-    void set(const std::string &k, const shcore::Value &v) { _map[k] = v; }
+    // value is taken by copy, so that it can be an entry of this map
+    void set(const std::string &k, shcore::Value v) {
+      emplace_key(k, nullptr)->second = std::move(v);
+    }
 
-    const container_type::mapped_type &at(const std::string &k) const {
-      return _map.at(k);
+    const Value &at(const std::string &k) const {
+      const auto it = find(k);
+      if (it == _map.end()) throw std::out_of_range("map::at");
+      return it->second;
     }
-    container_type::mapped_type &operator[](const std::string &k) {
-      return _map[k];
+    Value &operator[](const std::string &k) {
+      return emplace_key(k, nullptr)->second;
     }
     bool operator==(const Map_type &other) const { return _map == other._map; }
 
     bool empty() const { return _map.empty(); }
     size_t size() const { return _map.size(); }
-    size_t count(const std::string &k) const { return _map.count(k); }
+    size_t count(const std::string &k) const { return has_key(k) ? 1 : 0; }
 
     template <class T>
     std::pair<iterator, bool> emplace(const std::string &key, const T &value) {
-      return _map.emplace(key, Value(value));
+      bool inserted = false;
+      const auto it = emplace_key(key, &inserted);
+      if (inserted) it->second = Value(value);
+      return {it, inserted};
     }
 
    private:
+    static bool key_less(const value_type &entry, const std::string &k) {
+      return entry.first < k;
+    }
+
+    const_iterator lower_bound(const std::string &k) const {
+      return std::lower_bound(_map.begin(), _map.end(), k, key_less);
+    }
+    iterator lower_bound(const std::string &k) {
+      return std::lower_bound(_map.begin(), _map.end(), k, key_less);
+    }
+
+    // returns the entry with the given key, adding an Undefined one if needed
+    iterator emplace_key(const std::string &k, bool *inserted) {
+      // keys which are added in order are just appended
+      if (_map.empty() || _map.back().first < k) {
+        if (inserted) *inserted = true;
+        _map.emplace_back(k, Value());
+        return _map.end() - 1;
+      }
+
+      const auto it = lower_bound(k);
+      if (it->first == k) {
+        if (inserted) *inserted = false;
+        return it;
+      }
+
+      if (inserted) *inserted = true;
+      return _map.emplace(it, k, Value());
+    }
+
     container_type _map;
   };
   typedef std::shared_ptr<Map_type> Map_type_ref;
 
   Value_type type;
-  union {
+
+  /**
+   * The active member is selected by the type. Strings and references are
+   * stored in place, short strings do not allocate any memory at all.
+   *
+   * This makes the Value larger than a type and a pointer, the size is
+   * bounded by the static_assert below the class, so that adding a member
+   * which grows it further is a conscious decision.
+   */
+  union Storage {
+    Storage() {}
+    ~Storage() {}
+
     bool b;
-    std::string *s;
+    std::string s;
     int64_t i;
     uint64_t ui;
     double d;
-    std::shared_ptr<class Object_bridge> *o;
-    std::shared_ptr<Array_type> *array;
-    std::shared_ptr<Map_type> *map;
-    std::weak_ptr<Map_type> *mapref;
-    std::shared_ptr<class Function_base> *func;
+    std::shared_ptr<Object_bridge> o;
+    std::shared_ptr<Array_type> array;
+    std::shared_ptr<Map_type> map;
+    std::weak_ptr<Map_type> mapref;
+    std::shared_ptr<Function_base> func;
   } value;
 
   Value() : type(Undefined) {}
   Value(const Value &copy);
+  Value(Value &&other) noexcept;
 
   explicit Value(const std::string &s);
+  explicit Value(std::string &&s);
   explicit Value(const char *);
   explicit Value(const char *, size_t n);
   explicit Value(int i);
@@ -258,12 +350,25 @@ struct SHCORE_PUBLIC Value {
     return v;
   }
 
-  //! parse a string returned by repr() back into a Value
-  static Value parse(const std::string &s);
+  /**
+   * Parses a JSON document or a string returned by repr() back into a Value.
+   *
+   * JSON documents are handled by a fast parser. If lenient is true and the
+   * document is not valid JSON, it's parsed again allowing the extended
+   * syntax produced by repr(): single quoted strings, \\xXX and other C
+   * escapes, undefined and case insensitive constants, trailing commas.
+   *
+   * @param s the document to be parsed
+   * @param lenient whether the extended syntax is allowed
+   *
+   * @throws Exception if the document cannot be parsed
+   */
+  static Value parse(const std::string &s, bool lenient = true);
 
   ~Value();
 
   Value &operator=(const Value &other);
+  Value &operator=(Value &&other) noexcept;
 
   bool operator==(const Value &other) const;
 
@@ -298,29 +403,29 @@ struct SHCORE_PUBLIC Value {
   std::string as_string() const;
   const std::string &get_string() const {
     check_type(String);
-    return *value.s;
+    return value.s;
   }
   template <class C>
   std::shared_ptr<C> as_object() const {
     check_type(Object);
     return std::dynamic_pointer_cast<C>(type == shcore::Null ? nullptr
-                                                             : *value.o);
+                                                             : value.o);
   }
 
   std::shared_ptr<Object_bridge> as_object() const {
     check_type(Object);
     return std::dynamic_pointer_cast<Object_bridge>(
-        type == shcore::Null ? nullptr : *value.o);
+        type == shcore::Null ? nullptr : value.o);
   }
 
   std::shared_ptr<Map_type> as_map() const {
     check_type(Map);
-    return type == shcore::Null ? nullptr : *value.map;
+    return type == shcore::Null ? nullptr : value.map;
   }
 
   std::shared_ptr<Array_type> as_array() const {
     check_type(Array);
-    return type == shcore::Null ? nullptr : *value.array;
+    return type == shcore::Null ? nullptr : value.array;
   }
 
   std::vector<std::string> to_string_vector() const {
@@ -335,7 +440,7 @@ struct SHCORE_PUBLIC Value {
   std::shared_ptr<Function_base> as_function() const {
     check_type(Function);
     return std::dynamic_pointer_cast<Function_base>(
-        type == shcore::Null ? nullptr : *value.func);
+        type == shcore::Null ? nullptr : value.func);
   }
 
  private:
@@ -348,7 +453,18 @@ struct SHCORE_PUBLIC Value {
   static Value parse_number(const char **pc);
 
   std::string yaml(int indent) const;
+
+  // the active member of the storage must be already destroyed
+  void construct(const Value &other);
+  void construct(Value &&other) noexcept;
+  // destroys the active member of the storage, type is set to Undefined
+  void destruct() noexcept;
 };
+
+static_assert(sizeof(Value) <= sizeof(void *) + sizeof(std::string),
+              "shcore::Value should not be larger than its type and the "
+              "largest member of its storage");
+
 typedef Value::Map_type_ref Dictionary_t;
 typedef Value::Array_type_ref Array_t;
 
@@ -756,6 +872,12 @@ class SHCORE_PUBLIC Object_bridge {
   //! Sets the value of a member
   virtual void set_member(size_t index, Value value) = 0;
 
+  //! Returns true if the object can be iterated from the scripting languages
+  virtual bool is_iterable() const = 0;
+
+  //! Returns the next item of the iteration, null or undefined when done
+  virtual Value next_item() = 0;
+
   //! Returns true if a method with the given name exists.
   virtual bool has_method(const std::string &name) const = 0;
 
@@ -449,11 +449,15 @@ class SHCORE_PUBLIC Cpp_function : public Function_base {
   const Raw_signature &function_signature() const { return _meta->signature; }
 
  private:
-  // Each instance holds it's names on the different styles
+  static const Metadata *legacy_metadata(
+      const std::string &name,
+      const std::vector<std::pair<std::string, Value_type>> *args,
+      bool var_args);
+
   Function _func;
 
+  // Metadata is shared between the instances of the same function
   const Metadata *_meta;
-  Metadata _meta_tmp;  // temporary memory for legacy versions of Cpp_function
 };
 
 namespace internal {
@@ -512,6 +516,9 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
   virtual Value get_member(size_t index) const;
   virtual void set_member(size_t index, Value value);
 
+  virtual bool is_iterable() const;
+  virtual Value next_item();
+
   virtual bool has_method(const std::string &name) const;
 
   virtual Value call(const std::string &name, const Argument_list &args);
@@ -910,7 +917,14 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
       const std::string &method) const;
 
  private:
-  std::multimap<std::string, std::shared_ptr<Cpp_function>> _funcs;
+  using Function_map =
+      std::multimap<std::string, std::shared_ptr<Cpp_function>>;
+
+  // Returns the first overload of the named function or _funcs.end()
+  Function_map::const_iterator find_function(const std::string &method,
+                                             const NamingStyle &style) const;
+
+  Function_map _funcs;
 
   // Returns the base name of the given member
   std::string get_base_name(const std::string &member) const;
@@ -922,7 +936,7 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
       Cpp_function::Metadata &meta, const std::string &name, Value_type rtype,
       const std::vector<std::pair<std::string, Value_type>> &ptypes);
 
-  Value call_function(const std::string &scope,
+  Value call_function(const std::string &name,
                       const std::shared_ptr<Cpp_function> &func,
                       const Argument_list &args);
 #ifdef FRIEND_TEST
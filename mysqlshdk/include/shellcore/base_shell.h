@@ -33,6 +33,7 @@
 #include "shellcore/shell_options.h"
 #include "shellcore/shell_sql.h"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -78,6 +79,16 @@ class SHCORE_PUBLIC Base_shell {
                          std::shared_ptr<shcore::Cpp_object_bridge> object,
                          shcore::IShell_core::Mode_mask modes =
                              shcore::IShell_core::Mode_mask::any());
+
+  /**
+   * Sets a global object which is created when it's used for the first time.
+   */
+  void set_lazy_global_object(
+      const std::string &name,
+      const std::function<std::shared_ptr<shcore::Cpp_object_bridge>()>
+          &factory,
+      shcore::IShell_core::Mode_mask modes =
+          shcore::IShell_core::Mode_mask::any());
   virtual bool switch_shell_mode(shcore::Shell_core::Mode mode,
                                  const std::vector<std::string> &args,
                                  bool initializing = false,
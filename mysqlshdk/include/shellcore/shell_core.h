@@ -25,6 +25,7 @@
 #define _SHELLCORE_H_
 
 #include <atomic>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <utility>
@@ -166,6 +167,15 @@ class SHCORE_PUBLIC Shell_core : public shcore::IShell_core {
   Value get_global(const std::string &name) override;
   std::vector<std::string> get_global_objects(Mode mode) override;
 
+  /**
+   * Sets a global variable whose value is created on first use: when context
+   * of any of the languages it applies to is created or when it's explicitly
+   * requested with get_global().
+   */
+  void set_lazy_global(const std::string &name,
+                       const std::function<Value()> &factory,
+                       Mode_mask mode = Mode_mask::any());
+
   std::shared_ptr<mysqlsh::ShellBaseSession> set_dev_session(
       const std::shared_ptr<mysqlsh::ShellBaseSession> &session) override;
   std::shared_ptr<mysqlsh::ShellBaseSession> get_dev_session() override;
@@ -225,10 +235,14 @@ class SHCORE_PUBLIC Shell_core : public shcore::IShell_core {
   mysqlsh::IConsole *m_console;
   void init_sql();
   void init_js();
+  void create_lazy_global(const std::string &name);
+  void create_lazy_globals(Mode mode);
 
  private:
   Object_registry *_registry;
   std::map<std::string, std::pair<Mode_mask, Value>> _globals;
+  std::map<std::string, std::pair<Mode_mask, std::function<Value()>>>
+      m_lazy_globals;
   std::map<Mode, Shell_language *> _langs;
 
   Shell_command_handler m_command_handler;
@@ -24,6 +24,13 @@
 #ifndef MYSQLSHDK_INCLUDE_SHELLCORE_SHELL_INIT_H_
 #define MYSQLSHDK_INCLUDE_SHELLCORE_SHELL_INIT_H_
 
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace mysqlsh {
 
 /*
@@ -38,6 +45,77 @@ void global_init();
  */
 void global_end();
 
+/*
+ * Call at the beginning of each additional thread which uses shell library,
+ * initializes thread-specific state of libmysqlclient.
+ */
+void thread_init();
+
+/*
+ * Call at the end of each thread which called thread_init().
+ */
+void thread_end();
+
+/*
+ * Calls thread_init() when created and thread_end() when destroyed.
+ */
+class Mysql_thread final {
+ public:
+  Mysql_thread() { thread_init(); }
+  Mysql_thread(const Mysql_thread &other) = delete;
+  Mysql_thread(Mysql_thread &&other) = delete;
+
+  Mysql_thread &operator=(const Mysql_thread &other) = delete;
+  Mysql_thread &operator=(Mysql_thread &&other) = delete;
+
+  ~Mysql_thread() { thread_end(); }
+};
+
+/*
+ * Number of threads which should be used to process the given number of tasks
+ * concurrently, at least one and at most max_threads.
+ *
+ * Traces of recorded sessions are assigned in the order in which the sessions
+ * connect, which is not deterministic if they are used by multiple threads, so
+ * only one thread is used when sessions are recorded or replayed.
+ */
+std::size_t worker_thread_count(std::size_t max_threads, std::size_t tasks);
+
+/*
+ * Threads which use shell library. Each thread initializes thread-specific
+ * state of libmysqlclient and blocks SIGINT, which is handled by the thread
+ * which started the workers. Threads are joined when destroyed.
+ */
+class Worker_threads final {
+ public:
+  Worker_threads() = default;
+  Worker_threads(const Worker_threads &other) = delete;
+  Worker_threads(Worker_threads &&other) = delete;
+
+  Worker_threads &operator=(const Worker_threads &other) = delete;
+  Worker_threads &operator=(Worker_threads &&other) = delete;
+
+  ~Worker_threads();
+
+  /*
+   * Starts a new thread which calls the given function.
+   */
+  void start(const std::function<void()> &function);
+
+  /*
+   * Waits for all of the threads to finish, rethrows the first exception
+   * thrown by any of them.
+   */
+  void join();
+
+ private:
+  void join_all();
+
+  std::vector<std::thread> m_threads;
+  std::mutex m_mutex;
+  std::exception_ptr m_error;
+};
+
 }  // namespace mysqlsh
 
 #endif  // MYSQLSHDK_INCLUDE_SHELLCORE_SHELL_INIT_H_
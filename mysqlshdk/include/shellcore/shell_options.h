@@ -27,6 +27,7 @@
 #define SN_SHELL_OPTION_CHANGED "SN_SHELL_OPTION_CHANGED"
 
 #define SHCORE_RESULT_FORMAT "resultFormat"
+#define SHCORE_RESULT_PREFETCH_ROWS "resultPrefetchRows"
 #define SHCORE_INTERACTIVE "interactive"
 #define SHCORE_SHOW_WARNINGS "showWarnings"
 #define SHCORE_BATCH_CONTINUE_ON_ERROR "batchContinueOnError"
@@ -99,6 +100,7 @@ class Shell_options : public shcore::Options {
     bool recreate_database = false;
     bool show_warnings = true;
     bool trace_protocol = false;
+    bool debug_startup = false;
     bool log_to_stderr = false;
     bool devapi_schema_object_handles = true;
     bool db_name_cache = true;
@@ -124,6 +126,7 @@ class Shell_options : public shcore::Options {
     std::vector<std::string> import_args;
     std::vector<std::string> import_opts;
     std::string pager;
+    int result_prefetch_rows = 0;
     Quiet_start quiet_start = Quiet_start::NOT_SET;
     bool show_column_type_info = false;
     bool default_compress = false;
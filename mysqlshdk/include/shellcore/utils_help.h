@@ -241,6 +241,13 @@ class Help_registry {
   // Options will be stored on a MAP
   Data_registry m_help_data;
 
+  // Entries registered since the last lookup, most of them are registered
+  // statically at startup and indexing them is deferred until the help
+  // system is actually used
+  std::vector<std::pair<std::string, std::string>> m_pending_help_data;
+
+  void index_help_data();
+
   // Holds all the registered topics
   std::map<size_t, Help_topic> m_topics;
 
@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/mysql/async_query_loop.h"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <poll.h>
+#include <sys/socket.h>
+#include <cerrno>
+#endif
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <mysqld_error.h>
+
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace mysql {
+
+namespace {
+
+#ifdef _WIN32
+constexpr auto k_invalid_socket = INVALID_SOCKET;
+constexpr int k_shutdown_both = SD_BOTH;
+
+int poll(pollfd *fds, size_t nfds, int timeout) {
+  return WSAPoll(fds, static_cast<ULONG>(nfds), timeout);
+}
+#else
+constexpr int k_invalid_socket = -1;
+constexpr int k_shutdown_both = SHUT_RDWR;
+#endif
+
+// how often cancel() is checked while waiting
+constexpr std::chrono::milliseconds k_poll_interval{100};
+
+Error interrupted_error() {
+  return Error("Query execution was interrupted", ER_QUERY_INTERRUPTED,
+               "70100");
+}
+
+Error timeout_error() {
+  return Error(
+      "Query execution was interrupted, maximum statement execution time "
+      "exceeded",
+      ER_QUERY_TIMEOUT, "HY000");
+}
+
+void kill_query(const std::shared_ptr<Session> &session) {
+  try {
+    const auto kill_session = Session::create();
+    kill_session->connect(session->get_connection_options());
+    kill_session->executef("KILL QUERY ?", session->get_connection_id());
+    kill_session->close();
+  } catch (const std::exception &e) {
+    log_warning("Error killing query of connection %s: %s",
+                std::to_string(session->get_connection_id()).c_str(),
+                e.what());
+  }
+}
+
+}  // namespace
+
+struct Async_query_loop::Query {
+  std::shared_ptr<Session> session;
+  std::string sql;
+  Callback callback;
+  std::chrono::milliseconds timeout;
+  Clock::time_point start;
+  Clock::time_point deadline = Clock::time_point::max();
+  bool sent = false;
+  bool done = false;
+};
+
+/**
+ * Shuts down the socket which is being read once the deadline of its query
+ * passes, which makes the blocking read fail.
+ */
+class Async_query_loop::Watchdog final {
+ public:
+  Watchdog() : m_thread([this]() { watch(); }) {}
+
+  Watchdog(const Watchdog &) = delete;
+  Watchdog &operator=(const Watchdog &) = delete;
+
+  ~Watchdog() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+
+    m_condition.notify_one();
+    m_thread.join();
+  }
+
+  void arm(my_socket socket, Clock::time_point deadline) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_socket = socket;
+      m_deadline = deadline;
+      m_expired = false;
+    }
+
+    m_condition.notify_one();
+  }
+
+  /**
+   * @returns true if socket was shut down
+   */
+  bool disarm() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_socket = k_invalid_socket;
+    return m_expired;
+  }
+
+ private:
+  void watch() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_stop) {
+      if (m_socket == k_invalid_socket) {
+        m_condition.wait(lock);
+      } else if (Clock::now() >= m_deadline) {
+        ::shutdown(m_socket, k_shutdown_both);
+        m_socket = k_invalid_socket;
+        m_expired = true;
+      } else {
+        m_condition.wait_until(lock, m_deadline);
+      }
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  my_socket m_socket = k_invalid_socket;
+  Clock::time_point m_deadline;
+  bool m_expired = false;
+  bool m_stop = false;
+  std::thread m_thread;
+};
+
+Async_query_loop::Async_query_loop() = default;
+
+Async_query_loop::~Async_query_loop() {
+  // run() was not called or a callback has thrown, remaining queries fail
+  while (!m_queries.empty()) {
+    try {
+      fail_pending(interrupted_error());
+    } catch (...) {
+      // there's nobody to report the exception to
+    }
+  }
+}
+
+void Async_query_loop::add(const std::shared_ptr<Session> &session,
+                           const std::string &sql, Callback callback,
+                           std::chrono::milliseconds timeout) {
+  if (!session->is_open()) throw std::runtime_error("Not connected");
+
+  for (const auto &query : m_queries) {
+    if (!query->done && query->session == session)
+      throw std::logic_error("Session already has a query in flight");
+  }
+
+  std::unique_ptr<Query> query{new Query()};
+  query->session = session;
+  query->sql = sql;
+  query->callback = std::move(callback);
+  query->timeout = timeout;
+
+  m_queries.emplace_back(std::move(query));
+}
+
+void Async_query_loop::run() {
+  std::vector<pollfd> fds;
+  std::vector<Query *> polled;
+
+  while (!m_queries.empty()) {
+    if (m_cancelled) {
+      fail_pending(interrupted_error());
+      break;
+    }
+
+    auto now = Clock::now();
+    auto wake_up = now + k_poll_interval;
+
+    fds.clear();
+    polled.clear();
+
+    // callbacks may add new queries, list iterators remain valid
+    for (const auto &query : m_queries) {
+      if (!query->done && !query->sent) send(query.get());
+      if (query->done) continue;
+
+      if (query->deadline <= now) {
+        abort(query.get(), timeout_error());
+        continue;
+      }
+
+      const auto fd = query->session->get_socket();
+
+      if (fd == k_invalid_socket) {
+        // i.e. named pipe, result is read in a blocking manner
+        receive(query.get());
+        continue;
+      }
+
+      wake_up = std::min(wake_up, query->deadline);
+      fds.push_back(pollfd{fd, POLLIN, 0});
+      polled.push_back(query.get());
+    }
+
+    if (!fds.empty()) {
+      now = Clock::now();
+      const auto timeout =
+          wake_up > now
+              ? std::chrono::duration_cast<std::chrono::milliseconds>(wake_up -
+                                                                      now)
+                        .count() +
+                    1
+              : 0;
+
+      const int ready =
+          poll(fds.data(), fds.size(), static_cast<int>(timeout));
+
+#ifndef _WIN32
+      if (ready < 0 && errno != EINTR)
+        throw std::runtime_error("poll() failed: " +
+                                 shcore::errno_to_string(errno));
+#endif
+
+      for (size_t i = 0; ready > 0 && i < fds.size(); ++i) {
+        if (fds[i].revents != 0) receive(polled[i]);
+      }
+    }
+
+    m_queries.remove_if(
+        [](const std::unique_ptr<Query> &query) { return query->done; });
+  }
+
+  m_cancelled = false;
+}
+
+void Async_query_loop::send(Query *query) {
+  query->sent = true;
+  query->start = Clock::now();
+
+  if (query->timeout.count() > 0)
+    query->deadline = query->start + query->timeout;
+
+  if (!query->session->supports_async_queries()) {
+    // traffic is recorded or replayed by query()
+    std::shared_ptr<IResult> result;
+
+    try {
+      result = query->session->query(query->sql, true);
+    } catch (...) {
+      finish(query, nullptr, std::current_exception());
+      return;
+    }
+
+    finish(query, std::move(result), nullptr);
+    return;
+  }
+
+  try {
+    query->session->send_query(query->sql);
+  } catch (...) {
+    finish(query, nullptr, std::current_exception());
+  }
+}
+
+void Async_query_loop::receive(Query *query) {
+  std::shared_ptr<Result> result;
+  std::exception_ptr error;
+  const auto fd = query->session->get_socket();
+  const bool watched =
+      fd != k_invalid_socket && query->deadline != Clock::time_point::max();
+
+  if (watched) {
+    // server may stop sending data in the middle of a result
+    if (!m_watchdog) m_watchdog.reset(new Watchdog());
+    m_watchdog->arm(fd, query->deadline);
+  }
+
+  try {
+    result = query->session->read_query_result();
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  if (watched && m_watchdog->disarm()) {
+    abort(query, timeout_error());
+    return;
+  }
+
+  if (error) {
+    finish(query, nullptr, std::move(error));
+    return;
+  }
+
+  result->set_execution_time(
+      std::chrono::duration<double>(Clock::now() - query->start).count());
+  finish(query, std::move(result), nullptr);
+}
+
+void Async_query_loop::fail_pending(const Error &error) {
+  // callbacks may add new queries, these fail as well
+  while (!m_queries.empty()) {
+    const std::unique_ptr<Query> query = std::move(m_queries.front());
+    m_queries.pop_front();
+
+    if (query->done) continue;
+
+    if (query->sent)
+      abort(query.get(), error);
+    else
+      finish(query.get(), nullptr, std::make_exception_ptr(error));
+  }
+}
+
+void Async_query_loop::abort(Query *query, const Error &error) {
+  // closing the connection does not stop the query on the server
+  kill_query(query->session);
+  query->session->close();
+  finish(query, nullptr, std::make_exception_ptr(error));
+}
+
+void Async_query_loop::finish(Query *query, std::shared_ptr<IResult> result,
+                              std::exception_ptr error) {
+  query->done = true;
+  if (query->callback) query->callback(std::move(result), std::move(error));
+}
+
+}  // namespace mysql
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_MYSQL_ASYNC_QUERY_LOOP_H_
+#define MYSQLSHDK_LIBS_DB_MYSQL_ASYNC_QUERY_LOOP_H_
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/libs/db/mysql/session.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace mysql {
+
+/**
+ * Executes queries on many classic sessions from a single thread.
+ *
+ * All queries are sent to their servers at once, then loop waits with poll()
+ * until any of the sockets becomes readable, reading the result of that
+ * session only. Time spent by the servers executing the queries overlaps,
+ * without a thread per session.
+ *
+ * Each session can have one query in flight, and it must not be used by
+ * anything else until its callback is called. Results are buffered before
+ * they are handed to the callback. Callbacks are called from run() and can
+ * add new queries to the loop.
+ *
+ * Query which exceeds its timeout fails with ER_QUERY_TIMEOUT. The query is
+ * killed using a separate connection and its session is closed, as the state
+ * of the connection is unknown at that point. The deadline also applies while
+ * the result is being read, a server which stops sending data in the middle of
+ * a result does not block the loop past the deadline. Results of sessions
+ * which do not use a socket (i.e. named pipe) are read without a time limit.
+ *
+ * Every query added to the loop has its callback called exactly once. Queries
+ * which are still pending when the loop is cancelled or destroyed fail with
+ * ER_QUERY_INTERRUPTED, the ones in flight are killed as well.
+ *
+ * Sessions which record or replay the traffic execute their queries
+ * synchronously, in the order they are sent.
+ */
+class SHCORE_PUBLIC Async_query_loop {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * Receives the result of a query or the exception which was thrown.
+   */
+  using Callback = std::function<void(std::shared_ptr<IResult> result,
+                                      std::exception_ptr error)>;
+
+  Async_query_loop();
+  Async_query_loop(const Async_query_loop &) = delete;
+  Async_query_loop &operator=(const Async_query_loop &) = delete;
+  ~Async_query_loop();
+
+  /**
+   * Schedules a query.
+   *
+   * @param session open session, which is not executing any other query
+   * @param sql query to execute
+   * @param callback called once query completes
+   * @param timeout maximum execution time, 0 means no limit
+   *
+   * @throws std::logic_error if session already has a query in flight
+   * @throws std::runtime_error if session is not open
+   */
+  void add(const std::shared_ptr<Session> &session, const std::string &sql,
+           Callback callback,
+           std::chrono::milliseconds timeout = std::chrono::milliseconds{0});
+
+  /**
+   * Processes the queries until all of them complete, including the ones
+   * added by the callbacks.
+   */
+  void run();
+
+  /**
+   * Makes run() fail all pending queries with ER_QUERY_INTERRUPTED and
+   * return, can be called from any thread. Queries added by the callbacks of
+   * the failed queries fail as well.
+   */
+  void cancel() { m_cancelled = true; }
+
+  size_t pending() const { return m_queries.size(); }
+
+ private:
+  struct Query;
+  class Watchdog;
+
+  void send(Query *query);
+  void receive(Query *query);
+  void fail_pending(const Error &error);
+  void abort(Query *query, const Error &error);
+  void finish(Query *query, std::shared_ptr<IResult> result,
+              std::exception_ptr error);
+
+  std::list<std::unique_ptr<Query>> m_queries;
+  std::atomic<bool> m_cancelled{false};
+  std::unique_ptr<Watchdog> m_watchdog;
+};
+
+}  // namespace mysql
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_MYSQL_ASYNC_QUERY_LOOP_H_
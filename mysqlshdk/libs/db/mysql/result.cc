@@ -23,6 +23,7 @@
 
 #include "mysqlshdk/libs/db/mysql/result.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <utility>
@@ -147,6 +148,8 @@ void Result::fetch_metadata() {
   int num_fields = 0;
 
   _metadata.clear();
+  _column_types.clear();
+  _column_unsigned.clear();
 
   // res could be NULL on queries not returning data
   std::shared_ptr<MYSQL_RES> res = _result.lock();
@@ -167,6 +170,8 @@ void Result::fetch_metadata() {
           static_cast<bool>(fields[index].flags & BINARY_FLAG),
           fieldflags2str(fields[index].flags),
           fieldtype2str(fields[index].type)));
+      _column_types.push_back(_metadata.back().get_type());
+      _column_unsigned.push_back(_metadata.back().is_unsigned());
     }
   }
 }
@@ -192,7 +197,6 @@ const IRow *Result::fetch_one() {
       }
     }
   } else {
-    _row.reset();
     if (has_resultset()) {
       // Loads the first row
       std::shared_ptr<MYSQL_RES> res = _result.lock();
@@ -200,13 +204,13 @@ const IRow *Result::fetch_one() {
       if (res) {
         MYSQL_ROW mysql_row = mysql_fetch_row(res.get());
         if (mysql_row) {
-          unsigned long *lengths;
-          lengths = mysql_fetch_lengths(res.get());
-
-          _row.reset(new Row(this, mysql_row, lengths));
+          // the same object is rebound to every row
+          if (!_row) _row.reset(new Row(this));
+          _row->reset(mysql_row, mysql_fetch_lengths(res.get()));
 
           // Each read row increases the count
           _fetched_row_count++;
+          return _row.get();
         } else {
           if (auto session = _session.lock()) {
             int code = 0;
@@ -219,7 +223,6 @@ const IRow *Result::fetch_one() {
         }
       }
     }
-    return _row.get();
   }
 
   return nullptr;
@@ -380,6 +383,184 @@ Type Result::map_data_type(int raw_type, int flags) {
   }
   throw std::logic_error("Invalid type");
 }
+
+//------------------------------- Stmt_result ----------------------------------
+
+namespace {
+
+// initial size of buffers of string columns, grown when a longer value is
+// fetched
+constexpr unsigned long k_initial_string_buffer = 256;
+
+Error stmt_error(MYSQL_STMT *stmt) {
+  return Error(mysql_stmt_error(stmt), mysql_stmt_errno(stmt),
+               mysql_stmt_sqlstate(stmt));
+}
+
+}  // namespace
+
+Stmt_result::Stmt_result(
+    std::shared_ptr<mysqlshdk::db::mysql::Session_impl> owner,
+    std::shared_ptr<MYSQL_STMT> stmt, bool buffered, uint64_t affected_rows,
+    unsigned int warning_count, uint64_t last_insert_id, const char *info)
+    : Result(owner, affected_rows, warning_count, last_insert_id, info),
+      m_stmt(stmt),
+      m_buffered(buffered) {}
+
+Stmt_result::~Stmt_result() {}
+
+void Stmt_result::bind_result() {
+  m_stmt_row.reset();
+  m_binds.clear();
+  m_columns.clear();
+  m_stmt_metadata.reset();
+
+  const auto stmt = m_stmt.lock();
+  MYSQL_RES *metadata =
+      stmt ? mysql_stmt_result_metadata(stmt.get()) : nullptr;
+
+  if (!metadata) {
+    // statement does not return rows
+    reset(nullptr);
+    return;
+  }
+
+  m_stmt_metadata.reset(metadata, &mysql_free_result);
+
+  if (m_buffered && mysql_stmt_store_result(stmt.get()) != 0)
+    throw stmt_error(stmt.get());
+
+  reset(m_stmt_metadata);
+  fetch_metadata();
+
+  const auto count = mysql_num_fields(metadata);
+  const MYSQL_FIELD *fields = mysql_fetch_fields(metadata);
+
+  m_columns.resize(count);
+  m_binds.resize(count);
+
+  for (unsigned int i = 0; i < count; ++i) {
+    auto &column = m_columns[i];
+    auto &bind = m_binds[i];
+
+    switch (fields[i].type) {
+      case MYSQL_TYPE_YEAR:
+      case MYSQL_TYPE_TINY:
+      case MYSQL_TYPE_SHORT:
+      case MYSQL_TYPE_INT24:
+      case MYSQL_TYPE_LONG:
+      case MYSQL_TYPE_LONGLONG:
+        bind.buffer_type = MYSQL_TYPE_LONGLONG;
+        bind.is_unsigned = (fields[i].flags & UNSIGNED_FLAG) != 0;
+        column.data.resize(sizeof(int64_t));
+        break;
+
+      case MYSQL_TYPE_FLOAT:
+        bind.buffer_type = MYSQL_TYPE_FLOAT;
+        column.data.resize(sizeof(float));
+        break;
+
+      case MYSQL_TYPE_DOUBLE:
+        bind.buffer_type = MYSQL_TYPE_DOUBLE;
+        column.data.resize(sizeof(double));
+        break;
+
+      default:
+        // everything else is fetched as a string, temporal values are
+        // formatted by the client library the same way server does it
+        bind.buffer_type = MYSQL_TYPE_STRING;
+        column.data.resize(
+            std::min<unsigned long>(fields[i].length, k_initial_string_buffer) +
+            1);
+        break;
+    }
+
+    bind.buffer = column.data.data();
+    bind.buffer_length = column.data.size();
+    bind.length = &column.length;
+    bind.is_null = &column.is_null;
+    bind.error = &column.error;
+  }
+
+  if (mysql_stmt_bind_result(stmt.get(), m_binds.data()) != 0)
+    throw stmt_error(stmt.get());
+
+  m_stmt_row.reset(new Stmt_row(*this));
+}
+
+void Stmt_result::fetch_truncated(MYSQL_STMT *stmt) {
+  for (unsigned int i = 0; i < m_columns.size(); ++i) {
+    auto &column = m_columns[i];
+
+    if (!column.error) continue;
+
+    // buffer is kept for the subsequent rows
+    column.data.resize(column.length + 1);
+    m_binds[i].buffer = column.data.data();
+    m_binds[i].buffer_length = column.data.size();
+
+    if (mysql_stmt_fetch_column(stmt, &m_binds[i], i, 0) != 0)
+      throw stmt_error(stmt);
+  }
+
+  if (mysql_stmt_bind_result(stmt, m_binds.data()) != 0)
+    throw stmt_error(stmt);
+}
+
+const IRow *Stmt_result::fetch_one() {
+  if (_pre_fetched) return Result::fetch_one();
+
+  const auto stmt = m_stmt.lock();
+
+  if (!stmt || !has_resultset()) return nullptr;
+
+  switch (mysql_stmt_fetch(stmt.get())) {
+    case 0:
+      break;
+
+    case MYSQL_DATA_TRUNCATED:
+      fetch_truncated(stmt.get());
+      break;
+
+    case MYSQL_NO_DATA:
+      return nullptr;
+
+    default:
+      throw shcore::Exception::mysql_error_with_code_and_state(
+          mysql_stmt_error(stmt.get()), mysql_stmt_errno(stmt.get()),
+          mysql_stmt_sqlstate(stmt.get()));
+  }
+
+  // Each read row increases the count
+  _fetched_row_count++;
+  return m_stmt_row.get();
+}
+
+bool Stmt_result::next_resultset() {
+  _fetched_row_count = 0;
+  _pre_fetched = false;
+  _pre_fetched_rows.clear();
+
+  const auto stmt = m_stmt.lock();
+
+  if (!stmt) return false;
+
+  mysql_stmt_free_result(stmt.get());
+
+  if (mysql_stmt_next_result(stmt.get()) != 0) return false;
+
+  bind_result();
+  return true;
+}
+
+void Stmt_result::rewind() {
+  _fetched_row_count = 0;
+
+  if (!_pre_fetched && m_buffered) {
+    if (const auto stmt = m_stmt.lock()) mysql_stmt_data_seek(stmt.get(), 0);
+  }
+}
+
 }  // namespace mysql
 }  // namespace db
 }  // namespace mysqlshdk
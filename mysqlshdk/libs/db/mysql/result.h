@@ -41,9 +41,11 @@ namespace mysqlshdk {
 namespace db {
 namespace mysql {
 class Session_impl;
+class Row;
 class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
                              public std::enable_shared_from_this<Result> {
   friend class Session_impl;
+  friend class Row;
 
  public:
   virtual ~Result();
@@ -91,7 +93,11 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
 
   std::weak_ptr<mysqlshdk::db::mysql::Session_impl> _session;
   std::vector<Column> _metadata;
-  std::unique_ptr<IRow> _row;
+  // type and unsigned flag of each column, cached for the row accessors
+  std::vector<Type> _column_types;
+  std::vector<bool> _column_unsigned;
+  // reused for all the rows of an unbuffered result
+  std::unique_ptr<Row> _row;
   std::weak_ptr<MYSQL_RES> _result;
   std::vector<std::string> _gtids;
   mutable std::shared_ptr<Field_names> _field_names;
@@ -104,6 +110,46 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   bool _has_resultset = false;
   bool _fetched_warnings = false;
 };
+
+/**
+ * Result of a prepared statement, rows are received in binary protocol and
+ * fetched into buffers bound to the statement.
+ */
+class SHCORE_PUBLIC Stmt_result : public Result {
+  friend class Session_impl;
+  friend class Stmt_row;
+
+ public:
+  ~Stmt_result() override;
+
+  const IRow *fetch_one() override;
+  bool next_resultset() override;
+  void rewind() override;
+
+ protected:
+  Stmt_result(std::shared_ptr<mysqlshdk::db::mysql::Session_impl> owner,
+              std::shared_ptr<MYSQL_STMT> stmt, bool buffered,
+              uint64_t affected_rows, unsigned int warning_count,
+              uint64_t last_insert_id, const char *info);
+
+ private:
+  struct Column_buffer {
+    std::vector<char> data;
+    unsigned long length = 0;
+    bool is_null = false;
+    bool error = false;
+  };
+
+  void bind_result();
+  void fetch_truncated(MYSQL_STMT *stmt);
+
+  std::weak_ptr<MYSQL_STMT> m_stmt;
+  std::shared_ptr<MYSQL_RES> m_stmt_metadata;
+  std::vector<Column_buffer> m_columns;
+  std::vector<MYSQL_BIND> m_binds;
+  std::unique_ptr<IRow> m_stmt_row;
+  bool m_buffered = false;
+};
 }  // namespace mysql
 }  // namespace db
 }  // namespace mysqlshdk
@@ -25,10 +25,12 @@
 #include <cerrno>
 #include <climits>  // C limit constants
 #include <cmath>    // HUGE_VAL
+#include <cstring>
 #include <limits>   // std::numeric_limits
 #include <string>
 #include <utility>
 #include "mysqlshdk/libs/db/mysql/result.h"
+#include "mysqlshdk/libs/utils/fast_dtoa.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 #define bit_uint1korr(A) (*(((uint8_t *)(A))))
@@ -83,15 +85,39 @@ namespace mysqlshdk {
 namespace db {
 namespace mysql {
 
-Row::Row(Result *result, MYSQL_ROW row, const unsigned long *lengths)
-    : _result(*result), _row(row) {
-  // TODO(alfredo) there's actually no need to keep a copy of the lengths list
-  // because it is valid for as long as MYSQL_ROW is and both should become
-  // invalidated when the next row is fetched
-  for (size_t index = 0; index < result->get_metadata().size(); index++)
-    _lengths.push_back(lengths[index]);
+namespace internal {
+
+bool parse_digits(const char *data, size_t length, uint64_t *out) {
+  // up to 19 digits always fit in 64 bits
+  constexpr size_t k_safe_digits = 19;
+
+  if (length == 0 || length > k_safe_digits + 1) return false;
+
+  const size_t safe = length > k_safe_digits ? k_safe_digits : length;
+  uint64_t value = 0;
+
+  for (size_t i = 0; i < safe; ++i) {
+    const unsigned digit = static_cast<unsigned char>(data[i]) - '0';
+    if (digit > 9) return false;
+    value = value * 10 + digit;
+  }
+
+  if (safe < length) {
+    const unsigned digit = static_cast<unsigned char>(data[safe]) - '0';
+    constexpr uint64_t max = (std::numeric_limits<uint64_t>::max)();
+
+    if (digit > 9 || value > (max - digit) / 10) return false;
+    value = value * 10 + digit;
+  }
+
+  *out = value;
+  return true;
 }
 
+}  // namespace internal
+
+Row::Row(Result *result) : _result(*result) {}
+
 #define FIELD_ERROR(index, msg) \
   std::invalid_argument(        \
       shcore::str_format("%s(%u): " msg, __FUNCTION__, index).c_str())
@@ -106,16 +132,19 @@ Row::Row(Result *result, MYSQL_ROW row, const unsigned long *lengths)
       throw FIELD_ERROR(index, "index out of bounds"); \
   } while (0)
 
-#define VALIDATE_TYPE(index, TYPE_CHECK)                                       \
+#define VALIDATE_FIELD(index, IS_NULL, TYPE_CHECK)                             \
   do {                                                                         \
     if (index >= num_fields())                                                 \
       throw FIELD_ERROR(index, "index out of bounds");                         \
-    if (_row[index] == nullptr) throw FIELD_ERROR(index, "field is NULL");     \
+    if (IS_NULL) throw FIELD_ERROR(index, "field is NULL");                    \
     Type ftype = get_type(index);                                              \
     if (!(TYPE_CHECK))                                                         \
       throw FIELD_ERROR1(index, "field type is %s", to_string(ftype).c_str()); \
   } while (0)
 
+#define VALIDATE_TYPE(index, TYPE_CHECK) \
+  VALIDATE_FIELD(index, _row[index] == nullptr, TYPE_CHECK)
+
 bool Row::is_null(uint32_t index) const {
   VALIDATE_INDEX(index);
 
@@ -128,7 +157,7 @@ uint32_t Row::num_fields() const {
 
 Type Row::get_type(uint32_t index) const {
   VALIDATE_INDEX(index);
-  return _result.get_metadata().at(index).get_type();
+  return _result._column_types[index];
 }
 
 std::string Row::get_as_string(uint32_t index) const {
@@ -146,44 +175,45 @@ std::string Row::get_as_string(uint32_t index) const {
 }
 
 int64_t Row::get_int(uint32_t index) const {
-  int64_t ret_val = 0;
-
   VALIDATE_TYPE(index, (ftype == Type::Integer || ftype == Type::UInteger ||
                         (ftype == Type::Decimal && !strchr(_row[index], '.'))));
 
-  if (_result.get_metadata()[index].is_unsigned()) {
-    uint64_t unsigned_val = strtoull(_row[index], nullptr, 10);
+  const char *data = _row[index];
+  const bool negative = data[0] == '-';
+  uint64_t magnitude = 0;
 
-    if ((errno == ERANGE && unsigned_val == ULLONG_MAX) ||
-        unsigned_val > (std::numeric_limits<int64_t>::max)())
+  if (_result._column_unsigned[index]) {
+    if (!internal::parse_digits(data, _lengths[index], &magnitude) ||
+        magnitude > (std::numeric_limits<int64_t>::max)())
       throw FIELD_ERROR(index, "field value exceeds allowed range");
 
-    ret_val = static_cast<int64_t>(unsigned_val);
-  } else {
-    ret_val = strtoll(_row[index], nullptr, 10);
-
-    if (errno == ERANGE && (ret_val == LLONG_MAX || ret_val == LLONG_MIN))
-      throw FIELD_ERROR(index, "field value out of the allowed range");
+    return static_cast<int64_t>(magnitude);
   }
-  return ret_val;
+
+  if (!internal::parse_digits(data + negative, _lengths[index] - negative,
+                              &magnitude) ||
+      magnitude > static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()) +
+                      negative)
+    throw FIELD_ERROR(index, "field value out of the allowed range");
+
+  return negative ? static_cast<int64_t>(0 - magnitude)
+                  : static_cast<int64_t>(magnitude);
 }
 
 uint64_t Row::get_uint(uint32_t index) const {
-  uint64_t ret_val = 0;
-
   VALIDATE_TYPE(index, (ftype == Type::Integer || ftype == Type::UInteger ||
                         (ftype == Type::Decimal && !strchr(_row[index], '.'))));
 
-  if (_result.get_metadata()[index].is_unsigned()) {
-    ret_val = strtoull(_row[index], nullptr, 10);
-    if (ret_val == ULLONG_MAX && errno == ERANGE)
+  uint64_t ret_val = 0;
+
+  if (_result._column_unsigned[index]) {
+    if (!internal::parse_digits(_row[index], _lengths[index], &ret_val))
       throw FIELD_ERROR(index, "field value exceeds allowed range");
   } else {
-    int64_t signed_val = strtoll(_row[index], nullptr, 10);
-    if (signed_val < 0 || (errno == ERANGE && (signed_val == LLONG_MAX ||
-                                               signed_val == LLONG_MIN)))
+    // negative values are rejected by parse_digits()
+    if (!internal::parse_digits(_row[index], _lengths[index], &ret_val) ||
+        ret_val > static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()))
       throw FIELD_ERROR(index, "field value out of the allowed range");
-    ret_val = static_cast<uint64_t>(signed_val);
   }
   return ret_val;
 }
@@ -258,6 +288,225 @@ uint64_t Row::get_bit(uint32_t index) const {
   return uval;
 }
 
+//-------------------------------- Stmt_row ------------------------------------
+
+namespace {
+
+template <typename T>
+T read_buffer(const char *data) {
+  T value;
+  memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+}  // namespace
+
+#define VALIDATE_STMT_TYPE(index, TYPE_CHECK) \
+  VALIDATE_FIELD(index, _result.m_columns[index].is_null, TYPE_CHECK)
+
+Stmt_row::Stmt_row(const Stmt_result &result) : _result(result) {}
+
+const char *Stmt_row::data(uint32_t index) const {
+  return _result.m_columns[index].data.data();
+}
+
+size_t Stmt_row::length(uint32_t index) const {
+  return _result.m_columns[index].length;
+}
+
+enum_field_types Stmt_row::buffer_type(uint32_t index) const {
+  return _result.m_binds[index].buffer_type;
+}
+
+bool Stmt_row::is_null(uint32_t index) const {
+  VALIDATE_INDEX(index);
+
+  return _result.m_columns[index].is_null;
+}
+
+uint32_t Stmt_row::num_fields() const {
+  return static_cast<uint32_t>(_result.get_metadata().size());
+}
+
+Type Stmt_row::get_type(uint32_t index) const {
+  VALIDATE_INDEX(index);
+  return _result.get_metadata().at(index).get_type();
+}
+
+std::string Stmt_row::get_as_string(uint32_t index) const {
+  VALIDATE_INDEX(index);
+  // same as Row::get_as_string()
+  if (_result.m_columns[index].is_null) return "NULL";
+
+  char buffer[32];
+  size_t len;
+
+  switch (buffer_type(index)) {
+    case MYSQL_TYPE_LONGLONG: {
+      std::string value =
+          _result.m_binds[index].is_unsigned
+              ? std::to_string(read_buffer<uint64_t>(data(index)))
+              : std::to_string(read_buffer<int64_t>(data(index)));
+
+      // text protocol pads ZEROFILL (including YEAR) columns with zeros up to
+      // the display width
+      const auto &column = _result.get_metadata()[index];
+
+      if (column.is_zerofill() && value.length() < column.get_length())
+        value.insert(0, column.get_length() - value.length(), '0');
+
+      return value;
+    }
+
+    case MYSQL_TYPE_FLOAT:
+      len = shcore::fast_gcvt(read_buffer<float>(data(index)),
+                              MY_GCVT_ARG_FLOAT, sizeof(buffer) - 1, buffer,
+                              nullptr);
+      return std::string(buffer, len);
+
+    case MYSQL_TYPE_DOUBLE:
+      len = shcore::fast_gcvt(read_buffer<double>(data(index)),
+                              MY_GCVT_ARG_DOUBLE, sizeof(buffer) - 1, buffer,
+                              nullptr);
+      return std::string(buffer, len);
+
+    default:
+      break;
+  }
+
+  if (get_type(index) == Type::Bit)
+    return shcore::bits_to_string(get_bit(index),
+                                  _result.get_metadata()[index].get_length());
+  return std::string(data(index), length(index));
+}
+
+int64_t Stmt_row::get_int(uint32_t index) const {
+  VALIDATE_STMT_TYPE(
+      index, (ftype == Type::Integer || ftype == Type::UInteger ||
+              (ftype == Type::Decimal &&
+               !memchr(data(index), '.', length(index)))));
+
+  if (buffer_type(index) != MYSQL_TYPE_LONGLONG) {
+    // DECIMAL is received as a string
+    errno = 0;
+    const int64_t ret_val =
+        strtoll(std::string(data(index), length(index)).c_str(), nullptr, 10);
+
+    if (errno == ERANGE)
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    return ret_val;
+  }
+
+  if (_result.m_binds[index].is_unsigned) {
+    const uint64_t unsigned_val = read_buffer<uint64_t>(data(index));
+
+    if (unsigned_val > (std::numeric_limits<int64_t>::max)())
+      throw FIELD_ERROR(index, "field value exceeds allowed range");
+
+    return static_cast<int64_t>(unsigned_val);
+  }
+
+  return read_buffer<int64_t>(data(index));
+}
+
+uint64_t Stmt_row::get_uint(uint32_t index) const {
+  VALIDATE_STMT_TYPE(
+      index, (ftype == Type::Integer || ftype == Type::UInteger ||
+              (ftype == Type::Decimal &&
+               !memchr(data(index), '.', length(index)))));
+
+  if (buffer_type(index) != MYSQL_TYPE_LONGLONG) {
+    const std::string value(data(index), length(index));
+    errno = 0;
+    const uint64_t ret_val = strtoull(value.c_str(), nullptr, 10);
+
+    if (errno == ERANGE || value[0] == '-')
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    return ret_val;
+  }
+
+  if (!_result.m_binds[index].is_unsigned) {
+    const int64_t signed_val = read_buffer<int64_t>(data(index));
+
+    if (signed_val < 0)
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+
+    return static_cast<uint64_t>(signed_val);
+  }
+
+  return read_buffer<uint64_t>(data(index));
+}
+
+std::string Stmt_row::get_string(uint32_t index) const {
+  VALIDATE_STMT_TYPE(index, (is_string_type(ftype)));
+
+  return std::string(data(index), length(index));
+}
+
+std::pair<const char *, size_t> Stmt_row::get_string_data(
+    uint32_t index) const {
+  VALIDATE_STMT_TYPE(index, (is_string_type(ftype)));
+  return std::pair<const char *, size_t>(data(index), length(index));
+}
+
+float Stmt_row::get_float(uint32_t index) const {
+  VALIDATE_STMT_TYPE(index, (ftype == Type::Float || ftype == Type::Double ||
+                             ftype == Type::Decimal));
+
+  switch (buffer_type(index)) {
+    case MYSQL_TYPE_FLOAT:
+      return read_buffer<float>(data(index));
+
+    case MYSQL_TYPE_DOUBLE:
+      return static_cast<float>(read_buffer<double>(data(index)));
+
+    default:
+      break;
+  }
+
+  errno = 0;
+  const float ret_val =
+      strtof(std::string(data(index), length(index)).c_str(), nullptr);
+  if (errno == ERANGE && (ret_val == HUGE_VAL || ret_val == -HUGE_VAL))
+    throw FIELD_ERROR(index, "float value out of the allowed range");
+  return ret_val;
+}
+
+double Stmt_row::get_double(uint32_t index) const {
+  VALIDATE_STMT_TYPE(index, (ftype == Type::Float || ftype == Type::Double ||
+                             ftype == Type::Decimal));
+
+  switch (buffer_type(index)) {
+    case MYSQL_TYPE_FLOAT:
+      return read_buffer<float>(data(index));
+
+    case MYSQL_TYPE_DOUBLE:
+      return read_buffer<double>(data(index));
+
+    default:
+      break;
+  }
+
+  errno = 0;
+  const double ret_val =
+      strtod(std::string(data(index), length(index)).c_str(), nullptr);
+  if (errno == ERANGE && (ret_val == HUGE_VAL || ret_val == -HUGE_VAL))
+    throw FIELD_ERROR(index, "double value out of the allowed range");
+  return ret_val;
+}
+
+uint64_t Stmt_row::get_bit(uint32_t index) const {
+  VALIDATE_STMT_TYPE(index, (ftype == Type::Bit));
+  // BIT is received as a big-endian string of up to 8 bytes
+  const auto bytes = reinterpret_cast<const unsigned char *>(data(index));
+  uint64_t uval = 0;
+
+  for (size_t i = 0; i < length(index) && i < 8; ++i)
+    uval = (uval << 8) | bytes[i];
+
+  return uval;
+}
+
 }  // namespace mysql
 }  // namespace db
 }  // namespace mysqlshdk
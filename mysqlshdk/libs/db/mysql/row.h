@@ -39,7 +39,20 @@
 namespace mysqlshdk {
 namespace db {
 namespace mysql {
+namespace internal {
+/**
+ * Parses the decimal digits of an integer received in text protocol (there's
+ * no whitespace, sign is handled by the caller).
+ *
+ * @returns false if value is empty, holds a non-digit character or does not
+ *          fit in 64 bits.
+ */
+bool SHCORE_PUBLIC parse_digits(const char *data, size_t length,
+                                uint64_t *out);
+}  // namespace internal
+
 class Result;
+class Stmt_result;
 class SHCORE_PUBLIC Row : public mysqlshdk::db::IRow {
  public:
   Row(const Row &) = delete;
@@ -62,11 +75,55 @@ class SHCORE_PUBLIC Row : public mysqlshdk::db::IRow {
 
  private:
   friend class Result;
-  Row(Result *result, MYSQL_ROW row, const unsigned long *lengths);
+  explicit Row(Result *result);
+
+  /**
+   * Rebinds this object to the next row, both row and lengths are owned by
+   * the client library and are valid until the next row is fetched.
+   */
+  void reset(MYSQL_ROW row, const unsigned long *lengths) {
+    _row = row;
+    _lengths = lengths;
+  }
 
   Result &_result;
-  MYSQL_ROW _row;
-  std::vector<uint64_t> _lengths;
+  MYSQL_ROW _row = nullptr;
+  const unsigned long *_lengths = nullptr;
+};
+
+/**
+ * Row of a prepared statement, a view of the buffers bound to the statement,
+ * valid until the next row is fetched.
+ */
+class SHCORE_PUBLIC Stmt_row : public mysqlshdk::db::IRow {
+ public:
+  Stmt_row(const Stmt_row &) = delete;
+  void operator=(const Stmt_row &) = delete;
+
+  uint32_t num_fields() const override;
+
+  Type get_type(uint32_t index) const override;
+  bool is_null(uint32_t index) const override;
+  std::string get_as_string(uint32_t index) const override;
+
+  std::string get_string(uint32_t index) const override;
+  int64_t get_int(uint32_t index) const override;
+  uint64_t get_uint(uint32_t index) const override;
+  float get_float(uint32_t index) const override;
+  double get_double(uint32_t index) const override;
+  std::pair<const char *, size_t> get_string_data(
+      uint32_t index) const override;
+  uint64_t get_bit(uint32_t index) const override;
+
+ private:
+  friend class Stmt_result;
+  explicit Stmt_row(const Stmt_result &result);
+
+  const char *data(uint32_t index) const;
+  size_t length(uint32_t index) const;
+  enum_field_types buffer_type(uint32_t index) const;
+
+  const Stmt_result &_result;
 };
 
 }  // namespace mysql
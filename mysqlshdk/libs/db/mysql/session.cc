@@ -28,6 +28,7 @@
 
 #include <mysql_version.h>
 #include "mysqlshdk/libs/utils/profiling.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 #include "utils/utils_general.h"
 
 namespace mysqlshdk {
@@ -213,7 +214,11 @@ bool Session_impl::setup_ssl(
 void Session_impl::close() {
   // This should be logged, for now commenting to
   // avoid having unneeded output on the script mode
-  if (_prev_result) _prev_result.reset();
+  discard_prev_result();
+
+  // statements need to be closed while connection is still valid
+  m_prev_stmt.reset();
+  clear_statement_cache();
 
   if (_mysql) mysql_close(_mysql);
   _mysql = nullptr;
@@ -230,23 +235,27 @@ void Session_impl::execute(const char *sql, size_t len) {
 
 std::shared_ptr<IResult> Session_impl::run_sql(const char *sql, size_t len,
                                                bool buffered) {
-  if (_mysql == nullptr) throw std::runtime_error("Not connected");
   mysqlshdk::utils::Profile_timer timer;
   timer.stage_begin("run_sql");
-  if (_prev_result) {
-    _prev_result.reset();
-  } else {
-    MYSQL_RES *unread_result = mysql_use_result(_mysql);
-    mysql_free_result(unread_result);
-  }
+  send_query(sql, len);
+  auto result = read_query_result(buffered);
+  timer.stage_end();
+  result->set_execution_time(timer.total_seconds_ellapsed());
+  return std::static_pointer_cast<IResult>(result);
+}
 
-  // Discards any pending result
-  while (mysql_next_result(_mysql) == 0) {
-    MYSQL_RES *trailing_result = mysql_use_result(_mysql);
-    mysql_free_result(trailing_result);
+void Session_impl::send_query(const char *sql, size_t len) {
+  if (_mysql == nullptr) throw std::runtime_error("Not connected");
+  discard_results();
+
+  if (mysql_send_query(_mysql, sql, len) != 0) {
+    throw Error(mysql_error(_mysql), mysql_errno(_mysql),
+                mysql_sqlstate(_mysql));
   }
+}
 
-  if (mysql_real_query(_mysql, sql, len) != 0) {
+std::shared_ptr<Result> Session_impl::read_query_result(bool buffered) {
+  if (mysql_read_query_result(_mysql) != 0) {
     throw Error(mysql_error(_mysql), mysql_errno(_mysql),
                 mysql_sqlstate(_mysql));
   }
@@ -257,19 +266,204 @@ std::shared_ptr<IResult> Session_impl::run_sql(const char *sql, size_t len,
                  mysql_info(_mysql)));
 
   prepare_fetch(result.get(), buffered);
+  m_last_result = result;
+  return result;
+}
+
+std::shared_ptr<IResult> Session_impl::query_prepared(
+    const std::string &sql, const std::vector<Stmt_param> &params,
+    bool buffered) {
+  if (_mysql == nullptr) throw std::runtime_error("Not connected");
+  mysqlshdk::utils::Profile_timer timer;
+  timer.stage_begin("query_prepared");
+  discard_results();
+
+  const auto stmt = prepare(sql);
+  const auto count = mysql_stmt_param_count(stmt.get());
+
+  // messages are the same as when placeholders are replaced on the client
+  if (params.size() < count)
+    throw std::invalid_argument(
+        "Insufficient number of values for placeholders in query");
+
+  if (params.size() > count)
+    throw std::invalid_argument(shcore::str_format(
+        "Error formatting SQL query: more arguments than escapes while "
+        "substituting placeholder value at index #%lu",
+        count));
+
+  std::vector<MYSQL_BIND> binds(count);
+
+  for (unsigned long i = 0; i < count; ++i) {
+    const auto &param = params[i];
+    auto &bind = binds[i];
+
+    // buffers are only read by mysql_stmt_execute()
+    switch (param.type) {
+      case Type::Integer:
+        bind.buffer_type = MYSQL_TYPE_LONGLONG;
+        bind.buffer = const_cast<int64_t *>(&param.int_value);
+        break;
+
+      case Type::UInteger:
+        bind.buffer_type = MYSQL_TYPE_LONGLONG;
+        bind.buffer = const_cast<uint64_t *>(&param.uint_value);
+        bind.is_unsigned = true;
+        break;
+
+      case Type::Double:
+        bind.buffer_type = MYSQL_TYPE_DOUBLE;
+        bind.buffer = const_cast<double *>(&param.double_value);
+        break;
+
+      case Type::String:
+        bind.buffer_type = MYSQL_TYPE_STRING;
+        bind.buffer = const_cast<char *>(param.string_value.data());
+        bind.buffer_length = param.string_value.length();
+        break;
+
+      default:
+        bind.buffer_type = MYSQL_TYPE_NULL;
+        break;
+    }
+  }
+
+  if (count > 0 && mysql_stmt_bind_param(stmt.get(), binds.data()) != 0)
+    throw_stmt_error(stmt.get());
+
+  if (mysql_stmt_execute(stmt.get()) != 0) throw_stmt_error(stmt.get());
+
+  // statement may have pending results until next query is executed
+  m_prev_stmt = stmt;
+
+  std::shared_ptr<Stmt_result> result(new Stmt_result(
+      shared_from_this(), stmt, buffered, mysql_stmt_affected_rows(stmt.get()),
+      mysql_warning_count(_mysql), mysql_stmt_insert_id(stmt.get()),
+      mysql_info(_mysql)));
+
+  result->bind_result();
+  m_last_result = result;
   timer.stage_end();
   result->set_execution_time(timer.total_seconds_ellapsed());
   return std::static_pointer_cast<IResult>(result);
 }
 
+std::shared_ptr<MYSQL_STMT> Session_impl::prepare(const std::string &sql) {
+  const auto cached = m_stmt_cache_index.find(sql);
+
+  if (cached != m_stmt_cache_index.end()) {
+    // move to the front of the LRU list
+    m_stmt_cache.splice(m_stmt_cache.begin(), m_stmt_cache, cached->second);
+    return cached->second->second;
+  }
+
+  std::shared_ptr<MYSQL_STMT> stmt(mysql_stmt_init(_mysql),
+                                   &mysql_stmt_close);
+
+  if (!stmt) {
+    throw Error(mysql_error(_mysql), mysql_errno(_mysql),
+                mysql_sqlstate(_mysql));
+  }
+
+  if (mysql_stmt_prepare(stmt.get(), sql.c_str(), sql.length()) != 0)
+    throw_stmt_error(stmt.get());
+
+  if (m_stmt_cache_size > 0) {
+    m_stmt_cache.emplace_front(sql, stmt);
+    m_stmt_cache_index[sql] = m_stmt_cache.begin();
+    trim_statement_cache();
+  }
+
+  return stmt;
+}
+
+void Session_impl::set_statement_cache_size(size_t size) {
+  m_stmt_cache_size = size;
+  trim_statement_cache();
+}
+
+void Session_impl::trim_statement_cache() {
+  // least recently used statements are closed first
+  while (m_stmt_cache.size() > m_stmt_cache_size) {
+    m_stmt_cache_index.erase(m_stmt_cache.back().first);
+    m_stmt_cache.pop_back();
+  }
+}
+
+void Session_impl::clear_statement_cache() {
+  m_stmt_cache_index.clear();
+  m_stmt_cache.clear();
+}
+
+void Session_impl::throw_stmt_error(MYSQL_STMT *stmt) {
+  throw Error(mysql_stmt_error(stmt), mysql_stmt_errno(stmt),
+              mysql_stmt_sqlstate(stmt));
+}
+
+void Session_impl::discard_results() {
+  stop_background_reader();
+
+  if (m_prev_stmt) {
+    mysql_stmt_free_result(m_prev_stmt.get());
+
+    while (mysql_stmt_next_result(m_prev_stmt.get()) == 0)
+      mysql_stmt_free_result(m_prev_stmt.get());
+
+    m_prev_stmt.reset();
+  }
+
+  if (_prev_result) {
+    _prev_result.reset();
+  } else {
+    MYSQL_RES *unread_result = mysql_use_result(_mysql);
+    mysql_free_result(unread_result);
+  }
+
+  // Discards any pending result
+  while (mysql_next_result(_mysql) == 0) {
+    MYSQL_RES *trailing_result = mysql_use_result(_mysql);
+    mysql_free_result(trailing_result);
+  }
+}
+
+bool Session_impl::ping() {
+  if (_mysql == nullptr) return false;
+
+  discard_results();
+  return mysql_ping(_mysql) == 0;
+}
+
+void Session_impl::reset() {
+  if (_mysql == nullptr) throw std::runtime_error("Not connected");
+
+  discard_results();
+  // server deallocates all prepared statements
+  clear_statement_cache();
+
+  if (mysql_reset_connection(_mysql) != 0) {
+    throw Error(mysql_error(_mysql), mysql_errno(_mysql),
+                mysql_sqlstate(_mysql));
+  }
+}
+
 template <class T>
 static void free_result(T *result) {
   mysql_free_result(result);
   result = NULL;
 }
 
+void Session_impl::discard_prev_result() {
+  stop_background_reader();
+  _prev_result.reset();
+}
+
+void Session_impl::stop_background_reader() {
+  if (const auto result = m_last_result.lock())
+    result->stop_background_reader();
+}
+
 bool Session_impl::next_resultset() {
-  if (_prev_result) _prev_result.reset();
+  discard_prev_result();
 
   return mysql_next_result(_mysql) == 0;
 }
@@ -298,7 +492,7 @@ void Session_impl::prepare_fetch(Result *target, bool buffered) {
 }
 
 Session_impl::~Session_impl() {
-  _prev_result.reset();
+  discard_prev_result();
   close();
 }
 
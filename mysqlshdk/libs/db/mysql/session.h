@@ -30,9 +30,12 @@
 #include <mysql.h>
 #include <mysqld_error.h>
 #include <functional>
+#include <list>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/db/connection_options.h"
@@ -42,6 +45,32 @@
 namespace mysqlshdk {
 namespace db {
 namespace mysql {
+
+/**
+ * Default number of prepared statements kept by a session.
+ */
+constexpr size_t k_default_statement_cache_size = 32;
+
+/**
+ * Value bound to a ? placeholder of a prepared statement.
+ */
+struct SHCORE_PUBLIC Stmt_param {
+  Stmt_param() : type(Type::Null) {}
+  explicit Stmt_param(int64_t value) : type(Type::Integer), int_value(value) {}
+  explicit Stmt_param(uint64_t value)
+      : type(Type::UInteger), uint_value(value) {}
+  explicit Stmt_param(double value)
+      : type(Type::Double), double_value(value) {}
+  explicit Stmt_param(const std::string &value)
+      : type(Type::String), string_value(value) {}
+
+  Type type;
+  int64_t int_value = 0;
+  uint64_t uint_value = 0;
+  double double_value = 0.0;
+  std::string string_value;
+};
+
 /*
  * Session implementation for the MySQL protocol.
  *
@@ -53,6 +82,7 @@ namespace mysql {
 class Session_impl : public std::enable_shared_from_this<Session_impl> {
   friend class Session;  // The Session class instantiates this class
   friend class Result;   // The Result class uses some functions of this class
+  friend class Stmt_result;
  public:
   virtual ~Session_impl();
 
@@ -63,12 +93,23 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
   std::shared_ptr<IResult> query(const char *sql, size_t len, bool buffered);
   void execute(const char *sql, size_t len);
 
+  std::shared_ptr<IResult> query_prepared(const std::string &sql,
+                                          const std::vector<Stmt_param> &params,
+                                          bool buffered);
+
+  void set_statement_cache_size(size_t size);
+  size_t get_statement_cache_size() const { return m_stmt_cache_size; }
+  size_t get_cached_statement_count() const { return m_stmt_cache.size(); }
+
   void start_transaction();
   void commit();
   void rollback();
 
   void close();
 
+  bool ping();
+  void reset();
+
   bool next_resultset();
   void prepare_fetch(Result *target, bool buffered);
 
@@ -76,12 +117,12 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
 
   // Utility functions to retriev session status
   uint64_t get_thread_id() {
-    _prev_result.reset();
+    discard_prev_result();
     if (_mysql) return mysql_thread_id(_mysql);
     return 0;
   }
   uint64_t get_protocol_info() {
-    _prev_result.reset();
+    discard_prev_result();
     if (_mysql) return mysql_get_proto_info(_mysql);
     return 0;
   }
@@ -89,22 +130,22 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
     return _mysql ? _mysql->net.compress : false;
   }
   const char *get_connection_info() {
-    _prev_result.reset();
+    discard_prev_result();
     if (_mysql) return mysql_get_host_info(_mysql);
     return nullptr;
   }
   const char *get_server_info() {
-    _prev_result.reset();
+    discard_prev_result();
     if (_mysql) return mysql_get_server_info(_mysql);
     return nullptr;
   }
   const char *get_stats() {
-    _prev_result.reset();
+    discard_prev_result();
     if (_mysql) return mysql_stat(_mysql);
     return nullptr;
   }
   const char *get_ssl_cipher() {
-    _prev_result.reset();
+    discard_prev_result();
     if (_mysql) return mysql_get_ssl_cipher(_mysql);
     return nullptr;
   }
@@ -153,14 +194,34 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
 
   std::shared_ptr<IResult> run_sql(const char *sql, size_t len,
                                    bool lazy_fetch = true);
+  void send_query(const char *sql, size_t len);
+  std::shared_ptr<Result> read_query_result(bool buffered);
+  void discard_results();
+  void discard_prev_result();
+  void stop_background_reader();
+  std::shared_ptr<MYSQL_STMT> prepare(const std::string &sql);
+  void trim_statement_cache();
+  void clear_statement_cache();
+  void throw_stmt_error(MYSQL_STMT *stmt);
   bool setup_ssl(const mysqlshdk::db::Ssl_options &ssl_options) const;
   void throw_on_connection_fail();
   std::string _uri;
   MYSQL *_mysql;
 
   std::shared_ptr<MYSQL_RES> _prev_result;
+  // result of the last query, its rows may be read in the background
+  std::weak_ptr<IResult> m_last_result;
+  // statement whose result was not yet fully read
+  std::shared_ptr<MYSQL_STMT> m_prev_stmt;
   mysqlshdk::db::Connection_options _connection_options;
   std::unique_ptr<Error> m_last_error;
+
+  // prepared statements, most recently used first
+  using Stmt_cache =
+      std::list<std::pair<std::string, std::shared_ptr<MYSQL_STMT>>>;
+  Stmt_cache m_stmt_cache;
+  std::unordered_map<std::string, Stmt_cache::iterator> m_stmt_cache_index;
+  size_t m_stmt_cache_size = k_default_statement_cache_size;
 };
 
 class SHCORE_PUBLIC Session : public ISession,
@@ -190,7 +251,66 @@ class SHCORE_PUBLIC Session : public ISession,
     _impl->execute(sql, len);
   }
 
+  /**
+   * Executes a statement as a server side prepared statement
+   * (COM_STMT_PREPARE/COM_STMT_EXECUTE), binding the given values to its ?
+   * placeholders. Rows are transferred using the binary protocol.
+   *
+   * Prepared statements are kept in a per-session LRU cache keyed by the SQL
+   * text, repeated executions of the same statement only send the values.
+   *
+   * @throws std::invalid_argument if number of values does not match the
+   *         number of placeholders.
+   * @throws Error if statement cannot be prepared or executed, error code is
+   *         ER_UNSUPPORTED_PS if statement is not supported by the server.
+   */
+  virtual std::shared_ptr<IResult> query_prepared(
+      const std::string &sql, const std::vector<Stmt_param> &params,
+      bool buffered = false) {
+    return _impl->query_prepared(sql, params, buffered);
+  }
+
+  /**
+   * Sessions which record or replay the traffic only support text queries.
+   */
+  virtual bool supports_prepared_statements() const { return true; }
+
+  /**
+   * Sessions which record or replay the traffic execute the queries of
+   * Async_query_loop synchronously, using query().
+   */
+  virtual bool supports_async_queries() const { return true; }
+
+  /**
+   * Sets the max number of statements kept prepared by this session, least
+   * recently used ones are closed first. 0 disables the cache.
+   */
+  void set_statement_cache_size(size_t size) {
+    _impl->set_statement_cache_size(size);
+  }
+
+  size_t get_statement_cache_size() const {
+    return _impl->get_statement_cache_size();
+  }
+
+  size_t get_cached_statement_count() const {
+    return _impl->get_cached_statement_count();
+  }
+
   void close() override { _impl->close(); }
+
+  /**
+   * Checks if the connection to the server is still alive (COM_PING).
+   */
+  virtual bool ping() { return _impl->ping(); }
+
+  /**
+   * Resets the state of the session (COM_RESET_CONNECTION): rolls back the
+   * active transaction, drops temporary tables, releases locks and clears
+   * the session variables, without re-authenticating.
+   */
+  virtual void reset() { _impl->reset(); }
+
   const char *get_ssl_cipher() const override {
     return _impl->get_ssl_cipher();
   }
@@ -227,6 +347,18 @@ class SHCORE_PUBLIC Session : public ISession,
   Session() { _impl.reset(new Session_impl()); }
 
  private:
+  friend class Async_query_loop;
+
+  void send_query(const std::string &sql) {
+    _impl->send_query(sql.c_str(), sql.length());
+  }
+
+  std::shared_ptr<Result> read_query_result() {
+    return _impl->read_query_result(true);
+  }
+
+  my_socket get_socket() const { return _impl->_mysql->net.fd; }
+
   std::shared_ptr<Session_impl> _impl;
 };
 
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/mysql/session_pool.h"
+
+#include <iterator>
+#include <utility>
+
+#include "mysqlshdk/libs/db/replay/setup.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace mysql {
+
+std::shared_ptr<Session_pool> Session_pool::get() {
+  static std::shared_ptr<Session_pool> pool = std::make_shared<Session_pool>();
+  return pool;
+}
+
+Session_pool::~Session_pool() { clear(); }
+
+std::shared_ptr<Session> Session_pool::open_session(
+    const mysqlshdk::db::Connection_options &copts) {
+  // COM_PING and COM_RESET_CONNECTION are not part of the session traces,
+  // while recording or replaying every caller gets a new session
+  if (replay::g_replay_mode != replay::Mode::Direct) {
+    auto session = Session::create();
+    session->connect(copts);
+    return session;
+  }
+
+  const auto key = copts.as_uri(uri::formats::full());
+  std::shared_ptr<Session> session;
+
+  {
+    std::list<Idle_session> expired;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    expire(Clock::now(), &expired);
+
+    for (auto it = m_idle.begin(); it != m_idle.end(); ++it) {
+      if (it->key == key) {
+        session = std::move(it->session);
+        m_idle.erase(it);
+        break;
+      }
+    }
+  }
+
+  if (session && !session->ping()) {
+    log_debug("Discarding pooled session to %s, ping failed",
+              copts.uri_endpoint().c_str());
+    session.reset();
+  }
+
+  if (!session) {
+    session = Session::create();
+    session->connect(copts);
+  }
+
+  // session goes back to the pool when the last reference is released
+  std::weak_ptr<Session_pool> weak_pool = shared_from_this();
+  std::shared_ptr<void> lease(nullptr, [weak_pool, key, session](void *) {
+    if (const auto pool = weak_pool.lock()) pool->release(key, session);
+  });
+
+  return std::shared_ptr<Session>(lease, session.get());
+}
+
+void Session_pool::release(const std::string &key,
+                           const std::shared_ptr<Session> &session) {
+  if (!session->is_open()) return;
+
+  try {
+    session->reset();
+  } catch (const std::exception &e) {
+    log_debug("Discarding pooled session, reset failed: %s", e.what());
+    return;
+  }
+
+  std::list<Idle_session> expired;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto now = Clock::now();
+
+  expire(now, &expired);
+  m_idle.push_front({key, session, now});
+
+  if (m_idle.size() > m_max_idle_sessions) {
+    expired.splice(expired.end(), m_idle,
+                   std::next(m_idle.begin(), m_max_idle_sessions),
+                   m_idle.end());
+  }
+}
+
+void Session_pool::expire(Clock::time_point now,
+                          std::list<Idle_session> *expired) {
+  // list is sorted by the release time, oldest sessions are at the back
+  auto it = m_idle.end();
+
+  while (it != m_idle.begin() && now - std::prev(it)->since > m_idle_timeout)
+    --it;
+
+  expired->splice(expired->end(), m_idle, it, m_idle.end());
+}
+
+void Session_pool::set_idle_timeout(std::chrono::milliseconds timeout) {
+  std::list<Idle_session> expired;
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_idle_timeout = timeout;
+  expire(Clock::now(), &expired);
+}
+
+void Session_pool::set_max_idle_sessions(size_t max) {
+  std::list<Idle_session> expired;
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_max_idle_sessions = max;
+
+  if (m_idle.size() > m_max_idle_sessions) {
+    expired.splice(expired.end(), m_idle,
+                   std::next(m_idle.begin(), m_max_idle_sessions),
+                   m_idle.end());
+  }
+}
+
+size_t Session_pool::idle_sessions() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_idle.size();
+}
+
+void Session_pool::clear() {
+  std::list<Idle_session> idle;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    idle.swap(m_idle);
+  }
+
+  for (auto &s : idle) s.session->close();
+}
+
+}  // namespace mysql
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_MYSQL_SESSION_POOL_H_
+#define MYSQLSHDK_LIBS_DB_MYSQL_SESSION_POOL_H_
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace mysql {
+
+/**
+ * Process-wide pool of idle classic sessions.
+ *
+ * Sessions are keyed by the endpoint and all of the login and SSL options
+ * used to open them, a session is never handed out to a caller which uses
+ * different credentials.
+ *
+ * A session obtained from the pool goes back to it once its last reference is
+ * released: its state is reset with COM_RESET_CONNECTION and it's kept
+ * idle for a while. Idle sessions are checked with COM_PING before they are
+ * reused. Sessions which were explicitly closed by the caller or which fail
+ * any of the checks are discarded.
+ *
+ * Sessions are not pooled while sessions are being recorded or replayed.
+ */
+class SHCORE_PUBLIC Session_pool
+    : public std::enable_shared_from_this<Session_pool> {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static std::shared_ptr<Session_pool> get();
+
+  Session_pool() = default;
+  Session_pool(const Session_pool &) = delete;
+  Session_pool &operator=(const Session_pool &) = delete;
+  ~Session_pool();
+
+  /**
+   * Provides an open session to the given server, reusing an idle session
+   * if possible.
+   *
+   * @throws mysqlshdk::db::Error if new session cannot be opened
+   */
+  std::shared_ptr<Session> open_session(
+      const mysqlshdk::db::Connection_options &copts);
+
+  /**
+   * Idle sessions older than this are closed.
+   */
+  void set_idle_timeout(std::chrono::milliseconds timeout);
+
+  /**
+   * Maximum number of idle sessions kept by the pool, the oldest ones are
+   * closed first.
+   */
+  void set_max_idle_sessions(size_t max);
+
+  size_t idle_sessions() const;
+
+  /**
+   * Closes all the idle sessions.
+   */
+  void clear();
+
+ private:
+  struct Idle_session {
+    std::string key;
+    std::shared_ptr<Session> session;
+    Clock::time_point since;
+  };
+
+  void release(const std::string &key, const std::shared_ptr<Session> &session);
+
+  // moves the expired sessions to the given list, needs to be called with
+  // the mutex held
+  void expire(Clock::time_point now, std::list<Idle_session> *expired);
+
+  mutable std::mutex m_mutex;
+  // most recently released sessions are at the front
+  std::list<Idle_session> m_idle;
+  std::chrono::milliseconds m_idle_timeout = std::chrono::seconds(60);
+  size_t m_max_idle_sessions = 32;
+};
+
+/**
+ * Opens a session using the process-wide session pool.
+ */
+inline std::shared_ptr<Session> open_pooled_session(
+    const mysqlshdk::db::Connection_options &copts) {
+  return Session_pool::get()->open_session(copts);
+}
+
+}  // namespace mysql
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_MYSQL_SESSION_POOL_H_
@@ -359,6 +359,7 @@ void XSession_impl::close() {
   // This should be logged, for now commenting to
   // avoid having unneeded output on the script mode
   if (auto result = _prev_result.lock()) {
+    result->stop_background_reader();
     while (result->next_resultset()) {
     }
   }
@@ -388,6 +389,9 @@ void XSession_impl::close() {
 void XSession_impl::enable_trace(bool flag) {
   _enable_trace = flag;
   if (_mysql) {
+    // message handlers are called by the thread reading the rows
+    if (auto result = _prev_result.lock()) result->stop_background_reader();
+
     if (flag) {
       if (_trace_handler.first == 0 && _trace_handler.second == 0)
         _trace_handler = do_enable_trace(_mysql.get());
@@ -424,6 +428,7 @@ void XSession_impl::load_session_info() {
 XSession_impl::~XSession_impl() {
   DEBUG_OBJ_DEALLOC(db_mysqlx_Session);
 
+  if (auto result = _prev_result.lock()) result->stop_background_reader();
   _prev_result.reset();
   close();
 }
@@ -432,6 +437,8 @@ void XSession_impl::before_query() {
   if (!_mysql) throw std::logic_error("Not connected");
 
   if (auto result = _prev_result.lock()) {
+    result->stop_background_reader();
+
     if (result->has_resultset()) {
       // buffer the previous result to remove it from the connection
       // in case it's still active
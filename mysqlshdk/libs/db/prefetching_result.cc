@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/prefetching_result.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "shellcore/interrupt_handler.h"
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * Reads rows in a background thread into a bounded single-producer,
+ * single-consumer ring buffer. Positions in the ring are atomic, so passing a
+ * row between the threads does not take a lock, mutex is only used to sleep
+ * when the buffer is full (producer) or empty (consumer).
+ */
+class Prefetching_result::Reader final {
+ public:
+  Reader(IResult *result, size_t capacity)
+      : m_result(result), m_ring(capacity + 1) {
+    m_thread.start([this]() { run(); });
+  }
+
+  Reader(const Reader &) = delete;
+  Reader(Reader &&) = delete;
+
+  Reader &operator=(const Reader &) = delete;
+  Reader &operator=(Reader &&) = delete;
+
+  ~Reader() { stop(); }
+
+  const IRow *fetch_one() {
+    for (;;) {
+      const auto head = m_head.load();
+
+      if (head != m_tail.load()) {
+        // copy shares the data, slot can be overwritten by the producer
+        m_current = m_ring[head];
+        m_head.store(next(head));
+        wake(m_producer_waiting);
+        return &m_current;
+      }
+
+      if (m_done.load()) {
+        // producer could have pushed the last row before finishing
+        if (head != m_tail.load()) continue;
+        break;
+      }
+
+      wait(&m_consumer_waiting,
+           [this, head]() { return head != m_tail.load() || m_done.load(); });
+    }
+
+    if (m_error) {
+      const auto error = m_error;
+      m_error = nullptr;
+      m_eof = true;
+      std::rethrow_exception(error);
+    }
+
+    // thread was stopped before it reached the end of the result
+    return m_eof ? nullptr : m_result->fetch_one();
+  }
+
+  /**
+   * Stops the thread, waits until it finishes. Rows which were already read
+   * are still returned by fetch_one().
+   */
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+
+    // run() does not throw
+    m_thread.join();
+  }
+
+  bool is_running() const { return !m_done.load(); }
+
+  /**
+   * Moves rows which were read, but not fetched yet, to the given vector.
+   * Thread needs to be stopped first.
+   */
+  void take_pending(std::vector<Row_copy> *rows) {
+    for (auto head = m_head.load(); head != m_tail.load(); head = next(head))
+      rows->emplace_back(m_ring[head]);
+
+    m_head.store(m_tail.load());
+  }
+
+ private:
+  size_t next(size_t position) const {
+    return (position + 1) % m_ring.size();
+  }
+
+  void run() {
+    try {
+      while (!m_stop.load()) {
+        const auto tail = m_tail.load();
+
+        if (next(tail) == m_head.load()) {
+          wait(&m_producer_waiting, [this, tail]() {
+            return next(tail) != m_head.load() || m_stop.load();
+          });
+          continue;
+        }
+
+        const auto row = m_result->fetch_one();
+
+        if (!row) {
+          m_eof = true;
+          break;
+        }
+
+        m_ring[tail] = Row_copy(*row);
+        m_tail.store(next(tail));
+        wake(m_consumer_waiting);
+      }
+    } catch (...) {
+      m_error = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_done = true;
+    }
+    m_cv.notify_all();
+  }
+
+  template <class Predicate>
+  void wait(std::atomic<bool> *waiting, Predicate ready) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // the other thread checks this flag after it has moved its position, so
+    // either it sees the flag and notifies or the predicate sees the new
+    // position
+    waiting->store(true);
+    m_cv.wait(lock, ready);
+    waiting->store(false);
+  }
+
+  void wake(const std::atomic<bool> &waiting) {
+    if (waiting.load()) {
+      { std::lock_guard<std::mutex> lock(m_mutex); }
+      m_cv.notify_all();
+    }
+  }
+
+  IResult *m_result;
+
+  std::vector<Row_copy> m_ring;
+  // next slot to be read by the consumer
+  std::atomic<size_t> m_head{0};
+  // next slot to be written by the producer
+  std::atomic<size_t> m_tail{0};
+
+  std::atomic<bool> m_stop{false};
+  // set when producer is not going to push any more rows, m_eof and m_error
+  // are written before it
+  std::atomic<bool> m_done{false};
+  bool m_eof = false;
+  std::exception_ptr m_error;
+
+  std::atomic<bool> m_consumer_waiting{false};
+  std::atomic<bool> m_producer_waiting{false};
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+
+  // row returned to the consumer, valid until the next call to fetch_one()
+  Row_copy m_current;
+
+  // initializes libmysqlclient and blocks SIGINT in the thread
+  mysqlsh::Worker_threads m_thread;
+};
+
+Prefetching_result::Prefetching_result(const std::shared_ptr<IResult> &result,
+                                       size_t capacity)
+    : m_result(result), m_capacity(capacity > 0 ? capacity : 1) {
+  set_execution_time(m_result->get_execution_time());
+  m_has_resultset = m_result->has_resultset();
+  start_reader();
+}
+
+Prefetching_result::~Prefetching_result() {
+  m_result->set_background_reader(nullptr);
+  m_reader.reset();
+}
+
+void Prefetching_result::start_reader() {
+  if (!m_has_resultset) return;
+
+  m_reader.reset(new Reader(m_result.get(), m_capacity));
+  m_result->set_background_reader([this]() { stop_reader(); });
+}
+
+void Prefetching_result::stop_reader() const {
+  if (m_reader) m_reader->stop();
+}
+
+bool Prefetching_result::is_reading() const {
+  return m_reader && m_reader->is_running();
+}
+
+const IRow *Prefetching_result::fetch_one() {
+  const IRow *row = nullptr;
+
+  if (m_buffered) {
+    if (m_next_buffered_row < m_buffered_rows.size())
+      row = &m_buffered_rows[m_next_buffered_row++];
+  } else if (m_reader) {
+    row = m_reader->fetch_one();
+  } else {
+    row = m_result->fetch_one();
+  }
+
+  if (row) ++m_fetched_row_count;
+
+  return row;
+}
+
+bool Prefetching_result::next_resultset() {
+  stop_reader();
+  m_reader.reset();
+  m_buffered = false;
+  m_buffered_rows.clear();
+  m_next_buffered_row = 0;
+  m_fetched_row_count = 0;
+
+  const auto ret = m_result->next_resultset();
+
+  m_has_resultset = m_result->has_resultset();
+  start_reader();
+
+  return ret;
+}
+
+std::unique_ptr<Warning> Prefetching_result::fetch_one_warning() {
+  stop_reader();
+  return m_result->fetch_one_warning();
+}
+
+int64_t Prefetching_result::get_auto_increment_value() const {
+  stop_reader();
+  return m_result->get_auto_increment_value();
+}
+
+uint64_t Prefetching_result::get_affected_row_count() const {
+  stop_reader();
+  return m_result->get_affected_row_count();
+}
+
+uint64_t Prefetching_result::get_warning_count() const {
+  stop_reader();
+  return m_result->get_warning_count();
+}
+
+std::string Prefetching_result::get_info() const {
+  stop_reader();
+  return m_result->get_info();
+}
+
+const std::vector<std::string> &Prefetching_result::get_gtids() const {
+  stop_reader();
+  return m_result->get_gtids();
+}
+
+std::shared_ptr<Field_names> Prefetching_result::field_names() const {
+  stop_reader();
+  return m_result->field_names();
+}
+
+void Prefetching_result::buffer() {
+  if (m_buffered) return;
+
+  stop_reader();
+
+  if (m_reader) m_reader->take_pending(&m_buffered_rows);
+
+  std::atomic<bool> interrupted{false};
+  shcore::Interrupt_handler intr([&interrupted]() {
+    interrupted = true;
+    return false;
+  });
+
+  while (!interrupted) {
+    const auto row = m_reader ? m_reader->fetch_one() : m_result->fetch_one();
+    if (!row) break;
+    m_buffered_rows.emplace_back(*row);
+  }
+
+  m_buffered = true;
+  m_next_buffered_row = 0;
+  m_fetched_row_count = 0;
+}
+
+void Prefetching_result::rewind() {
+  if (!m_buffered) return;
+
+  m_next_buffered_row = 0;
+  m_fetched_row_count = 0;
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
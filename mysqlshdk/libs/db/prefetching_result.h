@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_PREFETCHING_RESULT_H_
+#define MYSQLSHDK_LIBS_DB_PREFETCHING_RESULT_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/result.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * Result which reads and copies the rows of another result ahead in a
+ * background thread, so that network latency and decoding of the rows overlap
+ * with the processing done by the caller.
+ *
+ * Thread stops once the queue of rows which were read ahead is full and
+ * resumes when the caller fetches a row. It is also stopped when any other
+ * information is requested from the result and when the session which owns the
+ * connection is used for anything else (see
+ * IResult::set_background_reader()). No rows are lost when the thread stops:
+ * the ones which were read ahead are returned first, the remaining ones are
+ * read directly from the wrapped result.
+ *
+ * Must be used from a single thread, only fetch_one() and get_metadata() do
+ * not stop the background thread.
+ */
+class SHCORE_PUBLIC Prefetching_result : public IResult {
+ public:
+  /**
+   * Starts reading the rows of the given result in the background.
+   *
+   * @param result result to read the rows from, should not be used by the
+   *        caller while this object exists
+   * @param capacity maximum number of rows which are read ahead
+   */
+  Prefetching_result(const std::shared_ptr<IResult> &result, size_t capacity);
+
+  Prefetching_result(const Prefetching_result &) = delete;
+  Prefetching_result(Prefetching_result &&) = delete;
+
+  Prefetching_result &operator=(const Prefetching_result &) = delete;
+  Prefetching_result &operator=(Prefetching_result &&) = delete;
+
+  ~Prefetching_result() override;
+
+  const IRow *fetch_one() override;
+
+  /**
+   * Discards the rows which were read ahead and moves to the next result set,
+   * rows of which are also read in the background.
+   */
+  bool next_resultset() override;
+
+  std::unique_ptr<Warning> fetch_one_warning() override;
+
+  int64_t get_auto_increment_value() const override;
+  bool has_resultset() override { return m_has_resultset; }
+
+  uint64_t get_affected_row_count() const override;
+  uint64_t get_fetched_row_count() const override {
+    return m_fetched_row_count;
+  }
+  uint64_t get_warning_count() const override;
+  std::string get_info() const override;
+  const std::vector<std::string> &get_gtids() const override;
+
+  const std::vector<Column> &get_metadata() const override {
+    return m_result->get_metadata();
+  }
+  std::shared_ptr<Field_names> field_names() const override;
+
+  /**
+   * Stops the background thread and reads all the remaining rows of the
+   * current result set into memory.
+   */
+  void buffer() override;
+
+  /**
+   * Moves back to the first row which was buffered, does nothing if buffer()
+   * was not called.
+   */
+  void rewind() override;
+
+  /**
+   * Returns true if rows are currently being read in the background.
+   */
+  bool is_reading() const;
+
+ private:
+  class Reader;
+
+  void start_reader();
+  void stop_reader() const;
+
+  std::shared_ptr<IResult> m_result;
+  size_t m_capacity;
+  std::unique_ptr<Reader> m_reader;
+  bool m_has_resultset = false;
+  uint64_t m_fetched_row_count = 0;
+
+  bool m_buffered = false;
+  std::vector<Row_copy> m_buffered_rows;
+  size_t m_next_buffered_row = 0;
+};
+
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_PREFETCHING_RESULT_H_
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/replay/binary_trace.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace mysqlshdk {
+namespace db {
+namespace replay {
+
+const char k_binary_trace_magic[] = "MYSQLSH-TRACE\x01\n";
+const size_t k_binary_trace_magic_length = sizeof(k_binary_trace_magic) - 1;
+
+namespace {
+
+enum Tag : char {
+  k_null = 'N',
+  k_false = 'F',
+  k_true = 'T',
+  k_int = 'i',
+  k_uint = 'u',
+  k_double = 'd',
+  k_string = 's',
+  k_array = 'a',
+  k_object = 'o'
+};
+
+// trace entries are shallow, anything deeper than this is garbage
+constexpr int k_max_depth = 64;
+
+void put_varint(std::string *out, uint64_t value) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+inline uint64_t zigzag_encode(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t zigzag_decode(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+}  // namespace
+
+bool is_binary_trace(const std::string &path) {
+  std::FILE *file = std::fopen(path.c_str(), "rb");
+  if (!file) return false;
+
+  char header[sizeof(k_binary_trace_magic)];
+  bool binary =
+      std::fread(header, 1, k_binary_trace_magic_length, file) ==
+          k_binary_trace_magic_length &&
+      memcmp(header, k_binary_trace_magic, k_binary_trace_magic_length) == 0;
+  std::fclose(file);
+  return binary;
+}
+
+// ------------------------------------------------
+
+Binary_trace_writer::Binary_trace_writer(const std::string &path)
+    : _path(path) {
+  _file = std::fopen(path.c_str(), "wb");
+  if (!_file) throw std::logic_error(path + ": " + strerror(errno));
+
+  try {
+    write_bytes(k_binary_trace_magic, k_binary_trace_magic_length);
+    flush();
+  } catch (...) {
+    std::fclose(_file);
+    _file = nullptr;
+    throw;
+  }
+}
+
+Binary_trace_writer::~Binary_trace_writer() {
+  if (_file) std::fclose(_file);
+}
+
+void Binary_trace_writer::write(const rapidjson::Value &entry) {
+  _buffer.clear();
+  encode(entry);
+
+  std::string length;
+  put_varint(&length, _buffer.size());
+  write_bytes(length.data(), length.size());
+  write_bytes(_buffer.data(), _buffer.size());
+  // flush once per entry (instead of once per character as in the unbuffered
+  // JSON stream), so traces of processes that get killed remain usable
+  flush();
+  ++_count;
+}
+
+void Binary_trace_writer::write_bytes(const char *data, size_t length) {
+  if (std::fwrite(data, 1, length, _file) != length)
+    throw std::logic_error(_path + ": " + strerror(errno));
+}
+
+void Binary_trace_writer::flush() {
+  if (std::fflush(_file) != 0)
+    throw std::logic_error(_path + ": " + strerror(errno));
+}
+
+void Binary_trace_writer::encode_key(const char *key, size_t length) {
+  auto it = _keys.find(std::string(key, length));
+  if (it != _keys.end()) {
+    put_varint(&_buffer, it->second);
+  } else {
+    // 0 means a new key follows, which gets the next index
+    put_varint(&_buffer, 0);
+    put_varint(&_buffer, length);
+    _buffer.append(key, length);
+    _keys.emplace(std::string(key, length), _keys.size() + 1);
+  }
+}
+
+void Binary_trace_writer::encode(const rapidjson::Value &value) {
+  if (value.IsNull()) {
+    _buffer.push_back(k_null);
+  } else if (value.IsBool()) {
+    _buffer.push_back(value.GetBool() ? k_true : k_false);
+  } else if (value.IsDouble()) {
+    double d = value.GetDouble();
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    _buffer.push_back(k_double);
+    for (int i = 0; i < 8; ++i) {
+      _buffer.push_back(static_cast<char>(bits & 0xff));
+      bits >>= 8;
+    }
+  } else if (value.IsInt64()) {
+    _buffer.push_back(k_int);
+    put_varint(&_buffer, zigzag_encode(value.GetInt64()));
+  } else if (value.IsUint64()) {
+    _buffer.push_back(k_uint);
+    put_varint(&_buffer, value.GetUint64());
+  } else if (value.IsString()) {
+    _buffer.push_back(k_string);
+    put_varint(&_buffer, value.GetStringLength());
+    _buffer.append(value.GetString(), value.GetStringLength());
+  } else if (value.IsArray()) {
+    _buffer.push_back(k_array);
+    put_varint(&_buffer, value.Size());
+    for (const auto &item : value.GetArray()) encode(item);
+  } else if (value.IsObject()) {
+    _buffer.push_back(k_object);
+    put_varint(&_buffer, value.MemberCount());
+    for (const auto &member : value.GetObject()) {
+      encode_key(member.name.GetString(), member.name.GetStringLength());
+      encode(member.value);
+    }
+  } else {
+    throw std::logic_error("Unsupported value type in binary trace");
+  }
+}
+
+// ------------------------------------------------
+
+Binary_trace_reader::Binary_trace_reader(const std::string &path)
+    : _path(path) {
+  _file = std::fopen(path.c_str(), "rb");
+  if (!_file) throw std::logic_error(path + ": " + strerror(errno));
+
+  char header[sizeof(k_binary_trace_magic)];
+  if (std::fread(header, 1, k_binary_trace_magic_length, _file) !=
+          k_binary_trace_magic_length ||
+      memcmp(header, k_binary_trace_magic, k_binary_trace_magic_length) != 0) {
+    std::fclose(_file);
+    _file = nullptr;
+    throw std::logic_error(path + ": not a binary session trace");
+  }
+
+  if (std::fseek(_file, 0, SEEK_END) == 0) {
+    const long size = std::ftell(_file);
+    if (size > 0) _size = static_cast<uint64_t>(size);
+  }
+  std::fseek(_file, k_binary_trace_magic_length, SEEK_SET);
+}
+
+Binary_trace_reader::~Binary_trace_reader() {
+  if (_file) std::fclose(_file);
+}
+
+bool Binary_trace_reader::next(rapidjson::Document *doc) {
+  uint64_t length = 0;
+  int shift = 0;
+  for (;;) {
+    int c = std::fgetc(_file);
+
+    if (c == EOF) {
+      if (std::ferror(_file))
+        throw std::logic_error(_path + ": " + strerror(errno));
+      // end of file is only expected between records, a partial length
+      // prefix means the trace was truncated while writing
+      if (shift == 0) return false;
+      throw std::logic_error(_path + ": corrupted binary trace");
+    }
+
+    length |= static_cast<uint64_t>(c & 0x7f) << shift;
+    if ((c & 0x80) == 0) break;
+    shift += 7;
+    if (shift > 63) throw std::logic_error(_path + ": corrupted binary trace");
+  }
+
+  // don't trust the length before it's known that the data is there
+  const long position = std::ftell(_file);
+  if (position < 0 || length > _size - static_cast<uint64_t>(position))
+    throw std::logic_error(_path + ": corrupted binary trace");
+
+  _buffer.resize(length);
+  if (std::fread(&_buffer[0], 1, length, _file) != length)
+    throw std::logic_error(_path + ": corrupted binary trace");
+  _offset = 0;
+
+  rapidjson::Document entry;
+  decode(&entry, &entry.GetAllocator(), 0);
+  doc->Swap(entry);
+  return true;
+}
+
+uint64_t Binary_trace_reader::get_varint() {
+  uint64_t value = 0;
+  int shift = 0;
+  for (;;) {
+    if (_offset >= _buffer.size() || shift > 63)
+      throw std::logic_error(_path + ": corrupted binary trace");
+    uint8_t c = static_cast<uint8_t>(_buffer[_offset++]);
+    value |= static_cast<uint64_t>(c & 0x7f) << shift;
+    if ((c & 0x80) == 0) break;
+    shift += 7;
+  }
+  return value;
+}
+
+uint64_t Binary_trace_reader::get_count() {
+  // each element takes at least one byte
+  const uint64_t count = get_varint();
+  if (count > _buffer.size() - _offset)
+    throw std::logic_error(_path + ": corrupted binary trace");
+  return count;
+}
+
+const char *Binary_trace_reader::get_bytes(size_t length) {
+  if (length > _buffer.size() - _offset)
+    throw std::logic_error(_path + ": corrupted binary trace");
+  const char *data = _buffer.data() + _offset;
+  _offset += length;
+  return data;
+}
+
+const std::string &Binary_trace_reader::decode_key() {
+  uint64_t index = get_varint();
+  if (index == 0) {
+    size_t length = get_varint();
+    const char *key = get_bytes(length);
+    _keys.emplace_back(key, length);
+    return _keys.back();
+  }
+  if (index > _keys.size())
+    throw std::logic_error(_path + ": corrupted binary trace");
+  return _keys[index - 1];
+}
+
+void Binary_trace_reader::decode(rapidjson::Value *value,
+                                 rapidjson::Document::AllocatorType *a,
+                                 int depth) {
+  if (depth > k_max_depth)
+    throw std::logic_error(_path + ": corrupted binary trace");
+
+  switch (*get_bytes(1)) {
+    case k_null:
+      value->SetNull();
+      break;
+    case k_false:
+      value->SetBool(false);
+      break;
+    case k_true:
+      value->SetBool(true);
+      break;
+    case k_int:
+      value->SetInt64(zigzag_decode(get_varint()));
+      break;
+    case k_uint:
+      value->SetUint64(get_varint());
+      break;
+    case k_double: {
+      const uint8_t *data = reinterpret_cast<const uint8_t *>(get_bytes(8));
+      uint64_t bits = 0;
+      for (int i = 7; i >= 0; --i) bits = (bits << 8) | data[i];
+      double d;
+      memcpy(&d, &bits, sizeof(d));
+      value->SetDouble(d);
+      break;
+    }
+    case k_string: {
+      size_t length = get_varint();
+      const char *data = get_bytes(length);
+      value->SetString(data, static_cast<rapidjson::SizeType>(length), *a);
+      break;
+    }
+    case k_array: {
+      uint64_t count = get_count();
+      value->SetArray();
+      value->Reserve(static_cast<rapidjson::SizeType>(count), *a);
+      for (uint64_t i = 0; i < count; ++i) {
+        rapidjson::Value item;
+        decode(&item, a, depth + 1);
+        value->PushBack(item, *a);
+      }
+      break;
+    }
+    case k_object: {
+      uint64_t count = get_count();
+      value->SetObject();
+      for (uint64_t i = 0; i < count; ++i) {
+        const std::string &key = decode_key();
+        rapidjson::Value k(key.data(),
+                           static_cast<rapidjson::SizeType>(key.size()), *a);
+        rapidjson::Value v;
+        decode(&v, a, depth + 1);
+        value->AddMember(k, v, *a);
+      }
+      break;
+    }
+    default:
+      throw std::logic_error(_path + ": corrupted binary trace");
+  }
+}
+
+}  // namespace replay
+}  // namespace db
+}  // namespace mysqlshdk
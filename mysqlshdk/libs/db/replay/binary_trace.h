@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_REPLAY_BINARY_TRACE_H_
+#define MYSQLSHDK_LIBS_DB_REPLAY_BINARY_TRACE_H_
+
+#include <rapidjson/document.h>
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mysqlshdk {
+namespace db {
+namespace replay {
+
+/**
+ * Compact binary encoding of session traces.
+ *
+ * A binary trace starts with a fixed magic header, followed by one record per
+ * trace entry. Each record is a varint with the payload length followed by
+ * the payload, which is a tagged encoding of the same JSON tree that would
+ * be written to a JSON trace. Object keys are interned per file: the first
+ * occurrence of a key stores its text, further occurrences only refer to it
+ * by index.
+ *
+ * Records are self-contained with respect to their length, so a reader can
+ * decode one entry at a time without loading the whole file and a trace
+ * truncated by a crash is still readable up to the last complete record.
+ * Reading the truncated record itself (either its length or its payload),
+ * like any other malformed one, fails with an exception instead of trusting
+ * its length. Write errors are reported with an exception as well.
+ */
+extern const char k_binary_trace_magic[];
+extern const size_t k_binary_trace_magic_length;
+
+/**
+ * Checks whether the file at the given path starts with the binary trace
+ * magic header.
+ */
+bool is_binary_trace(const std::string &path);
+
+class Binary_trace_writer {
+ public:
+  explicit Binary_trace_writer(const std::string &path);
+  ~Binary_trace_writer();
+
+  Binary_trace_writer(const Binary_trace_writer &) = delete;
+  Binary_trace_writer &operator=(const Binary_trace_writer &) = delete;
+
+  void write(const rapidjson::Value &entry);
+
+  size_t count() const { return _count; }
+
+ private:
+  void encode(const rapidjson::Value &value);
+  void encode_key(const char *key, size_t length);
+  void write_bytes(const char *data, size_t length);
+  void flush();
+
+  std::string _path;
+  std::FILE *_file = nullptr;
+  std::string _buffer;
+  std::unordered_map<std::string, uint64_t> _keys;
+  size_t _count = 0;
+};
+
+class Binary_trace_reader {
+ public:
+  explicit Binary_trace_reader(const std::string &path);
+  ~Binary_trace_reader();
+
+  Binary_trace_reader(const Binary_trace_reader &) = delete;
+  Binary_trace_reader &operator=(const Binary_trace_reader &) = delete;
+
+  /**
+   * Decodes the next entry of the trace into doc.
+   *
+   * @returns false once the end of the trace is reached.
+   * @throws std::logic_error if the trace is truncated or corrupted
+   */
+  bool next(rapidjson::Document *doc);
+
+ private:
+  void decode(rapidjson::Value *value, rapidjson::Document::AllocatorType *a,
+              int depth);
+  const std::string &decode_key();
+
+  uint64_t get_varint();
+  uint64_t get_count();
+  const char *get_bytes(size_t length);
+
+  std::string _path;
+  std::FILE *_file = nullptr;
+  uint64_t _size = 0;
+  std::string _buffer;
+  size_t _offset = 0;
+  std::vector<std::string> _keys;
+};
+
+}  // namespace replay
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_REPLAY_BINARY_TRACE_H_
@@ -56,7 +56,8 @@ Recorder_mysql::Recorder_mysql(int print_traces)
 
 void Recorder_mysql::connect(const mysqlshdk::db::Connection_options &data) {
   _trace.reset(
-      Trace_writer::create(new_recording_path("mysql_trace"), _print_traces));
+      Trace_writer::create(new_recording_path("mysql_trace"), _print_traces,
+                           g_trace_format));
 
   try {
     if (data.has_port()) _port = data.get_port();
@@ -139,7 +140,8 @@ Recorder_mysqlx::Recorder_mysqlx(int print_traces)
 
 void Recorder_mysqlx::connect(const mysqlshdk::db::Connection_options &data) {
   _trace.reset(
-      Trace_writer::create(new_recording_path("mysqlx_trace"), _print_traces));
+      Trace_writer::create(new_recording_path("mysqlx_trace"), _print_traces,
+                           g_trace_format));
   try {
     if (data.has_port()) _port = data.get_port();
     _trace->serialize_connect(data, "x");
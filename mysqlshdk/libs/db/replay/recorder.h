@@ -61,6 +61,10 @@ class Recorder_mysql : public mysql::Session {
 
   void close() override;
 
+  bool supports_prepared_statements() const override { return false; }
+
+  bool supports_async_queries() const override { return false; }
+
  private:
   std::unique_ptr<Trace_writer> _trace;
   int _port;
@@ -68,6 +68,10 @@ class Replayer_mysql : public mysql::Session {
   const mysqlshdk::db::Connection_options &get_connection_options()
       const override;
 
+  bool supports_prepared_statements() const override { return false; }
+
+  bool supports_async_queries() const override { return false; }
+
   ~Replayer_mysql();
 
  private:
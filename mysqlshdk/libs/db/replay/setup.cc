@@ -38,6 +38,7 @@ int g_session_create_index = 0;
 int g_session_replay_index = 0;
 int g_external_program_index = 0;
 Mode g_replay_mode = Mode::Direct;
+Trace_format g_trace_format = Trace_format::Json;
 Result_row_hook g_replay_row_hook;
 Query_hook g_replay_query_hook;
 
@@ -73,6 +74,8 @@ void set_mode(Mode mode, int print_traces) {
   setup_mysql_session_injector(mode, print_traces);
 }
 
+void set_trace_format(Trace_format format) { g_trace_format = format; }
+
 std::string current_recording_dir() {
   std::string path = g_recording_path_prefix;
   path.append(g_recording_context);
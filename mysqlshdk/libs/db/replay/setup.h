@@ -42,6 +42,12 @@ enum class Mode { Direct, Record, Replay };
 
 void set_mode(Mode mode, int print_traces);
 
+/**
+ * Sets the format used for new recordings. Replay detects the format of
+ * each trace file automatically.
+ */
+void set_trace_format(Trace_format format);
+
 void set_recording_path_prefix(const std::string &path);
 void begin_recording_context(const std::string &context);
 void end_recording_context();
@@ -89,6 +95,7 @@ extern int g_session_create_index;
 extern int g_session_replay_index;
 extern int g_external_program_index;
 extern Mode g_replay_mode;
+extern Trace_format g_trace_format;
 
 }  // namespace replay
 }  // namespace db
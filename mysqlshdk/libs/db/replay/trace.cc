@@ -31,6 +31,7 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 #include <utility>
+#include "mysqlshdk/libs/db/replay/binary_trace.h"
 #include "mysqlshdk/libs/db/replay/replayer.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
@@ -124,32 +125,39 @@ uint64_t get_uint(rapidjson::Value &value) {  // NOLINT
   return value.GetUint64();
 }
 
-std::string make_json(
-    const std::string &type, const std::string &subtype,
-    const std::vector<std::pair<std::string, std::string>> &items, int i) {
-  rapidjson::Document doc;
-  doc.SetObject();
-  set(&doc, "type", type);
-  set(&doc, "subtype", subtype);
-  set(&doc, "index", i);
+void make_entry(rapidjson::Document *doc, const std::string &type,
+                const std::string &subtype,
+                const std::vector<std::pair<std::string, std::string>> &items,
+                int i) {
+  doc->SetObject();
+  set(doc, "type", type);
+  set(doc, "subtype", subtype);
+  set(doc, "index", i);
   for (const auto &i : items) {
-    set(&doc, i.first.c_str(), i.second);
+    set(doc, i.first.c_str(), i.second);
   }
+}
 
-  rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-  doc.Accept(writer);
-  return buffer.GetString();
+void Trace_writer::write_entry(const rapidjson::Value &entry) {
+  if (_binary) {
+    _binary->write(entry);
+  } else {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    entry.Accept(writer);
+    _stream << buffer.GetString() << ",\n";
+  }
 }
 
 void Trace_writer::serialize_connect(
     const mysqlshdk::db::Connection_options &data,
     const std::string &protocol) {
-  _stream << make_json("request", "CONNECT",
-                       {{"uri", data.as_uri(uri::formats::full())},
-                        {"protocol", protocol}},
-                       ++_idx)
-          << ",\n";
+  rapidjson::Document doc;
+  make_entry(&doc, "request", "CONNECT",
+             {{"uri", data.as_uri(uri::formats::full())},
+              {"protocol", protocol}},
+             ++_idx);
+  write_entry(doc);
 
   _log_label = shcore::path::basename(_path);
   auto ext = _log_label.rfind('.');
@@ -166,16 +174,22 @@ void Trace_writer::serialize_connect(
 
 void Trace_writer::serialize_close() {
   if (_print_traces) std::cerr << _log_label << ": close\n";
-  _stream << make_json("request", "CLOSE", {}, ++_idx) << ",\n";
+  rapidjson::Document doc;
+  make_entry(&doc, "request", "CLOSE", {}, ++_idx);
+  write_entry(doc);
 }
 
 void Trace_writer::serialize_query(const std::string &sql) {
   if (_print_traces > 1) std::cerr << _log_label << ": " << sql << "\n";
-  _stream << make_json("request", "QUERY", {{"sql", sql}}, ++_idx) << ",\n";
+  rapidjson::Document doc;
+  make_entry(&doc, "request", "QUERY", {{"sql", sql}}, ++_idx);
+  write_entry(doc);
 }
 
 void Trace_writer::serialize_ok() {
-  _stream << make_json("response", "OK", {}, ++_idx) << ",\n";
+  rapidjson::Document doc;
+  make_entry(&doc, "response", "OK", {}, ++_idx);
+  write_entry(doc);
 }
 
 void Trace_writer::serialize_connect_ok(
@@ -189,10 +203,7 @@ void Trace_writer::serialize_connect_ok(
     set(&doc, it.first.c_str(), it.second.c_str());
   }
 
-  rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-  doc.Accept(writer);
-  _stream << buffer.GetString() << ",\n";
+  write_entry(doc);
 }
 
 void serialize_result_metadata(rapidjson::Document *doc,
@@ -339,10 +350,7 @@ void Trace_writer::serialize_result(
       serialize_result_rows(&doc, result, hook);
     }
 
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    doc.Accept(writer);
-    _stream << buffer.GetString() << ",\n";
+    write_entry(doc);
   } catch (std::exception &e) {
     std::cerr << "Exception serializing result trace: " << e.what() << "\n";
     throw;
@@ -353,25 +361,27 @@ void Trace_writer::serialize_error(const db::Error &e) {
   if (_print_traces)
     std::cerr << _log_label << ": MySQL error: " << e.what() << " (" << e.code()
               << ")\n";
-  _stream << make_json("response", "ERROR",
-                       {{"code", std::to_string(e.code())},
-                        {"msg", e.what()},
-                        {"sqlstate", e.sqlstate()}},
-                       ++_idx)
-          << ",\n";
+  rapidjson::Document doc;
+  make_entry(&doc, "response", "ERROR",
+             {{"code", std::to_string(e.code())},
+              {"msg", e.what()},
+              {"sqlstate", e.sqlstate()}},
+             ++_idx);
+  write_entry(doc);
 }
 
 void Trace_writer::serialize_error(const std::runtime_error &e) {
   if (_print_traces)
     std::cerr << "Runtime error in " << _path << ": " << e.what() << "\n";
-  _stream << make_json("response", "ERROR",
-                       {{"code", ""}, {"msg", e.what()}, {"sqlstate", ""}},
-                       ++_idx)
-          << ",\n";
+  rapidjson::Document doc;
+  make_entry(&doc, "response", "ERROR",
+             {{"code", ""}, {"msg", e.what()}, {"sqlstate", ""}}, ++_idx);
+  write_entry(doc);
 }
 
-Trace_writer *Trace_writer::create(const std::string &path, int print_traces) {
-  return new Trace_writer(path, print_traces);
+Trace_writer *Trace_writer::create(const std::string &path, int print_traces,
+                                   Trace_format format) {
+  return new Trace_writer(path, print_traces, format);
 }
 
 void Trace_writer::set_metadata(
@@ -388,24 +398,27 @@ void Trace_writer::set_metadata(
   }
   doc.AddMember("metadata", value, doc.GetAllocator());
 
-  rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-  doc.Accept(writer);
-  _stream << buffer.GetString() << ",\n";
+  write_entry(doc);
 }
 
-Trace_writer::Trace_writer(const std::string &path, int print_traces)
+Trace_writer::Trace_writer(const std::string &path, int print_traces,
+                           Trace_format format)
     : _path(path), _print_traces(print_traces) {
   _log_label = shcore::path::basename(path);
   if (_print_traces) std::cerr << "Creating trace file " << path << "\n";
-  _stream.open(path);
-  if (_stream.bad()) throw std::logic_error(path + ": " + strerror(errno));
-  _stream.rdbuf()->pubsetbuf(0, 0);
-  _stream << "[\n";
+  if (format == Trace_format::Binary) {
+    _binary.reset(new Binary_trace_writer(path));
+  } else {
+    _stream.open(path);
+    if (_stream.bad()) throw std::logic_error(path + ": " + strerror(errno));
+    _stream.rdbuf()->pubsetbuf(0, 0);
+    _stream << "[\n";
+  }
 }
 
 Trace_writer::~Trace_writer() {
-  _stream << "null]\n";
+  // binary traces have no terminator, the end of file marks the end of trace
+  if (!_binary) _stream << "null]\n";
 
   if (_print_traces)
     std::cerr << "Closed trace file " << _path << " (" << _idx << " entries)\n";
@@ -420,10 +433,16 @@ Trace::Trace(const std::string &path, int print_traces)
 
   if (_print_traces) std::cerr << "Opening trace file " << path << "\n";
 
+  _index = 0;
+  if (is_binary_trace(path)) {
+    // binary traces are decoded one entry at a time, as they're consumed
+    _binary.reset(new Binary_trace_reader(path));
+    return;
+  }
+
   file = std::fopen(path.c_str(), "r");
   if (!file) throw std::logic_error(path + ": " + strerror(errno));
 
-  _index = 0;
   rapidjson::FileReadStream stream(file, buffer, sizeof(buffer));
   _doc.ParseStream(stream);
   std::fclose(file);
@@ -442,9 +461,19 @@ Trace::Trace(const std::string &path, int print_traces)
 Trace::~Trace() {}
 
 void Trace::next(rapidjson::Value *entry) {
-  if (_index >= _doc.Size() - 1) throw sequence_error("Session trace is over");
+  if (_binary) {
+    if (!_binary->next(&_entry))
+      throw sequence_error("Session trace is over");
+    // entry refers to memory owned by _entry, which stays valid until the
+    // next entry is read
+    *entry = _entry;
+    ++_index;
+  } else {
+    if (_index >= _doc.Size() - 1)
+      throw sequence_error("Session trace is over");
 
-  *entry = _doc[_index++];
+    *entry = _doc[_index++];
+  }
 
   if (0) {
     std::cerr << "Trace read: " << to_json(entry) << "\n";
@@ -772,6 +801,30 @@ std::map<std::string, std::string> load_info(const std::string &path) {
   return map;
 }
 
+size_t convert_trace(const std::string &from_path, const std::string &to_path,
+                     Trace_format to_format) {
+  std::unique_ptr<Trace_writer> writer(
+      Trace_writer::create(to_path, 0, to_format));
+  size_t count = 0;
+
+  if (is_binary_trace(from_path)) {
+    Binary_trace_reader reader(from_path);
+    rapidjson::Document entry;
+    while (reader.next(&entry)) {
+      writer->write_entry(entry);
+      ++count;
+    }
+  } else {
+    Trace trace(from_path, 0);
+    // the last element of a JSON trace is the null terminator
+    for (rapidjson::SizeType i = 0; i + 1 < trace._doc.Size(); ++i) {
+      writer->write_entry(trace._doc[i]);
+      ++count;
+    }
+  }
+  return count;
+}
+
 }  // namespace replay
 }  // namespace db
 }  // namespace mysqlshdk
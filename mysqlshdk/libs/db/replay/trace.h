@@ -41,10 +41,16 @@ namespace mysqlshdk {
 namespace db {
 namespace replay {
 
+class Binary_trace_reader;
+class Binary_trace_writer;
+
+enum class Trace_format { Json, Binary };
+
 class Trace_writer {
  public:
   ~Trace_writer();
-  static Trace_writer *create(const std::string &path, int print_traces);
+  static Trace_writer *create(const std::string &path, int print_traces,
+                              Trace_format format = Trace_format::Json);
 
   void set_metadata(const std::map<std::string, std::string> &meta);
 
@@ -65,11 +71,18 @@ class Trace_writer {
   int trace_index() const { return _idx; }
 
  private:
+  friend size_t convert_trace(const std::string &, const std::string &,
+                              Trace_format);
+
   std::string _log_label;
 
-  Trace_writer(const std::string &path, int print_traces);
+  Trace_writer(const std::string &path, int print_traces, Trace_format format);
+
+  void write_entry(const rapidjson::Value &entry);
+
   std::string _path;
   std::ofstream _stream;
+  std::unique_ptr<Binary_trace_writer> _binary;
   int _idx = 0;
   int _print_traces = 0;
 };
@@ -78,6 +91,17 @@ void save_info(const std::string &path,
                const std::map<std::string, std::string> &state);
 std::map<std::string, std::string> load_info(const std::string &path);
 
+/**
+ * Converts a session trace between the JSON and binary formats.
+ *
+ * The format of the source trace is detected automatically, the target trace
+ * is written using the given format.
+ *
+ * @returns number of entries converted.
+ */
+size_t convert_trace(const std::string &from_path, const std::string &to_path,
+                     Trace_format to_format);
+
 class sequence_error : public db::Error {
  public:
   explicit sequence_error(const std::string &what);
@@ -167,6 +191,9 @@ class Trace {
   size_t trace_index() const { return static_cast<size_t>(_index); }
 
  private:
+  friend size_t convert_trace(const std::string &, const std::string &,
+                              Trace_format);
+
   void next(rapidjson::Value *entry);
   void unserialize_result_rows(
       rapidjson::Value *rlist, std::shared_ptr<Result_mysql> result,
@@ -177,6 +204,8 @@ class Trace {
   void expect_request(rapidjson::Value *doc, const char *subtype,
                       const char *detail = nullptr);
   rapidjson::Document _doc;
+  std::unique_ptr<Binary_trace_reader> _binary;
+  rapidjson::Document _entry;
   rapidjson::SizeType _index;
   std::string _trace_path;
   int _print_traces = 0;
@@ -27,8 +27,10 @@
 #ifndef MYSQLSHDK_LIBS_DB_RESULT_H_
 #define MYSQLSHDK_LIBS_DB_RESULT_H_
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include "mysqlshdk/libs/db/column.h"
 #include "mysqlshdk/libs/db/row.h"
@@ -105,10 +107,34 @@ class SHCORE_PUBLIC IResult {
   virtual void buffer() = 0;
   virtual void rewind() = 0;
 
+  /**
+   * Registers a function which stops a thread reading the rows of this result
+   * in the background. Session calls it before the connection is used for
+   * anything else, i.e. before the next query is sent or before the unread
+   * rows are discarded.
+   */
+  void set_background_reader(std::function<void()> stop) {
+    m_stop_background_reader = std::move(stop);
+  }
+
+  /**
+   * Stops the background reader (if any) and waits until it finishes.
+   */
+  void stop_background_reader() {
+    if (m_stop_background_reader) {
+      const auto stop = std::move(m_stop_background_reader);
+      m_stop_background_reader = nullptr;
+      stop();
+    }
+  }
+
   virtual ~IResult() {}
 
  protected:
   double m_execution_time = 0.0;
+
+ private:
+  std::function<void()> m_stop_background_reader;
 };
 
 }  // namespace db
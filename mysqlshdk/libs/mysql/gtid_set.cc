@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/mysql/gtid_set.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <utility>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace mysql {
+
+namespace {
+
+// the same limit as in the server
+constexpr uint64_t k_max_gno = 0x7fffffffffffffffULL;
+
+[[noreturn]] void throw_invalid(const std::string &gtid_set) {
+  throw shcore::Exception::argument_error(
+      "Malformed GTID set specification '" + gtid_set + "'.");
+}
+
+bool parse_uuid(const std::string &str, std::string *out_uuid) {
+  // dashes are optional, as in the server
+  std::string hex;
+  hex.reserve(32);
+
+  for (const char c : str) {
+    if (c == '-') continue;
+    if (!std::isxdigit(static_cast<unsigned char>(c))) return false;
+    hex += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  }
+
+  if (hex.length() != 32) return false;
+
+  *out_uuid = hex.substr(0, 8) + "-" + hex.substr(8, 4) + "-" +
+              hex.substr(12, 4) + "-" + hex.substr(16, 4) + "-" +
+              hex.substr(20);
+  return true;
+}
+
+bool parse_gno(const std::string &str, uint64_t *out_gno) {
+  if (str.empty() || str.length() > 19) return false;
+
+  uint64_t gno = 0;
+
+  for (const char c : str) {
+    if (c < '0' || c > '9') return false;
+    gno = gno * 10 + (c - '0');
+  }
+
+  if (gno == 0 || gno > k_max_gno) return false;
+
+  *out_gno = gno;
+  return true;
+}
+
+bool parse_interval(const std::string &str, Gtid_set::Interval *out_interval) {
+  const auto dash = str.find('-');
+
+  if (std::string::npos == dash) {
+    if (!parse_gno(str, &out_interval->start)) return false;
+    out_interval->end = out_interval->start;
+    return true;
+  }
+
+  return parse_gno(str.substr(0, dash), &out_interval->start) &&
+         parse_gno(str.substr(dash + 1), &out_interval->end) &&
+         out_interval->start <= out_interval->end;
+}
+
+/**
+ * Merges overlapping and adjacent intervals of a sorted vector.
+ */
+void coalesce(Gtid_set::Intervals *intervals) {
+  if (intervals->empty()) return;
+
+  auto last = intervals->begin();
+
+  for (auto it = std::next(last); it != intervals->end(); ++it) {
+    if (it->start <= last->end + 1) {
+      last->end = std::max(last->end, it->end);
+    } else {
+      *++last = *it;
+    }
+  }
+
+  intervals->erase(std::next(last), intervals->end());
+}
+
+bool by_start(const Gtid_set::Interval &l, const Gtid_set::Interval &r) {
+  return l.start < r.start;
+}
+
+Gtid_set::Intervals subtract(const Gtid_set::Intervals &set,
+                             const Gtid_set::Intervals &other) {
+  Gtid_set::Intervals result;
+  auto o = other.begin();
+
+  for (auto interval : set) {
+    while (o != other.end() && o->end < interval.start) ++o;
+
+    // next interval of the set may also overlap with *o, don't advance it
+    for (auto it = o; it != other.end() && it->start <= interval.end; ++it) {
+      if (it->start > interval.start)
+        result.push_back({interval.start, it->start - 1});
+
+      // start is never greater than k_max_gno + 1, no overflow
+      interval.start = it->end + 1;
+
+      if (interval.start > interval.end) break;
+    }
+
+    if (interval.start <= interval.end) result.push_back(interval);
+  }
+
+  return result;
+}
+
+Gtid_set::Intervals intersect(const Gtid_set::Intervals &set,
+                              const Gtid_set::Intervals &other) {
+  Gtid_set::Intervals result;
+  auto s = set.begin();
+  auto o = other.begin();
+
+  while (s != set.end() && o != other.end()) {
+    const auto start = std::max(s->start, o->start);
+    const auto end = std::min(s->end, o->end);
+
+    if (start <= end) result.push_back({start, end});
+
+    if (s->end < o->end)
+      ++s;
+    else
+      ++o;
+  }
+
+  return result;
+}
+
+bool is_subset(const Gtid_set::Intervals &set,
+               const Gtid_set::Intervals &other) {
+  auto o = other.begin();
+
+  for (const auto &interval : set) {
+    while (o != other.end() && o->end < interval.start) ++o;
+
+    // intervals are not adjacent, whole interval has to be within a single one
+    if (o == other.end() || o->start > interval.start || o->end < interval.end)
+      return false;
+  }
+
+  return true;
+}
+
+}  // namespace
+
+Gtid_set Gtid_set::from_string(const std::string &gtid_set) {
+  Gtid_set result;
+
+  for (const auto &entry : shcore::str_split(gtid_set, ",")) {
+    const auto gtids = shcore::str_strip(entry);
+
+    // empty entries are accepted by the server
+    if (gtids.empty()) continue;
+
+    const auto parts = shcore::str_split(gtids, ":");
+    std::string uuid;
+
+    if (parts.size() < 2 || gtids.back() == ':' ||
+        !parse_uuid(shcore::str_strip(parts[0]), &uuid))
+      throw_invalid(gtid_set);
+
+    auto &intervals = result.m_intervals[uuid];
+
+    for (auto it = std::next(parts.begin()); it != parts.end(); ++it) {
+      Interval interval;
+
+      if (!parse_interval(shcore::str_strip(*it), &interval))
+        throw_invalid(gtid_set);
+
+      intervals.push_back(interval);
+    }
+
+    std::sort(intervals.begin(), intervals.end(), by_start);
+    coalesce(&intervals);
+  }
+
+  return result;
+}
+
+std::string Gtid_set::str() const {
+  std::string result;
+
+  for (const auto &gtids : m_intervals) {
+    if (!result.empty()) result += ",\n";
+
+    result += gtids.first;
+
+    for (const auto &interval : gtids.second) {
+      result += ':';
+      result += std::to_string(interval.start);
+
+      if (interval.end != interval.start) {
+        result += '-';
+        result += std::to_string(interval.end);
+      }
+    }
+  }
+
+  return result;
+}
+
+uint64_t Gtid_set::count() const {
+  uint64_t result = 0;
+
+  for (const auto &gtids : m_intervals) {
+    for (const auto &interval : gtids.second) {
+      result += interval.end - interval.start + 1;
+    }
+  }
+
+  return result;
+}
+
+const Gtid_set::Intervals &Gtid_set::intervals(const std::string &uuid) const {
+  static const Intervals k_empty;
+  std::string normalized;
+
+  if (!parse_uuid(uuid, &normalized)) return k_empty;
+
+  const auto it = m_intervals.find(normalized);
+  return m_intervals.end() == it ? k_empty : it->second;
+}
+
+std::vector<std::string> Gtid_set::uuids() const {
+  std::vector<std::string> result;
+  result.reserve(m_intervals.size());
+
+  for (const auto &gtids : m_intervals) {
+    result.emplace_back(gtids.first);
+  }
+
+  return result;
+}
+
+Gtid_set &Gtid_set::add(const Gtid_set &other) {
+  for (const auto &gtids : other.m_intervals) {
+    auto &intervals = m_intervals[gtids.first];
+    Intervals merged;
+    merged.reserve(intervals.size() + gtids.second.size());
+
+    std::merge(intervals.begin(), intervals.end(), gtids.second.begin(),
+               gtids.second.end(), std::back_inserter(merged), by_start);
+    coalesce(&merged);
+
+    intervals = std::move(merged);
+  }
+
+  return *this;
+}
+
+Gtid_set &Gtid_set::subtract(const Gtid_set &other) {
+  for (auto it = m_intervals.begin(); it != m_intervals.end();) {
+    const auto o = other.m_intervals.find(it->first);
+
+    if (other.m_intervals.end() != o)
+      it->second = mysql::subtract(it->second, o->second);
+
+    if (it->second.empty())
+      it = m_intervals.erase(it);
+    else
+      ++it;
+  }
+
+  return *this;
+}
+
+Gtid_set &Gtid_set::intersect(const Gtid_set &other) {
+  for (auto it = m_intervals.begin(); it != m_intervals.end();) {
+    const auto o = other.m_intervals.find(it->first);
+
+    if (other.m_intervals.end() == o)
+      it->second.clear();
+    else
+      it->second = mysql::intersect(it->second, o->second);
+
+    if (it->second.empty())
+      it = m_intervals.erase(it);
+    else
+      ++it;
+  }
+
+  return *this;
+}
+
+bool Gtid_set::is_subset(const Gtid_set &other) const {
+  for (const auto &gtids : m_intervals) {
+    const auto o = other.m_intervals.find(gtids.first);
+
+    if (other.m_intervals.end() == o ||
+        !mysql::is_subset(gtids.second, o->second))
+      return false;
+  }
+
+  return true;
+}
+
+Gtid_set operator+(Gtid_set lhs, const Gtid_set &rhs) {
+  return lhs.add(rhs);
+}
+
+Gtid_set operator-(Gtid_set lhs, const Gtid_set &rhs) {
+  return lhs.subtract(rhs);
+}
+
+}  // namespace mysql
+}  // namespace mysqlshdk
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_MYSQL_GTID_SET_H_
+#define MYSQLSHDK_LIBS_MYSQL_GTID_SET_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace mysqlshdk {
+namespace mysql {
+
+/**
+ * Set of GTIDs, i.e. the value of GTID_EXECUTED or GTID_PURGED.
+ *
+ * Transactions of each UUID are kept as a sorted vector of disjoint and
+ * non-adjacent intervals, so all set operations are linear and there's no
+ * need to ask the server to evaluate GTID_SUBSET() or GTID_SUBTRACT().
+ */
+class Gtid_set {
+ public:
+  /**
+   * Closed range of transaction numbers.
+   */
+  struct Interval {
+    uint64_t start;
+    uint64_t end;
+
+    bool operator==(const Interval &other) const {
+      return start == other.start && end == other.end;
+    }
+  };
+
+  using Intervals = std::vector<Interval>;
+
+  Gtid_set() = default;
+
+  /**
+   * Parses the textual representation of a GTID set, i.e.:
+   *   3e11fa47-71ca-11e1-9e33-c80aa9429562:1-5:7, 4b2c...:1
+   *
+   * UUIDs are normalized to lower case, overlapping intervals are merged.
+   *
+   * @throws shcore::Exception if the string is not a valid GTID set.
+   */
+  static Gtid_set from_string(const std::string &gtid_set);
+
+  /**
+   * Formats the set the same way the server does.
+   */
+  std::string str() const;
+
+  bool empty() const { return m_intervals.empty(); }
+
+  /**
+   * Number of transactions in the set.
+   */
+  uint64_t count() const;
+
+  /**
+   * Intervals of the given UUID, empty if UUID is not in the set.
+   */
+  const Intervals &intervals(const std::string &uuid) const;
+
+  std::vector<std::string> uuids() const;
+
+  /**
+   * Adds all transactions of other set to this one.
+   */
+  Gtid_set &add(const Gtid_set &other);
+
+  /**
+   * Removes all transactions of other set from this one.
+   */
+  Gtid_set &subtract(const Gtid_set &other);
+
+  /**
+   * Keeps only transactions which are also in the other set.
+   */
+  Gtid_set &intersect(const Gtid_set &other);
+
+  /**
+   * Checks if all transactions of this set are in the other set, the same as
+   * GTID_SUBSET(this, other).
+   */
+  bool is_subset(const Gtid_set &other) const;
+
+  bool operator==(const Gtid_set &other) const {
+    return m_intervals == other.m_intervals;
+  }
+
+  bool operator!=(const Gtid_set &other) const { return !(*this == other); }
+
+ private:
+  std::map<std::string, Intervals> m_intervals;
+};
+
+Gtid_set operator+(Gtid_set lhs, const Gtid_set &rhs);
+Gtid_set operator-(Gtid_set lhs, const Gtid_set &rhs);
+
+}  // namespace mysql
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_MYSQL_GTID_SET_H_
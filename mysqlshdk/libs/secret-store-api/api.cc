@@ -80,7 +80,12 @@ std::vector<Helper_name> get_available_helpers(
 }
 
 std::unique_ptr<Helper_interface> get_helper(const Helper_name &name) noexcept {
-  return std::unique_ptr<Helper_interface>{new Helper_interface{name}};
+  return get_helper(name, {});
+}
+
+std::unique_ptr<Helper_interface> get_helper(
+    const Helper_name &name, const Helper_options &options) noexcept {
+  return std::unique_ptr<Helper_interface>{new Helper_interface{name, options}};
 }
 
 void set_logger(
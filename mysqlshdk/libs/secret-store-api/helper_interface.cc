@@ -32,6 +32,8 @@
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/secret-store-api/helper_invoker.h"
+#include "mysqlshdk/libs/secret-store-api/secret_cache.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 
 namespace mysql {
 namespace secret_store {
@@ -197,6 +199,10 @@ void to_secret_spec_list(const std::string &spec,
   }
 }
 
+std::string to_cache_key(const Secret_spec &spec) {
+  return to_string(spec.type) + ":" + validate_url(spec.url);
+}
+
 std::pair<Secret_spec, std::string> to_secret(const std::string &secret) {
   auto doc = parse(secret);
 
@@ -209,8 +215,9 @@ std::pair<Secret_spec, std::string> to_secret(const std::string &secret) {
 
 class Helper_interface::Helper_interface_impl {
  public:
-  explicit Helper_interface_impl(const Helper_name &name) noexcept
-      : m_invoker{name} {}
+  Helper_interface_impl(const Helper_name &name,
+                        const Helper_options &options) noexcept
+      : m_invoker{name, options.persistent}, m_cache{options.cache_ttl} {}
 
   Helper_name name() const noexcept { return m_invoker.name(); }
 
@@ -219,7 +226,19 @@ class Helper_interface::Helper_interface_impl {
       validate_secret(spec.type, secret);
 
       std::string output;
-      bool ret = m_invoker.store(to_string(spec, secret), &output);
+      auto input = to_string(spec, secret);
+      bool ret = m_invoker.store(input, &output);
+      shcore::clear_buffer(&input[0], input.length());
+
+      if (m_cache.enabled()) {
+        const auto key = to_cache_key(spec);
+
+        if (ret) {
+          m_cache.put(key, secret);
+        } else {
+          m_cache.erase(key);
+        }
+      }
 
       if (ret) {
         clear_last_error();
@@ -241,11 +260,24 @@ class Helper_interface::Helper_interface_impl {
     }
 
     try {
+      std::string key;
+
+      if (m_cache.enabled()) {
+        key = to_cache_key(spec);
+
+        if (m_cache.get(key, secret)) {
+          clear_last_error();
+          return true;
+        }
+      }
+
       std::string output;
       bool ret = m_invoker.get(to_string(spec), &output);
 
       if (ret) {
         *secret = to_secret(output).second;
+        shcore::clear_buffer(&output[0], output.length());
+        m_cache.put(key, *secret);
         clear_last_error();
       } else {
         set_last_error(output);
@@ -260,6 +292,8 @@ class Helper_interface::Helper_interface_impl {
 
   bool erase(const Secret_spec &spec) noexcept {
     try {
+      if (m_cache.enabled()) m_cache.erase(to_cache_key(spec));
+
       std::string output;
       bool ret = m_invoker.erase(to_string(spec), &output);
 
@@ -308,11 +342,13 @@ class Helper_interface::Helper_interface_impl {
   void clear_last_error() const { m_last_error.clear(); }
 
   Helper_invoker m_invoker;
+  mutable Secret_cache m_cache;
   mutable std::string m_last_error;
 };
 
-Helper_interface::Helper_interface(const Helper_name &name) noexcept
-    : m_impl{new Helper_interface_impl{name}} {}
+Helper_interface::Helper_interface(const Helper_name &name,
+                                   const Helper_options &options) noexcept
+    : m_impl{new Helper_interface_impl{name, options}} {}
 
 Helper_interface::~Helper_interface() noexcept = default;
 
@@ -23,6 +23,8 @@
 
 #include "mysqlshdk/libs/secret-store-api/helper_invoker.h"
 
+#include <sstream>
+#include <stdexcept>
 #include <vector>
 
 #include "mysqlshdk/libs/utils/process_launcher.h"
@@ -38,6 +40,7 @@ namespace api {
 namespace {
 
 constexpr auto k_secret = "\"Secret\"";
+constexpr auto k_serve_command = "serve";
 
 std::string hide_secret(const std::string &s) {
   const auto pos = s.find(k_secret);
@@ -54,7 +57,13 @@ std::string hide_secret(const std::string &s) {
 
 }  // namespace
 
-Helper_invoker::Helper_invoker(const Helper_name &name) : m_name{name} {}
+Helper_invoker::Helper_invoker(const Helper_name &name, bool persistent)
+    : m_name{name},
+      m_path{name.path()},
+      m_server_args{m_path.c_str(), k_serve_command, nullptr},
+      m_persistent{persistent} {}
+
+Helper_invoker::~Helper_invoker() { stop_server(true); }
 
 bool Helper_invoker::store(const std::string &input) const {
   std::string output;
@@ -95,12 +104,34 @@ bool Helper_invoker::version(std::string *output) const {
 
 bool Helper_invoker::invoke(const char *command, const std::string &input,
                             std::string *output) const {
+  if (m_persistent) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_persistent) {
+      try {
+        return invoke_server(command, input, output);
+      } catch (const std::exception &ex) {
+        logger::log(std::string{"Persistent helper failed: "} + ex.what());
+
+        // helper which has never responded does not support the persistent
+        // mode, otherwise it will be restarted by the next request
+        m_persistent = m_server_responded;
+        stop_server(false);
+      }
+    }
+  }
+
+  return invoke_process(command, input, output);
+}
+
+bool Helper_invoker::invoke_process(const char *command,
+                                    const std::string &input,
+                                    std::string *output) const {
   try {
-    std::string path = m_name.path();
-    const char *const args[] = {path.c_str(), command, nullptr};
+    const char *const args[] = {m_path.c_str(), command, nullptr};
 
     logger::log("Invoking helper");
-    logger::log("  Command line: " + path + " " + command);
+    logger::log("  Command line: " + m_path + " " + command);
     logger::log("  Input: " + hide_secret(input));
 
     shcore::Process_launcher app{args};
@@ -128,6 +159,97 @@ bool Helper_invoker::invoke(const char *command, const std::string &input,
   }
 }
 
+bool Helper_invoker::invoke_server(const char *command,
+                                   const std::string &input,
+                                   std::string *output) const {
+  if (!m_server) {
+    logger::log("Starting persistent helper");
+    logger::log("  Command line: " + m_path + " " + k_serve_command);
+
+    m_server.reset(new shcore::Process_launcher{m_server_args});
+    m_server->start();
+    m_server_responded = false;
+  }
+
+  const auto write = [this](const std::string &data) {
+    const char *ptr = data.c_str();
+    auto remaining = data.length();
+
+    while (remaining > 0) {
+      const auto written = m_server->write(ptr, remaining);
+
+      if (written <= 0) {
+        throw std::runtime_error{"Helper has closed its input"};
+      }
+
+      ptr += written;
+      remaining -= written;
+    }
+  };
+
+  logger::log("Invoking persistent helper");
+  logger::log(std::string{"  Command: "} + command);
+  logger::log("  Input: " + hide_secret(input));
+
+  write(std::string{command} + " " + std::to_string(input.length()) + "\n");
+  write(input);
+
+  bool eof = false;
+  const auto header = m_server->read_line(&eof);
+
+  if (header.empty() || header.back() != '\n') {
+    throw std::runtime_error{"Helper has exited"};
+  }
+
+  std::istringstream header_stream{header};
+  int exit_code = 0;
+  std::size_t length = 0;
+
+  if (!(header_stream >> exit_code >> length)) {
+    throw std::runtime_error{"Invalid response: " +
+                             shcore::str_strip(hide_secret(header))};
+  }
+
+  std::string response(length, '\0');
+  std::size_t offset = 0;
+
+  while (offset < length) {
+    const auto count = m_server->read(&response[offset], length - offset);
+
+    if (count <= 0) {
+      throw std::runtime_error{"Unexpected end of response"};
+    }
+
+    offset += count;
+  }
+
+  m_server_responded = true;
+  *output = shcore::str_strip(response);
+
+  logger::log("  Output: " + hide_secret(*output));
+  logger::log("  Exit code: " + std::to_string(exit_code));
+
+  return exit_code == 0;
+}
+
+void Helper_invoker::stop_server(bool graceful) const {
+  if (!m_server) return;
+
+  try {
+    if (graceful) {
+      // helper exits once its input is closed
+      m_server->finish_writing();
+      m_server->wait();
+    } else {
+      m_server->kill();
+    }
+  } catch (const std::exception &ex) {
+    logger::log(std::string{"Failed to stop persistent helper: "} + ex.what());
+  }
+
+  m_server.reset();
+}
+
 }  // namespace api
 }  // namespace secret_store
 }  // namespace mysql
@@ -24,17 +24,36 @@
 #ifndef MYSQLSHDK_LIBS_SECRET_STORE_API_HELPER_INVOKER_H_
 #define MYSQLSHDK_LIBS_SECRET_STORE_API_HELPER_INVOKER_H_
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
 
+namespace shcore {
+class Process;
+}  // namespace shcore
+
 namespace mysql {
 namespace secret_store {
 namespace api {
 
 class Helper_invoker {
  public:
-  explicit Helper_invoker(const Helper_name &name);
+  /**
+   * Creates the invoker.
+   *
+   * @param name Name of the helper.
+   * @param persistent If true, helper is started once (using its 'serve'
+   *        command) and then reused by all the subsequent requests. If helper
+   *        does not support this mode, each request starts a new process.
+   */
+  explicit Helper_invoker(const Helper_name &name, bool persistent = false);
+
+  Helper_invoker(const Helper_invoker &) = delete;
+  Helper_invoker &operator=(const Helper_invoker &) = delete;
+
+  ~Helper_invoker();
 
   Helper_name name() const noexcept { return m_name; }
 
@@ -57,7 +76,24 @@ class Helper_invoker {
  private:
   bool invoke(const char *command, const std::string &input,
               std::string *output) const;
+
+  bool invoke_process(const char *command, const std::string &input,
+                      std::string *output) const;
+
+  bool invoke_server(const char *command, const std::string &input,
+                     std::string *output) const;
+
+  void stop_server(bool graceful) const;
+
   Helper_name m_name;
+  std::string m_path;
+  // process keeps a pointer to the arguments
+  const char *const m_server_args[3];
+
+  mutable std::mutex m_mutex;
+  mutable bool m_persistent;
+  mutable bool m_server_responded = false;
+  mutable std::unique_ptr<shcore::Process> m_server;
 };
 
 }  // namespace api
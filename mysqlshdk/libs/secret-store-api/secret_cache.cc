@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/secret-store-api/secret_cache.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else  // ! _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif  // ! _WIN32
+
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/utils_general.h"
+
+#include "mysqlshdk/libs/secret-store-api/logger.h"
+
+namespace mysql {
+namespace secret_store {
+namespace api {
+
+/**
+ * Buffer allocated in separate pages, which are locked in memory and excluded
+ * from core dumps. Contents are cleared before memory is released.
+ */
+class Secret_cache::Locked_buffer final {
+ public:
+  explicit Locked_buffer(const std::string &data) : m_length(data.length()) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const size_t page_size = info.dwPageSize;
+#else   // ! _WIN32
+    const size_t page_size = sysconf(_SC_PAGESIZE);
+#endif  // ! _WIN32
+
+    // at least one byte, so that empty secrets are also handled
+    m_size = (m_length / page_size + 1) * page_size;
+
+#ifdef _WIN32
+    m_data = static_cast<char *>(VirtualAlloc(
+        nullptr, m_size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+
+    if (nullptr == m_data) {
+      throw std::bad_alloc();
+    }
+
+    m_locked = VirtualLock(m_data, m_size);
+#else  // ! _WIN32
+    void *ptr = mmap(nullptr, m_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == ptr) {
+      throw std::bad_alloc();
+    }
+
+    m_data = static_cast<char *>(ptr);
+    m_locked = 0 == mlock(m_data, m_size);
+
+#ifdef MADV_DONTDUMP
+    madvise(m_data, m_size, MADV_DONTDUMP);
+#endif  // MADV_DONTDUMP
+#endif  // ! _WIN32
+
+    if (!m_locked) {
+      logger::log("Failed to lock the memory of the cached secret");
+    }
+
+    memcpy(m_data, data.c_str(), m_length);
+  }
+
+  Locked_buffer(const Locked_buffer &) = delete;
+  Locked_buffer &operator=(const Locked_buffer &) = delete;
+
+  ~Locked_buffer() {
+    shcore::clear_buffer(m_data, m_size);
+
+#ifdef _WIN32
+    if (m_locked) VirtualUnlock(m_data, m_size);
+    VirtualFree(m_data, 0, MEM_RELEASE);
+#else   // ! _WIN32
+    if (m_locked) munlock(m_data, m_size);
+    munmap(m_data, m_size);
+#endif  // ! _WIN32
+  }
+
+  std::string str() const { return std::string(m_data, m_length); }
+
+ private:
+  char *m_data = nullptr;
+  size_t m_length = 0;
+  size_t m_size = 0;
+  bool m_locked = false;
+};
+
+Secret_cache::Secret_cache(std::chrono::milliseconds ttl) : m_ttl(ttl) {}
+
+Secret_cache::~Secret_cache() = default;
+
+bool Secret_cache::get(const std::string &key, std::string *secret) {
+  if (!enabled()) return false;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto entry = m_entries.find(key);
+
+  if (m_entries.end() == entry) return false;
+
+  if (entry->second.expires <= Clock::now()) {
+    m_entries.erase(entry);
+    return false;
+  }
+
+  *secret = entry->second.secret->str();
+  return true;
+}
+
+void Secret_cache::put(const std::string &key, const std::string &secret) {
+  if (!enabled()) return;
+
+  std::unique_ptr<Locked_buffer> buffer{new Locked_buffer(secret)};
+  const auto expires = Clock::now() + m_ttl;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto &entry = m_entries[key];
+
+  entry.secret = std::move(buffer);
+  entry.expires = expires;
+}
+
+void Secret_cache::erase(const std::string &key) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.erase(key);
+}
+
+void Secret_cache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+}  // namespace api
+}  // namespace secret_store
+}  // namespace mysql
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_SECRET_STORE_API_SECRET_CACHE_H_
+#define MYSQLSHDK_LIBS_SECRET_STORE_API_SECRET_CACHE_H_
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace mysql {
+namespace secret_store {
+namespace api {
+
+/**
+ * In-memory cache of the secrets retrieved from a helper.
+ *
+ * Secrets are held in memory which is locked (so it's never written to swap)
+ * and which is cleared when the entry is removed or expires.
+ */
+class Secret_cache final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * Creates the cache, entries expire after the given time, cache is disabled
+   * if it's zero.
+   */
+  explicit Secret_cache(std::chrono::milliseconds ttl);
+
+  Secret_cache(const Secret_cache &) = delete;
+  Secret_cache &operator=(const Secret_cache &) = delete;
+
+  ~Secret_cache();
+
+  bool enabled() const noexcept { return m_ttl.count() > 0; }
+
+  bool get(const std::string &key, std::string *secret);
+
+  void put(const std::string &key, const std::string &secret);
+
+  void erase(const std::string &key);
+
+  void clear();
+
+ private:
+  class Locked_buffer;
+
+  struct Entry {
+    std::unique_ptr<Locked_buffer> secret;
+    Clock::time_point expires;
+  };
+
+  std::chrono::milliseconds m_ttl;
+  std::mutex m_mutex;
+  std::map<std::string, Entry> m_entries;
+};
+
+}  // namespace api
+}  // namespace secret_store
+}  // namespace mysql
+
+#endif  // MYSQLSHDK_LIBS_SECRET_STORE_API_SECRET_CACHE_H_
@@ -0,0 +1,479 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/fast_dtoa.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace shcore {
+
+namespace {
+
+/**
+ * Shortest representation of a double has at most that many digits.
+ */
+constexpr int k_max_digits = 17;
+
+/**
+ * Same as MAX_DECPT_FOR_F_FORMAT in my_gcvt().
+ */
+constexpr int k_max_decpt_for_f_format = 15;
+
+/**
+ * Floating point number f * 2^e, with a 64-bit significand.
+ */
+struct Diy_fp {
+  uint64_t f;
+  int e;
+};
+
+constexpr int k_significand_size = 64;
+
+/**
+ * Upper 64 bits of the product of significands, rounded.
+ */
+Diy_fp multiply(const Diy_fp &x, const Diy_fp &y) {
+  constexpr uint64_t k_mask32 = 0xffffffffULL;
+  const uint64_t a = x.f >> 32;
+  const uint64_t b = x.f & k_mask32;
+  const uint64_t c = y.f >> 32;
+  const uint64_t d = y.f & k_mask32;
+  const uint64_t ac = a * c;
+  const uint64_t bc = b * c;
+  const uint64_t ad = a * d;
+  const uint64_t bd = b * d;
+  uint64_t tmp = (bd >> 32) + (ad & k_mask32) + (bc & k_mask32);
+  tmp += 1ULL << 31;
+  return {ac + (ad >> 32) + (bc >> 32) + (tmp >> 32),
+          x.e + y.e + k_significand_size};
+}
+
+Diy_fp normalize(Diy_fp x) {
+  assert(x.f != 0);
+
+  while (!(x.f & 0xffc0000000000000ULL)) {
+    x.f <<= 10;
+    x.e -= 10;
+  }
+
+  while (!(x.f & 0x8000000000000000ULL)) {
+    x.f <<= 1;
+    --x.e;
+  }
+
+  return x;
+}
+
+struct Cached_power {
+  uint64_t f;
+  int16_t e;
+  int16_t decimal_exponent;
+};
+
+/**
+ * Normalized, rounded significands of 10^-348, 10^-340, ..., 10^340.
+ */
+constexpr Cached_power k_cached_powers[] = {
+    {0xfa8fd5a0081c0288ULL, -1220, -348},
+    {0xbaaee17fa23ebf76ULL, -1193, -340},
+    {0x8b16fb203055ac76ULL, -1166, -332},
+    {0xcf42894a5dce35eaULL, -1140, -324},
+    {0x9a6bb0aa55653b2dULL, -1113, -316},
+    {0xe61acf033d1a45dfULL, -1087, -308},
+    {0xab70fe17c79ac6caULL, -1060, -300},
+    {0xff77b1fcbebcdc4fULL, -1034, -292},
+    {0xbe5691ef416bd60cULL, -1007, -284},
+    {0x8dd01fad907ffc3cULL, -980, -276},
+    {0xd3515c2831559a83ULL, -954, -268},
+    {0x9d71ac8fada6c9b5ULL, -927, -260},
+    {0xea9c227723ee8bcbULL, -901, -252},
+    {0xaecc49914078536dULL, -874, -244},
+    {0x823c12795db6ce57ULL, -847, -236},
+    {0xc21094364dfb5637ULL, -821, -228},
+    {0x9096ea6f3848984fULL, -794, -220},
+    {0xd77485cb25823ac7ULL, -768, -212},
+    {0xa086cfcd97bf97f4ULL, -741, -204},
+    {0xef340a98172aace5ULL, -715, -196},
+    {0xb23867fb2a35b28eULL, -688, -188},
+    {0x84c8d4dfd2c63f3bULL, -661, -180},
+    {0xc5dd44271ad3cdbaULL, -635, -172},
+    {0x936b9fcebb25c996ULL, -608, -164},
+    {0xdbac6c247d62a584ULL, -582, -156},
+    {0xa3ab66580d5fdaf6ULL, -555, -148},
+    {0xf3e2f893dec3f126ULL, -529, -140},
+    {0xb5b5ada8aaff80b8ULL, -502, -132},
+    {0x87625f056c7c4a8bULL, -475, -124},
+    {0xc9bcff6034c13053ULL, -449, -116},
+    {0x964e858c91ba2655ULL, -422, -108},
+    {0xdff9772470297ebdULL, -396, -100},
+    {0xa6dfbd9fb8e5b88fULL, -369, -92},
+    {0xf8a95fcf88747d94ULL, -343, -84},
+    {0xb94470938fa89bcfULL, -316, -76},
+    {0x8a08f0f8bf0f156bULL, -289, -68},
+    {0xcdb02555653131b6ULL, -263, -60},
+    {0x993fe2c6d07b7facULL, -236, -52},
+    {0xe45c10c42a2b3b06ULL, -210, -44},
+    {0xaa242499697392d3ULL, -183, -36},
+    {0xfd87b5f28300ca0eULL, -157, -28},
+    {0xbce5086492111aebULL, -130, -20},
+    {0x8cbccc096f5088ccULL, -103, -12},
+    {0xd1b71758e219652cULL, -77, -4},
+    {0x9c40000000000000ULL, -50, 4},
+    {0xe8d4a51000000000ULL, -24, 12},
+    {0xad78ebc5ac620000ULL, 3, 20},
+    {0x813f3978f8940984ULL, 30, 28},
+    {0xc097ce7bc90715b3ULL, 56, 36},
+    {0x8f7e32ce7bea5c70ULL, 83, 44},
+    {0xd5d238a4abe98068ULL, 109, 52},
+    {0x9f4f2726179a2245ULL, 136, 60},
+    {0xed63a231d4c4fb27ULL, 162, 68},
+    {0xb0de65388cc8ada8ULL, 189, 76},
+    {0x83c7088e1aab65dbULL, 216, 84},
+    {0xc45d1df942711d9aULL, 242, 92},
+    {0x924d692ca61be758ULL, 269, 100},
+    {0xda01ee641a708deaULL, 295, 108},
+    {0xa26da3999aef774aULL, 322, 116},
+    {0xf209787bb47d6b85ULL, 348, 124},
+    {0xb454e4a179dd1877ULL, 375, 132},
+    {0x865b86925b9bc5c2ULL, 402, 140},
+    {0xc83553c5c8965d3dULL, 428, 148},
+    {0x952ab45cfa97a0b3ULL, 455, 156},
+    {0xde469fbd99a05fe3ULL, 481, 164},
+    {0xa59bc234db398c25ULL, 508, 172},
+    {0xf6c69a72a3989f5cULL, 534, 180},
+    {0xb7dcbf5354e9beceULL, 561, 188},
+    {0x88fcf317f22241e2ULL, 588, 196},
+    {0xcc20ce9bd35c78a5ULL, 614, 204},
+    {0x98165af37b2153dfULL, 641, 212},
+    {0xe2a0b5dc971f303aULL, 667, 220},
+    {0xa8d9d1535ce3b396ULL, 694, 228},
+    {0xfb9b7cd9a4a7443cULL, 720, 236},
+    {0xbb764c4ca7a44410ULL, 747, 244},
+    {0x8bab8eefb6409c1aULL, 774, 252},
+    {0xd01fef10a657842cULL, 800, 260},
+    {0x9b10a4e5e9913129ULL, 827, 268},
+    {0xe7109bfba19c0c9dULL, 853, 276},
+    {0xac2820d9623bf429ULL, 880, 284},
+    {0x80444b5e7aa7cf85ULL, 907, 292},
+    {0xbf21e44003acdd2dULL, 933, 300},
+    {0x8e679c2f5e44ff8fULL, 960, 308},
+    {0xd433179d9c8cb841ULL, 986, 316},
+    {0x9e19db92b4e31ba9ULL, 1013, 324},
+    {0xeb96bf6ebadf77d9ULL, 1039, 332},
+    {0xaf87023b9bf0ee6bULL, 1066, 340},
+};
+
+constexpr int k_cached_powers_offset = 348;
+constexpr int k_decimal_exponent_distance = 8;
+
+/**
+ * Scaled value has to fit into this range of binary exponents, which means
+ * that its integral part fits into 32 bits.
+ */
+constexpr int k_min_target_exponent = -60;
+constexpr int k_max_target_exponent = -32;
+
+/**
+ * Returns the cached power of ten whose binary exponent is not smaller than
+ * the given one, and not greater than it by more than the target range.
+ */
+const Cached_power &get_cached_power(int min_exponent) {
+  constexpr double k_d_1_log2_10 = 0.30102999566398114;  // 1 / lg(10)
+  const int k = static_cast<int>(
+      std::ceil((min_exponent + k_significand_size - 1) * k_d_1_log2_10));
+  const int index =
+      (k_cached_powers_offset + k - 1) / k_decimal_exponent_distance + 1;
+  const auto &power = k_cached_powers[index];
+  assert(min_exponent <= power.e);
+  assert(power.e <= min_exponent + k_max_target_exponent -
+                        k_min_target_exponent);
+  return power;
+}
+
+void biggest_power_ten(uint32_t number, uint32_t *power,
+                       int *exponent_plus_one) {
+  static constexpr uint32_t k_small_powers[] = {
+      1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+      1000000000};
+
+  *power = 0;
+  *exponent_plus_one = 0;
+
+  for (int i = 9; i >= 0; --i) {
+    if (number >= k_small_powers[i]) {
+      *power = k_small_powers[i];
+      *exponent_plus_one = i + 1;
+      break;
+    }
+  }
+}
+
+/**
+ * Moves the last digit of the generated number closer to the actual value,
+ * if there's a representation within the safe interval which is closer.
+ * Returns false if it cannot be decided whether the result is the closest one
+ * or if it lies within the safe interval.
+ */
+bool round_weed(char *buffer, int length, uint64_t distance_too_high_w,
+                uint64_t unsafe_interval, uint64_t rest, uint64_t ten_kappa,
+                uint64_t unit) {
+  const uint64_t small_distance = distance_too_high_w - unit;
+  const uint64_t big_distance = distance_too_high_w + unit;
+
+  while (rest < small_distance && unsafe_interval - rest >= ten_kappa &&
+         (rest + ten_kappa < small_distance ||
+          small_distance - rest >= rest + ten_kappa - small_distance)) {
+    buffer[length - 1]--;
+    rest += ten_kappa;
+  }
+
+  if (rest < big_distance && unsafe_interval - rest >= ten_kappa &&
+      (rest + ten_kappa < big_distance ||
+       big_distance - rest > rest + ten_kappa - big_distance)) {
+    return false;
+  }
+
+  return (2 * unit <= rest) && (rest <= unsafe_interval - 4 * unit);
+}
+
+/**
+ * Generates the shortest digits of w, which lie within the (scaled)
+ * boundaries low and high. The boundaries are not exact, due to the rounding
+ * of the cached powers, generation fails if the result may be outside of the
+ * actual boundaries.
+ */
+bool digit_gen(const Diy_fp &low, const Diy_fp &w, const Diy_fp &high,
+               char *buffer, int *length, int *kappa) {
+  assert(low.e == w.e && w.e == high.e);
+  assert(k_min_target_exponent <= w.e && w.e <= k_max_target_exponent);
+
+  uint64_t unit = 1;
+  const Diy_fp too_low{low.f - unit, low.e};
+  const Diy_fp too_high{high.f + unit, high.e};
+  uint64_t unsafe_interval = too_high.f - too_low.f;
+  const Diy_fp one{1ULL << -w.e, w.e};
+  auto integrals = static_cast<uint32_t>(too_high.f >> -one.e);
+  uint64_t fractionals = too_high.f & (one.f - 1);
+  uint32_t divisor;
+  int divisor_exponent_plus_one;
+
+  biggest_power_ten(integrals, &divisor, &divisor_exponent_plus_one);
+  *kappa = divisor_exponent_plus_one;
+  *length = 0;
+
+  while (*kappa > 0) {
+    if (*length == k_max_digits) return false;
+
+    buffer[(*length)++] = static_cast<char>('0' + integrals / divisor);
+    integrals %= divisor;
+    --(*kappa);
+
+    const uint64_t rest =
+        (static_cast<uint64_t>(integrals) << -one.e) + fractionals;
+
+    if (rest < unsafe_interval) {
+      return round_weed(buffer, *length, too_high.f - w.f, unsafe_interval,
+                        rest, static_cast<uint64_t>(divisor) << -one.e, unit);
+    }
+
+    divisor /= 10;
+  }
+
+  while (true) {
+    if (*length == k_max_digits) return false;
+
+    fractionals *= 10;
+    unit *= 10;
+    unsafe_interval *= 10;
+
+    buffer[(*length)++] = static_cast<char>('0' + (fractionals >> -one.e));
+    fractionals &= one.f - 1;
+    --(*kappa);
+
+    if (fractionals < unsafe_interval) {
+      return round_weed(buffer, *length, (too_high.f - w.f) * unit,
+                        unsafe_interval, fractionals, one.f, unit);
+    }
+  }
+}
+
+}  // namespace
+
+bool fast_dtoa_shortest(double value, char *digits, int *length, int *decpt) {
+  assert(value > 0 && std::isfinite(value));
+
+  constexpr uint64_t k_hidden_bit = 1ULL << 52;
+  constexpr int k_exponent_bias = 0x3ff + 52;
+
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  const auto biased_exponent = static_cast<int>((bits >> 52) & 0x7ff);
+  uint64_t f = bits & (k_hidden_bit - 1);
+  int e;
+
+  if (0 == biased_exponent) {
+    // denormal
+    e = 1 - k_exponent_bias;
+  } else {
+    f |= k_hidden_bit;
+    e = biased_exponent - k_exponent_bias;
+  }
+
+  // boundaries m- and m+, values between them are rounded to the input, the
+  // lower one is closer if significand is a power of two
+  const Diy_fp w = normalize({f, e});
+  const Diy_fp plus = normalize({(f << 1) + 1, e - 1});
+  Diy_fp minus = (k_hidden_bit == f && biased_exponent > 1)
+                     ? Diy_fp{(f << 2) - 1, e - 2}
+                     : Diy_fp{(f << 1) - 1, e - 1};
+  minus.f <<= minus.e - plus.e;
+  minus.e = plus.e;
+  assert(w.e == plus.e);
+
+  // scale by 10^-k, so that the exponent is in the target range
+  const auto &power =
+      get_cached_power(k_min_target_exponent - (w.e + k_significand_size));
+  const Diy_fp ten_mk{power.f, power.e};
+
+  int kappa;
+
+  if (!digit_gen(multiply(minus, ten_mk), multiply(w, ten_mk),
+                 multiply(plus, ten_mk), digits, length, &kappa)) {
+    return false;
+  }
+
+  *decpt = *length + kappa - power.decimal_exponent;
+
+  while (*length > 1 && '0' == digits[*length - 1]) --(*length);
+
+  return true;
+}
+
+size_t fast_gcvt(double x, my_gcvt_arg_type type, int width, char *to,
+                 bool *error) {
+  assert(width > 0 && to != nullptr);
+
+  // my_gcvt() does not let dtoa() generate more than 'width' digits (sign
+  // excluded), fast path is taken only if shortest representation always
+  // fits, floats are deliberately rounded to FLT_DIG digits
+  int w = width;
+  if (x < 0.) --w;
+
+  if (MY_GCVT_ARG_DOUBLE != type || w < k_max_digits || !std::isfinite(x))
+    return my_gcvt(x, type, width, to, error);
+
+  char digits[k_max_digits];
+  int len;
+  int decpt;
+
+  if (0.0 == x) {
+    digits[0] = '0';
+    len = 1;
+    decpt = 1;
+  } else if (!fast_dtoa_shortest(std::fabs(x), digits, &len, &decpt)) {
+    return my_gcvt(x, type, width, to, error);
+  }
+
+  // choose the format the same way my_gcvt() does
+  const int exp_len =
+      1 + (decpt >= 101 || decpt <= -99) + (decpt >= 11 || decpt <= -9);
+  const bool have_space =
+      (decpt <= 0 ? len - decpt + 2 : decpt < len ? len + 1 : decpt) <= w;
+  const bool force_e_format =
+      decpt <= 0 && w <= 2 - decpt && w >= 3 + exp_len;
+  const bool f_format =
+      (have_space ||
+       ((decpt <= w &&
+         (decpt >= -1 || (decpt == -2 && (len > 1 || !force_e_format)))) &&
+        !force_e_format)) &&
+      (!have_space || (decpt >= -k_max_decpt_for_f_format + 1 &&
+                       (decpt <= k_max_decpt_for_f_format || len > decpt)));
+
+  // digits which do not fit are rounded off by my_gcvt(), this is rare
+  if (f_format) {
+    if (w - (decpt < len) - (decpt <= 0 ? 1 - decpt : 0) < len)
+      return my_gcvt(x, type, width, to, error);
+  } else {
+    if (w - (decpt <= 0) - (1 + exp_len) - (len > 1) < len)
+      return my_gcvt(x, type, width, to, error);
+  }
+
+  char *dst = to;
+
+  if (std::signbit(x)) *dst++ = '-';
+
+  if (f_format) {
+    if (decpt <= 0) {
+      *dst++ = '0';
+      *dst++ = '.';
+      for (int i = decpt; i < 0; ++i) *dst++ = '0';
+    }
+
+    for (int i = 1; i <= len; ++i) {
+      *dst++ = digits[i - 1];
+      if (i == decpt && i < len) *dst++ = '.';
+    }
+
+    for (int i = len; i < decpt; ++i) *dst++ = '0';
+  } else {
+    *dst++ = digits[0];
+
+    if (len > 1) {
+      *dst++ = '.';
+      std::memcpy(dst, digits + 1, len - 1);
+      dst += len - 1;
+    }
+
+    *dst++ = 'e';
+
+    int exponent = decpt - 1;
+
+    if (exponent < 0) {
+      *dst++ = '-';
+      exponent = -exponent;
+    }
+
+    if (exponent >= 100) {
+      *dst++ = static_cast<char>('0' + exponent / 100);
+      exponent %= 100;
+      *dst++ = static_cast<char>('0' + exponent / 10);
+    } else if (exponent >= 10) {
+      *dst++ = static_cast<char>('0' + exponent / 10);
+    }
+
+    *dst++ = static_cast<char>('0' + exponent % 10);
+  }
+
+  assert(dst - to <= width);
+  *dst = '\0';
+
+  if (error != nullptr) *error = false;
+
+  return dst - to;
+}
+
+}  // namespace shcore
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_FAST_DTOA_H_
+#define MYSQLSHDK_LIBS_UTILS_FAST_DTOA_H_
+
+#include <cstdlib>
+
+#include "mysqlshdk/libs/utils/dtoa.h"
+
+namespace shcore {
+
+/**
+ * Generates the shortest string of decimal digits which converts back to the
+ * given value, choosing the one closest to the value if there are many. Uses
+ * the Grisu3 algorithm by Florian Loitsch, which works with 64-bit integers
+ * only and gives up in the very few cases where it cannot prove that the
+ * result is the shortest and closest one.
+ *
+ * @param value finite, positive number
+ * @param digits receives the digits, no terminating zero, must have room for
+ *        at least 17 characters
+ * @param length receives the number of digits
+ * @param decpt receives the position of the decimal point, relative to the
+ *        first digit (the value is 0.<digits> * 10^decpt)
+ *
+ * @returns false if the digits could not be computed.
+ */
+bool fast_dtoa_shortest(double value, char *digits, int *length, int *decpt);
+
+/**
+ * Drop-in replacement of my_gcvt(), producing exactly the same output.
+ *
+ * Double values which are formatted with all their significant digits (i.e.
+ * width is big enough) use fast_dtoa_shortest(), everything else is handled
+ * by my_gcvt().
+ */
+size_t fast_gcvt(double x, my_gcvt_arg_type type, int width, char *to,
+                 bool *error);
+
+}  // namespace shcore
+
+#endif  // MYSQLSHDK_LIBS_UTILS_FAST_DTOA_H_
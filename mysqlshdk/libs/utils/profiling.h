@@ -109,6 +109,27 @@ inline void stage_end() {
   if (utils::g_active_timer) utils::g_active_timer->stage_end();
 }
 
+/**
+ * Records a stage in the active timer (if any), which lasts until the end of
+ * the scope.
+ */
+class Scoped_stage {
+ public:
+  explicit Scoped_stage(const char *note) : m_active(utils::g_active_timer) {
+    if (m_active) m_active->stage_begin(note);
+  }
+
+  Scoped_stage(const Scoped_stage &) = delete;
+  Scoped_stage &operator=(const Scoped_stage &) = delete;
+
+  ~Scoped_stage() {
+    if (m_active && m_active == utils::g_active_timer) m_active->stage_end();
+  }
+
+ private:
+  utils::Profile_timer *m_active;
+};
+
 }  // namespace mysqlshdk
 
 #endif  // MYSQLSHDK_LIBS_UTILS_PROFILING_H_
@@ -29,14 +29,15 @@
 #include <rapidjson/writer.h>
 #include <string>
 
-#include "mysqlshdk/libs/utils/dtoa.h"
+#include "mysqlshdk/libs/utils/fast_dtoa.h"
 #include "mysqlshdk_export.h"
 
 namespace shcore {
 /**
  * Raw JSON wrapper with custom conversion of the Double value using
- * the my_gcvt function ported from the server, which generates a string
- * value with the most number of significat digits and thus precision.
+ * fast_gcvt(), which generates the same string as the my_gcvt function ported
+ * from the server, with the most number of significat digits and thus
+ * precision.
  */
 template <typename T>
 class My_writer : public rapidjson::Writer<T> {
@@ -45,7 +46,7 @@ class My_writer : public rapidjson::Writer<T> {
   bool Double(double data) {
     char buffer[32];
     size_t len;
-    len = my_gcvt(data, MY_GCVT_ARG_DOUBLE, sizeof(buffer) - 1, buffer, NULL);
+    len = fast_gcvt(data, MY_GCVT_ARG_DOUBLE, sizeof(buffer) - 1, buffer, NULL);
 
     rapidjson::Writer<T>::Prefix(rapidjson::kNumberType);
     return rapidjson::Writer<T>::WriteRawValue(buffer, len);
@@ -54,8 +55,9 @@ class My_writer : public rapidjson::Writer<T> {
 
 /**
  * Pretty JSON wrapper with custom conversion of the Double value using
- * the my_gcvt function ported from the server, which generates a string
- * value with the most number of significat digits and thus precision.
+ * fast_gcvt(), which generates the same string as the my_gcvt function ported
+ * from the server, with the most number of significat digits and thus
+ * precision.
  */
 template <typename T>
 class My_pretty_writer : public rapidjson::PrettyWriter<T> {
@@ -64,7 +66,7 @@ class My_pretty_writer : public rapidjson::PrettyWriter<T> {
   bool Double(double data) {
     char buffer[32];
     size_t len;
-    len = my_gcvt(data, MY_GCVT_ARG_DOUBLE, sizeof(buffer) - 1, buffer, NULL);
+    len = fast_gcvt(data, MY_GCVT_ARG_DOUBLE, sizeof(buffer) - 1, buffer, NULL);
 
     rapidjson::PrettyWriter<T>::PrettyPrefix(rapidjson::kNumberType);
     return rapidjson::PrettyWriter<T>::WriteRawValue(buffer, len);
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "scripting/jscript_code_cache.h"
+
+#include <fstream>
+#include <iterator>
+#include <random>
+
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace shcore {
+
+namespace {
+
+constexpr const char k_entry_magic[] = "MYSQLSH-JSCACHE 1\n";
+
+/**
+ * 64-bit FNV-1a, stable between builds and platforms.
+ */
+uint64_t hash(const std::string &data) {
+  uint64_t h = 14695981039346656037ULL;
+  for (const char c : data) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+std::string entry_header(const std::string &source) {
+  return k_entry_magic +
+         str_format("%016llx %zu\n",
+                    static_cast<unsigned long long>(hash(source)),  // NOLINT
+                    source.size());
+}
+
+}  // namespace
+
+JScript_code_cache::JScript_code_cache(const std::string &directory)
+    : m_directory(directory) {}
+
+std::string JScript_code_cache::default_directory() {
+  try {
+    return path::join_path(get_user_config_path(), "cache", "js");
+  } catch (const std::exception &e) {
+    log_debug("JS code cache is disabled: %s", e.what());
+    return "";
+  }
+}
+
+std::string JScript_code_cache::entry_path(const std::string &key) const {
+  return path::join_path(
+      m_directory,
+      str_format("%016llx.jsc",
+                 static_cast<unsigned long long>(hash(key))));  // NOLINT
+}
+
+bool JScript_code_cache::load(const std::string &key, const std::string &source,
+                              std::string *data) const {
+  if (!enabled()) return false;
+
+  std::ifstream in(entry_path(key), std::ios::binary);
+  if (!in.good()) return false;
+
+  const std::string header = entry_header(source);
+  std::string contents{std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>()};
+
+  if (contents.size() <= header.size() ||
+      contents.compare(0, header.size(), header) != 0)
+    return false;
+
+  data->assign(contents, header.size(), std::string::npos);
+  return true;
+}
+
+void JScript_code_cache::store(const std::string &key,
+                               const std::string &source, const uint8_t *data,
+                               size_t length) const {
+  if (!enabled()) return;
+
+  try {
+    if (!is_folder(m_directory)) create_directory(m_directory, true);
+
+    // write to a temporary file first, so that concurrent instances never see
+    // a partial entry
+    const std::string entry = entry_path(key);
+    const std::string tmp_path =
+        entry + str_format(".%x", std::random_device{}());
+    {
+      std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+      const std::string header = entry_header(source);
+      out.write(header.data(), header.size());
+      out.write(reinterpret_cast<const char *>(data), length);
+      if (!out.good()) {
+        out.close();
+        delete_file(tmp_path);
+        return;
+      }
+    }
+
+#ifdef _WIN32
+    // rename() does not replace existing files
+    delete_file(entry);
+#endif
+
+    try {
+      rename_file(tmp_path, entry);
+    } catch (...) {
+      delete_file(tmp_path);
+      throw;
+    }
+  } catch (const std::exception &e) {
+    log_debug("Failed to store JS code cache of '%s': %s", key.c_str(),
+              e.what());
+  }
+}
+
+void JScript_code_cache::remove(const std::string &key) const {
+  if (enabled()) delete_file(entry_path(key));
+}
+
+}  // namespace shcore
@@ -38,6 +38,7 @@
 #include "scripting/object_registry.h"
 
 #include "scripting/jscript_array_wrapper.h"
+#include "scripting/jscript_code_cache.h"
 #include "scripting/jscript_function_wrapper.h"
 #include "scripting/jscript_map_wrapper.h"
 #include "scripting/jscript_object_wrapper.h"
@@ -100,13 +101,15 @@ struct JScript_context::JScript_context_impl {
   std::unique_ptr<v8::ArrayBuffer::Allocator> m_allocator;
   bool m_terminating = false;
   std::vector<v8::Global<v8::Context>> m_stored_contexts;
+  JScript_code_cache m_code_cache;
 
  public:
   JScript_context_impl(JScript_context *owner_)
       : owner(owner_),
         types(owner_),
         isolate(nullptr),
-        m_allocator(v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {
+        m_allocator(v8::ArrayBuffer::Allocator::NewDefaultAllocator()),
+        m_code_cache(JScript_code_cache::default_directory()) {
     JScript_context_init();
 
     v8::Isolate::CreateParams params;
@@ -193,7 +196,7 @@ struct JScript_context::JScript_context_impl {
     std::string source = "(function (){" + shcore::js_core_module + "});";
 
     // Result must be valid or an exception is thrown.
-    result = _build_module(v8_string("core.js"), v8_string(source));
+    result = _build_module("core.js", source);
 
     // It is expected to have a function on the core module.
     if (result->IsFunction()) {
@@ -511,8 +514,59 @@ struct JScript_context::JScript_context_impl {
     }
   }
 
-  v8::Local<v8::Value> _build_module(v8::Local<v8::String> origin,
-                                     v8::Local<v8::String> source) {
+  /**
+   * Compiles the script, consuming its code cache if there is one.
+   *
+   * @param cache_key key of the code cache entry, cache is not used if empty
+   * @param produce_cache set to true if the code cache has to be (re)created,
+   *        store_code_cache() should be called once the script is executed,
+   *        so that the cache includes the functions which were compiled
+   *        lazily.
+   */
+  v8::MaybeLocal<v8::Script> compile(v8::Local<v8::Context> lcontext,
+                                     v8::Local<v8::String> origin,
+                                     const std::string &code,
+                                     const std::string &cache_key,
+                                     bool *produce_cache) {
+    v8::ScriptOrigin script_origin{origin};
+    const auto source = v8_string(code);
+    *produce_cache = false;
+
+    if (cache_key.empty() || !m_code_cache.enabled())
+      return v8::Script::Compile(lcontext, source, &script_origin);
+
+    std::string cached;
+
+    if (m_code_cache.load(cache_key, code, &cached)) {
+      // the buffer is not owned by CachedData, it outlives the compilation
+      v8::ScriptCompiler::Source cached_source(
+          source, script_origin,
+          new v8::ScriptCompiler::CachedData(
+              reinterpret_cast<const uint8_t *>(cached.data()),
+              static_cast<int>(cached.size())));
+      const auto script = v8::ScriptCompiler::Compile(
+          lcontext, &cached_source, v8::ScriptCompiler::kConsumeCodeCache);
+      // if V8 rejected the cache (i.e. it was created by a different version),
+      // script was compiled from scratch
+      *produce_cache = cached_source.GetCachedData()->rejected;
+      return script;
+    }
+
+    v8::ScriptCompiler::Source plain_source(source, script_origin);
+    *produce_cache = true;
+    return v8::ScriptCompiler::Compile(lcontext, &plain_source);
+  }
+
+  void store_code_cache(const std::string &cache_key, const std::string &code,
+                        v8::Local<v8::Script> script) {
+    std::unique_ptr<v8::ScriptCompiler::CachedData> data{
+        v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript())};
+
+    if (data) m_code_cache.store(cache_key, code, data->data, data->length);
+  }
+
+  v8::Local<v8::Value> _build_module(const std::string &origin,
+                                     const std::string &source) {
     v8::MaybeLocal<v8::Value> result;
     // makes _isolate the default isolate for this context
     v8::EscapableHandleScope handle_scope(isolate);
@@ -523,19 +577,22 @@ struct JScript_context::JScript_context_impl {
         v8::Local<v8::Context>::New(isolate, context);
     v8::Context::Scope context_scope(lcontext);
 
-    v8::MaybeLocal<v8::Script> script;
-    v8::ScriptOrigin script_origin{origin};
-    script = v8::Script::Compile(lcontext, source, &script_origin);
+    // modules are cached by their path
+    bool produce_cache = false;
+    v8::MaybeLocal<v8::Script> script =
+        compile(lcontext, v8_string(origin), source, origin, &produce_cache);
     if (!script.IsEmpty()) result = script.ToLocalChecked()->Run(lcontext);
 
     if (result.IsEmpty()) {
-      std::string exception_text = "Error loading module at " +
-                                   to_string(origin) + ". " +
+      std::string exception_text = "Error loading module at " + origin + ". " +
                                    to_string(try_catch.Exception());
 
       throw shcore::Exception::scripting_error(exception_text);
     }
 
+    if (produce_cache)
+      store_code_cache(origin, source, script.ToLocalChecked());
+
     return handle_scope.Escape(result.ToLocalChecked());
   }
 
@@ -543,8 +600,8 @@ struct JScript_context::JScript_context_impl {
     const auto isolate = args.GetIsolate();
     const auto self = static_cast<JScript_context_impl *>(isolate->GetData(0));
 
-    v8::Local<v8::String> origin = v8::Local<v8::String>::Cast(args[0]);
-    v8::Local<v8::String> source = v8::Local<v8::String>::Cast(args[1]);
+    const auto origin = to_string(isolate, args[0]);
+    const auto source = to_string(isolate, args[1]);
 
     // Build the module which will return the built function
     v8::Local<v8::Value> result = self->_build_module(origin, source);
@@ -1054,10 +1111,13 @@ std::pair<Value, bool> JScript_context::execute(
   // set _context to be the default context for everything in this scope
   v8::Local<v8::Context> lcontext = context();
   v8::Context::Scope context_scope(lcontext);
-  v8::ScriptOrigin origin(v8_string(source));
-  v8::Local<v8::String> code = v8_string(code_str);
-  v8::MaybeLocal<v8::Script> script =
-      v8::Script::Compile(lcontext, code, &origin);
+  // only scripts loaded from files are cached, code given on command line or
+  // by the user in any other way is unlikely to be executed again
+  const std::string cache_key =
+      !source.empty() && is_file(source) ? source : "";
+  bool produce_cache = false;
+  v8::MaybeLocal<v8::Script> script = _impl->compile(
+      lcontext, v8_string(source), code_str, cache_key, &produce_cache);
 
   // Since ret_val can't be used to check whether all was ok or not
   // Will use a boolean flag
@@ -1080,7 +1140,12 @@ std::pair<Value, bool> JScript_context::execute(
           mysqlsh::Output_stream::STDERR);
 
       return {Value(), true};
-    } else if (!try_catch.HasCaught()) {
+    }
+
+    if (produce_cache)
+      _impl->store_code_cache(cache_key, code_str, script.ToLocalChecked());
+
+    if (!try_catch.HasCaught()) {
       return {v8_value_to_shcore_value(result.ToLocalChecked()), false};
     } else {
       Value e = get_v8_exception_data(try_catch, false);
@@ -1320,10 +1385,10 @@ void JScript_context::load_plugin(const std::string &file_name) {
     const auto new_context = _impl->copy_global_context();
     v8::Context::Scope context_scope(new_context);
 
-    v8::ScriptOrigin script_origin{
-        v8_string(shcore::path::basename(file_name))};
-    v8::MaybeLocal<v8::Script> script =
-        v8::Script::Compile(new_context, v8_string(source), &script_origin);
+    bool produce_cache = false;
+    v8::MaybeLocal<v8::Script> script = _impl->compile(
+        new_context, v8_string(shcore::path::basename(file_name)), source,
+        file_name, &produce_cache);
 
     if (script.IsEmpty()) {
       _impl->delete_context(new_context);
@@ -1331,6 +1396,9 @@ void JScript_context::load_plugin(const std::string &file_name) {
     } else {
       auto result = script.ToLocalChecked()->Run(new_context);
 
+      if (produce_cache)
+        _impl->store_code_cache(file_name, source, script.ToLocalChecked());
+
       // store the context even if an exception was thrown, we don't know when
       // exception was generated, script could have done something meaningful
       // before that happened
@@ -80,7 +80,7 @@ v8::Local<v8::Value> translate_exception(JScript_context *context) {
 }  // namespace
 
 JScript_object_wrapper::JScript_object_wrapper(JScript_context *context,
-                                               bool indexed)
+                                               bool indexed, bool iterable)
     : _context(context), _method_wrapper(context) {
   v8::Local<v8::ObjectTemplate> templ =
       v8::ObjectTemplate::New(_context->isolate());
@@ -100,6 +100,12 @@ JScript_object_wrapper::JScript_object_wrapper(JScript_context *context,
         &JScript_object_wrapper::handler_isetter, 0, 0,
         &JScript_object_wrapper::handler_ienumerator);
 
+  // symbols are not intercepted by the named property handler
+  if (iterable)
+    templ->Set(v8::Symbol::GetIterator(_context->isolate()),
+               v8::FunctionTemplate::New(_context->isolate(),
+                                         &JScript_object_wrapper::iterator));
+
   templ->SetInternalFieldCount(3);
 }
 
@@ -141,6 +147,19 @@ void JScript_object_wrapper::handler_getter(
     return;
   }
 
+  // method wrappers are cached in the object, so that calling a method
+  // repeatedly (i.e. in a loop) does not create a new wrapper each time
+  const auto context = info.GetIsolate()->GetCurrentContext();
+  const auto method_key =
+      v8::Private::ForApi(info.GetIsolate(), property.As<v8::String>());
+  v8::Local<v8::Value> method;
+
+  if (obj->GetPrivate(context, method_key).ToLocal(&method) &&
+      method->IsObject()) {
+    info.GetReturnValue().Set(method);
+    return;
+  }
+
   const auto prop = to_string(info.GetIsolate(), property);
   /*if (prop == "__members__")
   {
@@ -173,7 +192,9 @@ void JScript_object_wrapper::handler_getter(
   {
     try {
       if (object->has_method(prop)) {
-        info.GetReturnValue().Set(self->_method_wrapper.wrap(object, prop));
+        method = self->_method_wrapper.wrap(object, prop);
+        obj->SetPrivate(context, method_key, method).FromJust();
+        info.GetReturnValue().Set(method);
       } else {
         Value member = object->get_member(prop);
         info.GetReturnValue().Set(
@@ -361,6 +382,74 @@ bool JScript_object_wrapper::unwrap(
   return false;
 }
 
+void JScript_object_wrapper::iterator(
+    const v8::FunctionCallbackInfo<v8::Value> &args) {
+  const auto isolate = args.GetIsolate();
+  v8::HandleScope hscope(isolate);
+  const auto context = isolate->GetCurrentContext();
+
+  if (!is_object(args.This())) {
+    isolate->ThrowException(v8::Exception::TypeError(
+        v8_string(isolate, "Iterator called on an invalid object")));
+    return;
+  }
+
+  // the iterator keeps a reference to the iterated object
+  v8::Local<v8::Function> next;
+  if (!v8::Function::New(context, &JScript_object_wrapper::iterator_next,
+                         args.This())
+           .ToLocal(&next))
+    return;
+
+  const auto it = v8::Object::New(isolate);
+  it->Set(context, v8_string(isolate, "next"), next).FromJust();
+  args.GetReturnValue().Set(it);
+}
+
+void JScript_object_wrapper::iterator_next(
+    const v8::FunctionCallbackInfo<v8::Value> &args) {
+  const auto isolate = args.GetIsolate();
+  v8::HandleScope hscope(isolate);
+  const auto context = isolate->GetCurrentContext();
+  const auto obj = args.Data().As<v8::Object>();
+  const auto self = static_cast<JScript_object_wrapper *>(
+      obj->GetAlignedPointerFromInternalField(2));
+  const auto &object = static_cast<Object_collectable *>(
+                           obj->GetAlignedPointerFromInternalField(1))
+                           ->data();
+
+  if (!object) {
+    isolate->ThrowException(v8_string(isolate, "Reference to invalid object"));
+    return;
+  }
+
+  if (self->_context->is_terminating()) return;
+
+  try {
+    const auto item = object->next_item();
+    const bool done = item.type == Undefined || item.type == Null;
+
+    const auto result = v8::Object::New(isolate);
+    result
+        ->Set(context, v8_string(isolate, "value"),
+              done ? v8::Undefined(isolate).As<v8::Value>()
+                   : self->_context->shcore_value_to_v8_value(item))
+        .FromJust();
+    result
+        ->Set(context, v8_string(isolate, "done"),
+              v8::Boolean::New(isolate, done))
+        .FromJust();
+    args.GetReturnValue().Set(result);
+  } catch (Exception &exc) {
+    auto jsexc = self->_context->shcore_value_to_v8_value(Value(exc.error()));
+    if (jsexc.IsEmpty())
+      jsexc = self->_context->shcore_value_to_v8_value(Value(exc.format()));
+    isolate->ThrowException(jsexc);
+  } catch (std::exception &exc) {
+    isolate->ThrowException(v8_string(isolate, exc.what()));
+  }
+}
+
 bool JScript_object_wrapper::is_object(v8::Local<v8::Object> value) {
   return (value->InternalFieldCount() == 3 &&
           value->GetAlignedPointerFromInternalField(0) ==
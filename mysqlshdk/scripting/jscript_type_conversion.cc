@@ -46,6 +46,7 @@ JScript_type_bridger::JScript_type_bridger(JScript_context *context)
     : owner(context),
       object_wrapper(NULL),
       indexed_object_wrapper(NULL),
+      iterable_object_wrapper(NULL),
       function_wrapper(NULL),
       map_wrapper(NULL),
       array_wrapper(NULL) {}
@@ -53,6 +54,7 @@ JScript_type_bridger::JScript_type_bridger(JScript_context *context)
 void JScript_type_bridger::init() {
   object_wrapper = new JScript_object_wrapper(owner);
   indexed_object_wrapper = new JScript_object_wrapper(owner, true);
+  iterable_object_wrapper = new JScript_object_wrapper(owner, false, true);
   map_wrapper = new JScript_map_wrapper(owner);
   array_wrapper = new JScript_array_wrapper(owner);
   function_wrapper = new JScript_function_wrapper(owner);
@@ -69,6 +71,11 @@ void JScript_type_bridger::dispose() {
     indexed_object_wrapper = NULL;
   }
 
+  if (iterable_object_wrapper) {
+    delete iterable_object_wrapper;
+    iterable_object_wrapper = NULL;
+  }
+
   if (function_wrapper) {
     delete function_wrapper;
     function_wrapper = NULL;
@@ -115,8 +122,10 @@ v8::Local<v8::Value> JScript_type_bridger::native_object_to_js(
     return result.ToLocalChecked();
   }
 
-  return object->is_indexed() ? indexed_object_wrapper->wrap(object)
-                              : object_wrapper->wrap(object);
+  if (object->is_indexed()) return indexed_object_wrapper->wrap(object);
+
+  return object->is_iterable() ? iterable_object_wrapper->wrap(object)
+                               : object_wrapper->wrap(object);
 }
 
 Object_bridge_ref JScript_type_bridger::js_object_to_native(
@@ -198,12 +207,15 @@ Value JScript_type_bridger::v8_value_to_shcore_value(
       const auto lcontext = owner->context();
       v8::Local<v8::Array> pnames(
           jsobject->GetPropertyNames(lcontext).ToLocalChecked());
-      std::shared_ptr<Value::Map_type> map_ptr(new Value::Map_type);
+      Value::Map_type::container_type entries;
+      entries.reserve(pnames->Length());
       for (int32_t c = pnames->Length(), i = 0; i < c; i++) {
         v8::Local<v8::Value> k(pnames->Get(lcontext, i).ToLocalChecked());
         v8::Local<v8::Value> v(jsobject->Get(lcontext, k).ToLocalChecked());
-        (*map_ptr)[owner->to_string(k)] = v8_value_to_shcore_value(v);
+        entries.emplace_back(owner->to_string(k), v8_value_to_shcore_value(v));
       }
+      std::shared_ptr<Value::Map_type> map_ptr(new Value::Map_type);
+      map_ptr->assign(std::move(entries));
       return Value(map_ptr);
     }
   } else {
@@ -226,7 +238,7 @@ v8::Local<v8::Value> JScript_type_bridger::shcore_value_to_v8_value(
       r = v8::Boolean::New(owner->isolate(), value.value.b);
       break;
     case String:
-      r = owner->v8_string(*value.value.s);
+      r = owner->v8_string(value.value.s);
       break;
     case Integer:
       r = v8::Integer::New(owner->isolate(), value.value.i);
@@ -238,19 +250,19 @@ v8::Local<v8::Value> JScript_type_bridger::shcore_value_to_v8_value(
       r = v8::Number::New(owner->isolate(), value.value.d);
       break;
     case Object:
-      r = native_object_to_js(*value.value.o);
+      r = native_object_to_js(value.value.o);
       break;
     case Array:
       // maybe convert fully
-      r = array_wrapper->wrap(*value.value.array);
+      r = array_wrapper->wrap(value.value.array);
       break;
     case Map:
       // maybe convert fully
-      // r = native_map_to_js(*value.value.map);
-      r = map_wrapper->wrap(*value.value.map);
+      // r = native_map_to_js(value.value.map);
+      r = map_wrapper->wrap(value.value.map);
       break;
     case MapRef: {
-      std::shared_ptr<Value::Map_type> map(value.value.mapref->lock());
+      std::shared_ptr<Value::Map_type> map(value.value.mapref.lock());
       if (map) {
         throw std::invalid_argument(
             "Cannot convert internal value to JS: wrapmapref not "
@@ -258,7 +270,7 @@ v8::Local<v8::Value> JScript_type_bridger::shcore_value_to_v8_value(
       }
     } break;
     case shcore::Function:
-      r = function_wrapper->wrap(*value.value.func);
+      r = function_wrapper->wrap(value.value.func);
       break;
   }
   return r;
@@ -271,6 +271,16 @@ static PyObject *object_getattro(PyShObjObject *self, PyObject *attr_name) {
   if (PyString_Check(attr_name)) {
     const char *attrname = PyString_AsString(attr_name);
     PyObject *object;
+
+    // cached methods are not shadowed by the generic attributes, as they were
+    // not found there in the first place
+    const auto method = self->cache->methods.find(attrname);
+    if (method != self->cache->methods.end()) {
+      object = method->second;
+      Py_INCREF(object);
+      return object;
+    }
+
     if ((object = PyObject_GenericGetAttr((PyObject *)self, attr_name)))
       return object;
     PyErr_Clear();
@@ -278,8 +288,11 @@ static PyObject *object_getattro(PyShObjObject *self, PyObject *attr_name) {
     std::shared_ptr<Cpp_object_bridge> cobj(
         std::static_pointer_cast<Cpp_object_bridge>(*self->object));
 
-    if (cobj->has_method_advanced(attrname, shcore::LowerCaseUnderscores))
-      return wrap_method(cobj, attrname);
+    if (cobj->has_method_advanced(attrname, shcore::LowerCaseUnderscores)) {
+      object = wrap_method(cobj, attrname);
+      if (object) self->cache->methods[attrname] = object;
+      return object;
+    }
 
     shcore::Value member;
     bool error_handled = false;
@@ -502,6 +515,49 @@ int object_assign(PyShObjObject *self, Py_ssize_t index, PyObject *value) {
   return -1;
 }
 
+static PyObject *object_next_item(PyShObjObject *self, PyObject *) {
+  Python_context *ctx = Python_context::get_and_check();
+  if (!ctx) return NULL;
+
+  try {
+    Value item;
+
+    {
+      WillLeavePython lock;
+      item = self->object->get()->next_item();
+    }
+
+    return ctx->shcore_value_to_pyobj(item);
+  } catch (...) {
+    translate_python_exception();
+    return NULL;
+  }
+}
+
+static PyMethodDef PyShObjNextItemMethod = {
+    "__next_item__", (PyCFunction)object_next_item, METH_NOARGS, NULL};
+
+/**
+ * Iterator of objects which support it (i.e. results), calls next_item()
+ * until it returns None.
+ */
+static PyObject *object_iter(PyShObjObject *self) {
+  if (!self->object->get()->is_iterable()) {
+    Python_context::set_python_error(PyExc_TypeError,
+                                     "object is not iterable");
+    return NULL;
+  }
+
+  PyObject *next = PyCFunction_New(&PyShObjNextItemMethod,
+                                   reinterpret_cast<PyObject *>(self));
+  if (!next) return NULL;
+
+  PyObject *iter = PyCallIter_New(next, Py_None);
+  Py_DECREF(next);
+
+  return iter;
+}
+
 static PyMethodDef PyShObjMethods[] = {
     {"__callmethod__", (PyCFunction)object_callmethod, METH_VARARGS, call_doc},
     {NULL, NULL, 0, NULL}};
@@ -581,8 +637,8 @@ static PyTypeObject PyShObjObjectType = {
 
     /* Added in release 2.2 */
     /* Iterators */
-    0,  // getiterfunc tp_iter;
-    0,  // iternextfunc tp_iternext;
+    (getiterfunc)object_iter,  // getiterfunc tp_iter;
+    0,                         // iternextfunc tp_iternext;
 
     /* Attribute descriptor and subclassing stuff */
     PyShObjMethods,         // struct PyMethodDef *tp_methods;
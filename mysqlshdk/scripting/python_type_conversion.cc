@@ -128,20 +128,25 @@ Value Python_type_bridger::pyobj_to_shcore_value(PyObject *py) const {
     }
     return Value(array);
   } else if (PyDict_Check(py)) {
-    std::shared_ptr<Value::Map_type> map(new Value::Map_type);
+    Value::Map_type::container_type entries;
 
     PyObject *key, *value;
     Py_ssize_t pos = 0;
 
+    entries.reserve(PyDict_Size(py));
+
     while (PyDict_Next(py, &pos, &key, &value)) {
       // The key may be anything (not necesarily a string)
       // so we get the string representation of whatever it is
       PyObject *key_repr = PyObject_Str(key);
-      (*map)[PyString_AsString(key_repr)] = pyobj_to_shcore_value(value);
+      entries.emplace_back(PyString_AsString(key_repr),
+                           pyobj_to_shcore_value(value));
 
       Py_DECREF(key_repr);
     }
 
+    std::shared_ptr<Value::Map_type> map(new Value::Map_type);
+    map->assign(std::move(entries));
     return Value(map);
   } else if (PyFunction_Check(py)) {
     std::shared_ptr<shcore::Python_function> function(
@@ -196,7 +201,7 @@ PyObject *Python_type_bridger::shcore_value_to_pyobj(const Value &value) {
       r = PyBool_FromLong(value.value.b);
       break;
     case String:
-      r = PyString_FromString(value.value.s->c_str());
+      r = PyString_FromString(value.value.s.c_str());
       break;
     case Integer:
       r = PyLong_FromLongLong(value.value.i);
@@ -208,18 +213,18 @@ PyObject *Python_type_bridger::shcore_value_to_pyobj(const Value &value) {
       r = PyFloat_FromDouble(value.value.d);
       break;
     case Object:
-      r = wrap(*value.value.o);
+      r = wrap(value.value.o);
       break;
     case Array:
-      r = wrap(*value.value.array);
+      r = wrap(value.value.array);
       break;
     case Map:
-      r = wrap(*value.value.map);
+      r = wrap(value.value.map);
       break;
     case MapRef:
       /*
       {
-      std::shared_ptr<Value::Map_type> map(value.value.mapref->lock());
+      std::shared_ptr<Value::Map_type> map(value.value.mapref.lock());
       if (map)
       {
       std::cout << "wrapmapref not implemented\n";
@@ -229,7 +234,7 @@ PyObject *Python_type_bridger::shcore_value_to_pyobj(const Value &value) {
       r = Py_None;
       break;
     case shcore::Function:
-      r = wrap(*value.value.func);
+      r = wrap(value.value.func);
       break;
   }
   return r;
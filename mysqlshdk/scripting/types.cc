@@ -22,7 +22,10 @@
  */
 
 #include "scripting/types.h"
+#include <rapidjson/error/en.h>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/reader.h>
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdarg>
@@ -33,7 +36,7 @@
 #include <sstream>
 #include <stdexcept>
 #include "mysqlshdk/libs/utils/logger.h"
-#include "utils/dtoa.h"
+#include "utils/fast_dtoa.h"
 #include "utils/utils_general.h"
 #include "utils/utils_string.h"
 
@@ -200,13 +203,13 @@ void Exception::set_file_context(const std::string &file, size_t line) {
 
 const char *Exception::what() const noexcept {
   if ((*_error)["message"].type == String)
-    return (*_error)["message"].value.s->c_str();
+    return (*_error)["message"].value.s.c_str();
   return "?";
 }
 
 const char *Exception::type() const noexcept {
   if ((*_error)["type"].type == String)
-    return (*_error)["type"].value.s->c_str();
+    return (*_error)["type"].value.s.c_str();
   return "Exception";
 }
 
@@ -392,6 +395,25 @@ std::shared_ptr<Value::Array_type> Value::Map_type::get_array(
   return iter->second.as_array();
 }
 
+void Value::Map_type::assign(container_type &&entries) {
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const value_type &l, const value_type &r) {
+                     return l.first < r.first;
+                   });
+
+  // out of the entries with the same key, the last one is kept
+  auto out = entries.begin();
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    const auto next = it + 1;
+    if (next != entries.end() && next->first == it->first) continue;
+    if (out != it) *out = std::move(*it);
+    ++out;
+  }
+  entries.erase(out, entries.end());
+
+  _map = std::move(entries);
+}
+
 void Value::Map_type::merge_contents(std::shared_ptr<Map_type> source,
                                      bool overwrite) {
   Value::Map_type::const_iterator iter;
@@ -405,16 +427,24 @@ void Value::Map_type::merge_contents(std::shared_ptr<Map_type> source,
   }
 }
 
-Value::Value(const Value &copy) : type(shcore::Null) { operator=(copy); }
+Value::Value(const Value &copy) : type(Undefined) { construct(copy); }
+
+Value::Value(Value &&other) noexcept : type(Undefined) {
+  construct(std::move(other));
+}
 
 Value::Value(const std::string &s) : type(String) {
-  value.s = new std::string(s);
+  new (&value.s) std::string(s);
+}
+
+Value::Value(std::string &&s) : type(String) {
+  new (&value.s) std::string(std::move(s));
 }
 
 Value::Value(const char *s) {
   if (s) {
     type = String;
-    value.s = new std::string(s);
+    new (&value.s) std::string(s);
   } else {
     type = shcore::Null;
   }
@@ -423,7 +453,7 @@ Value::Value(const char *s) {
 Value::Value(const char *s, size_t n) {
   if (s) {
     type = String;
-    value.s = new std::string(s, n);
+    new (&value.s) std::string(s, n);
   } else {
     type = shcore::Null;
   }
@@ -442,7 +472,7 @@ Value::Value(float f) : type(Float) {
   // binary IEEE representation, which will result in a different number
   // So we convert through decimal instead
   char buffer[100];
-  my_gcvt(f, MY_GCVT_ARG_FLOAT, sizeof(buffer) - 1, buffer, NULL);
+  fast_gcvt(f, MY_GCVT_ARG_FLOAT, sizeof(buffer) - 1, buffer, NULL);
   value.d = std::stod(buffer);
 }
 
@@ -452,7 +482,7 @@ Value::Value(bool b) : type(Bool) { value.b = b; }
 
 Value::Value(std::shared_ptr<Function_base> f) : type(Function) {
   if (f) {
-    value.func = new std::shared_ptr<Function_base>(f);
+    new (&value.func) std::shared_ptr<Function_base>(std::move(f));
   } else {
     type = shcore::Null;
   }
@@ -460,7 +490,7 @@ Value::Value(std::shared_ptr<Function_base> f) : type(Function) {
 
 Value::Value(std::shared_ptr<Object_bridge> n) : type(Object) {
   if (n) {
-    value.o = new std::shared_ptr<Object_bridge>(n);
+    new (&value.o) std::shared_ptr<Object_bridge>(std::move(n));
   } else {
     type = shcore::Null;
   }
@@ -468,29 +498,149 @@ Value::Value(std::shared_ptr<Object_bridge> n) : type(Object) {
 
 Value::Value(Map_type_ref n) : type(Map) {
   if (n) {
-    value.map = new std::shared_ptr<Map_type>(n);
+    new (&value.map) std::shared_ptr<Map_type>(std::move(n));
   } else {
     type = shcore::Null;
   }
 }
 
 Value::Value(std::weak_ptr<Map_type> n) : type(MapRef) {
-  value.mapref = new std::weak_ptr<Map_type>(n);
+  new (&value.mapref) std::weak_ptr<Map_type>(std::move(n));
 }
 
 Value::Value(Array_type_ref n) : type(Array) {
   if (n) {
-    value.array = new std::shared_ptr<Array_type>(n);
+    new (&value.array) std::shared_ptr<Array_type>(std::move(n));
   } else {
     type = shcore::Null;
   }
 }
 
+void Value::construct(const Value &other) {
+  switch (other.type) {
+    case Undefined:
+    case shcore::Null:
+      break;
+    case Bool:
+      value.b = other.value.b;
+      break;
+    case Integer:
+      value.i = other.value.i;
+      break;
+    case UInteger:
+      value.ui = other.value.ui;
+      break;
+    case Float:
+      value.d = other.value.d;
+      break;
+    case String:
+      new (&value.s) std::string(other.value.s);
+      break;
+    case Object:
+      new (&value.o) std::shared_ptr<Object_bridge>(other.value.o);
+      break;
+    case Array:
+      new (&value.array) std::shared_ptr<Array_type>(other.value.array);
+      break;
+    case Map:
+      new (&value.map) std::shared_ptr<Map_type>(other.value.map);
+      break;
+    case MapRef:
+      new (&value.mapref) std::weak_ptr<Map_type>(other.value.mapref);
+      break;
+    case Function:
+      new (&value.func) std::shared_ptr<Function_base>(other.value.func);
+      break;
+  }
+
+  // set only once the value is constructed, in case copy of string throws
+  type = other.type;
+}
+
+void Value::construct(Value &&other) noexcept {
+  switch (other.type) {
+    case Undefined:
+    case shcore::Null:
+      break;
+    case Bool:
+      value.b = other.value.b;
+      break;
+    case Integer:
+      value.i = other.value.i;
+      break;
+    case UInteger:
+      value.ui = other.value.ui;
+      break;
+    case Float:
+      value.d = other.value.d;
+      break;
+    case String:
+      new (&value.s) std::string(std::move(other.value.s));
+      break;
+    case Object:
+      new (&value.o) std::shared_ptr<Object_bridge>(std::move(other.value.o));
+      break;
+    case Array:
+      new (&value.array)
+          std::shared_ptr<Array_type>(std::move(other.value.array));
+      break;
+    case Map:
+      new (&value.map) std::shared_ptr<Map_type>(std::move(other.value.map));
+      break;
+    case MapRef:
+      new (&value.mapref)
+          std::weak_ptr<Map_type>(std::move(other.value.mapref));
+      break;
+    case Function:
+      new (&value.func)
+          std::shared_ptr<Function_base>(std::move(other.value.func));
+      break;
+  }
+
+  type = other.type;
+  other.destruct();
+}
+
+void Value::destruct() noexcept {
+  using std::string;
+  using std::shared_ptr;
+  using std::weak_ptr;
+
+  switch (type) {
+    case Undefined:
+    case shcore::Null:
+    case Bool:
+    case Integer:
+    case UInteger:
+    case Float:
+      break;
+    case String:
+      value.s.~string();
+      break;
+    case Object:
+      value.o.~shared_ptr();
+      break;
+    case Array:
+      value.array.~shared_ptr();
+      break;
+    case Map:
+      value.map.~shared_ptr();
+      break;
+    case MapRef:
+      value.mapref.~weak_ptr();
+      break;
+    case Function:
+      value.func.~shared_ptr();
+      break;
+  }
+
+  type = Undefined;
+}
+
 Value &Value::operator=(const Value &other) {
   if (type == other.type) {
     switch (type) {
       case Undefined:
-        break;
       case shcore::Null:
         break;
       case Bool:
@@ -506,94 +656,46 @@ Value &Value::operator=(const Value &other) {
         value.d = other.value.d;
         break;
       case String:
-        *value.s = *other.value.s;
+        value.s = other.value.s;
         break;
       case Object:
-        *value.o = *other.value.o;
+        value.o = other.value.o;
         break;
       case Array:
-        *value.array = *other.value.array;
+        value.array = other.value.array;
         break;
       case Map:
-        *value.map = *other.value.map;
+        value.map = other.value.map;
         break;
       case MapRef:
-        *value.mapref = *other.value.mapref;
+        value.mapref = other.value.mapref;
         break;
       case Function:
-        *value.func = *other.value.func;
+        value.func = other.value.func;
         break;
     }
   } else {
-    switch (type) {
-      case Undefined:
-      case shcore::Null:
-      case Bool:
-      case Integer:
-      case UInteger:
-      case Float:
-        break;
-      case String:
-        delete value.s;
-        break;
-      case Object:
-        delete value.o;
-        break;
-      case Array:
-        delete value.array;
-        break;
-      case Map:
-        delete value.map;
-        break;
-      case MapRef:
-        delete value.mapref;
-        break;
-      case Function:
-        delete value.func;
-        break;
-    }
-    type = other.type;
-    switch (type) {
-      case Undefined:
-      case shcore::Null:
-        break;
-      case Bool:
-        value.b = other.value.b;
-        break;
-      case Integer:
-        value.i = other.value.i;
-        break;
-      case UInteger:
-        value.ui = other.value.ui;
-        break;
-      case Float:
-        value.d = other.value.d;
-        break;
-      case String:
-        value.s = new std::string(*other.value.s);
-        break;
-      case Object:
-        value.o = new std::shared_ptr<Object_bridge>(*other.value.o);
-        break;
-      case Array:
-        value.array = new std::shared_ptr<Array_type>(*other.value.array);
-        break;
-      case Map:
-        value.map = new std::shared_ptr<Map_type>(*other.value.map);
-        break;
-      case MapRef:
-        value.mapref = new std::weak_ptr<Map_type>(*other.value.mapref);
-        break;
-      case Function:
-        value.func = new std::shared_ptr<Function_base>(*other.value.func);
-        break;
-    }
+    // other may be owned by this value (i.e. an element of the array held
+    // here), copy it before anything is released
+    Value copy(other);
+    destruct();
+    construct(std::move(copy));
+  }
+  return *this;
+}
+
+Value &Value::operator=(Value &&other) noexcept {
+  if (this != &other) {
+    // other may be owned by this value, move it out first
+    Value tmp(std::move(other));
+    destruct();
+    construct(std::move(tmp));
   }
   return *this;
 }
 
 Value Value::parse_map(const char **pc) {
-  Map_type_ref map(new Map_type());
+  Map_type::container_type entries;
 
   // Skips the opening {
   ++*pc;
@@ -630,7 +732,7 @@ Value Value::parse_map(const char **pc) {
 
       value = parse(pc);
 
-      (*map)[key.get_string()] = value;
+      entries.emplace_back(key.get_string(), std::move(value));
 
       // Skips the spaces
       while (**pc == ' ' || **pc == '\t' || **pc == '\n') ++*pc;
@@ -651,6 +753,8 @@ Value Value::parse_map(const char **pc) {
     }
   }
 
+  Map_type_ref map(new Map_type());
+  map->assign(std::move(entries));
   return Value(map);
 }
 
@@ -889,7 +993,136 @@ Value Value::parse_number(const char **pcc) {
   return ret_val;
 }
 
-Value Value::parse(const std::string &s) {
+namespace {
+
+/**
+ * Builds a Value out of the SAX events of the JSON reader.
+ *
+ * Values of the containers which are being parsed are kept on a single
+ * stack, a container is created once all of its elements are known, so it's
+ * allocated with the exact size and elements are moved there. Document is
+ * parsed in situ, keys point to the decoded copy of the input until the map
+ * which holds them is created.
+ */
+class Value_builder
+    : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Value_builder> {
+ public:
+  bool Null() { return push(Value::Null()); }
+  bool Bool(bool b) { return push(Value(b)); }
+  bool Int(int i) { return push(Value(i)); }
+  bool Uint(unsigned u) { return push(Value(static_cast<int64_t>(u))); }
+  bool Int64(int64_t i) { return push(Value(i)); }
+  bool Uint64(uint64_t u) {
+    // integers are Integer unless they do not fit
+    if (u > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+      return push(Value(u));
+    return push(Value(static_cast<int64_t>(u)));
+  }
+  bool Double(double d) { return push(Value(d)); }
+
+  bool String(const char *str, rapidjson::SizeType length, bool) {
+    return push(Value(str, length));
+  }
+
+  bool StartObject() { return true; }
+
+  bool Key(const char *str, rapidjson::SizeType length, bool) {
+    m_keys.emplace_back(str, length);
+    return true;
+  }
+
+  bool EndObject(rapidjson::SizeType count) {
+    const auto key = m_keys.end() - count;
+    const auto value = m_values.end() - count;
+    Value::Map_type::container_type entries;
+
+    entries.reserve(count);
+
+    for (rapidjson::SizeType i = 0; i < count; ++i)
+      entries.emplace_back(std::string(key[i].first, key[i].second),
+                           std::move(value[i]));
+
+    auto map = std::make_shared<Value::Map_type>();
+    map->assign(std::move(entries));
+
+    m_keys.erase(key, m_keys.end());
+    m_values.erase(value, m_values.end());
+
+    return push(Value(std::move(map)));
+  }
+
+  bool StartArray() { return true; }
+
+  bool EndArray(rapidjson::SizeType count) {
+    const auto value = m_values.end() - count;
+    auto array = std::make_shared<Value::Array_type>(
+        std::make_move_iterator(value),
+        std::make_move_iterator(m_values.end()));
+
+    m_values.erase(value, m_values.end());
+
+    return push(Value(std::move(array)));
+  }
+
+  Value get() { return std::move(m_values.back()); }
+
+ private:
+  bool push(Value &&value) {
+    m_values.emplace_back(std::move(value));
+    return true;
+  }
+
+  std::vector<Value> m_values;
+  std::vector<std::pair<const char *, size_t>> m_keys;
+};
+
+/**
+ * Parses a JSON document.
+ *
+ * @returns false if document is not valid, error is set to the description of
+ *          the problem.
+ */
+bool parse_json(const std::string &json, Value *out, std::string *error) {
+  // the copy is modified in place, decoded strings are stored there
+  std::string buffer{json};
+  rapidjson::InsituStringStream stream{&buffer[0]};
+  rapidjson::Reader reader;
+  Value_builder builder;
+
+  const auto result =
+      reader.Parse<rapidjson::kParseInsituFlag | rapidjson::kParseIterativeFlag |
+                   rapidjson::kParseFullPrecisionFlag>(stream, builder);
+
+  if (result.IsError()) {
+    *error = str_format("%s at offset %zu",
+                        rapidjson::GetParseError_En(result.Code()),
+                        result.Offset());
+    return false;
+  }
+
+  // reader stops at the first null character
+  if (stream.Tell() != json.length()) {
+    *error = str_format("Unexpected null character at offset %zu",
+                        stream.Tell());
+    return false;
+  }
+
+  *out = builder.get();
+  return true;
+}
+
+}  // namespace
+
+Value Value::parse(const std::string &s, bool lenient) {
+  {
+    Value json;
+    std::string error;
+
+    if (parse_json(s, &json, &error)) return json;
+
+    if (!lenient) throw Exception::parser_error("Error parsing JSON: " + error);
+  }
+
   const char *begin = s.c_str();
   const char *pc = begin;
   Value tmp(parse(&pc));
@@ -960,17 +1193,17 @@ bool Value::operator==(const Value &other) const {
       case Float:
         return value.d == other.value.d;
       case String:
-        return *value.s == *other.value.s;
+        return value.s == other.value.s;
       case Object:
-        return **value.o == **other.value.o;
+        return *value.o == *other.value.o;
       case Array:
-        return **value.array == **other.value.array;
+        return *value.array == *other.value.array;
       case Map:
-        return **value.map == **other.value.map;
+        return *value.map == *other.value.map;
       case MapRef:
-        return *value.mapref->lock() == *other.value.mapref->lock();
+        return *value.mapref.lock() == *other.value.mapref.lock();
       case Function:
-        return **value.func == **other.value.func;
+        return *value.func == *other.value.func;
     }
   } else {
     // with type conversion
@@ -1085,27 +1318,27 @@ std::string &Value::append_descr(std::string &s_out, int indent,
     case Float: {
       char buffer[32];
       size_t len;
-      len = my_gcvt(value.d, MY_GCVT_ARG_DOUBLE, sizeof(buffer) - 1, buffer,
-                    NULL);
+      len = fast_gcvt(value.d, MY_GCVT_ARG_DOUBLE, sizeof(buffer) - 1, buffer,
+                      NULL);
       s_out.append(buffer, len);
       break;
     }
     case String:
       if (quote_strings) {
-        s_out += quote_string(*value.s, quote_strings);
+        s_out += quote_string(value.s, quote_strings);
       } else {
-        s_out += *value.s;
+        s_out += value.s;
       }
       break;
     case Object:
-      if (!value.o || !*value.o)
+      if (!value.o)
         throw Exception::value_error("Invalid object value encountered");
       as_object()->append_descr(s_out, indent, quote_strings);
       break;
     case Array: {
-      if (!value.array || !*value.array)
+      if (!value.array)
         throw Exception::value_error("Invalid array value encountered");
-      Array_type *vec = value.array->get();
+      Array_type *vec = value.array.get();
       Array_type::iterator myend = vec->end(), mybegin = vec->begin();
       s_out += "[";
       for (Array_type::iterator iter = mybegin; iter != myend; ++iter) {
@@ -1123,9 +1356,9 @@ std::string &Value::append_descr(std::string &s_out, int indent,
       s_out += "]";
     } break;
     case Map: {
-      if (!value.map || !*value.map)
+      if (!value.map)
         throw Exception::value_error("Invalid map value encountered");
-      Map_type *map = value.map->get();
+      Map_type *map = value.map.get();
       Map_type::iterator myend = map->end(), mybegin = map->begin();
       s_out += "{";
 
@@ -1184,7 +1417,7 @@ std::string &Value::append_repr(std::string &s_out) const {
       s_out += str_format("%g", value.d);
     } break;
     case String: {
-      std::string &s = *value.s;
+      const std::string &s = value.s;
       s_out += "\"";
       for (size_t i = 0; i < s.length(); i++) {
         unsigned char c = s[i];
@@ -1235,10 +1468,10 @@ std::string &Value::append_repr(std::string &s_out) const {
       s_out += "\"";
     } break;
     case Object:
-      s_out = (*value.o)->append_repr(s_out);
+      s_out = value.o->append_repr(s_out);
       break;
     case Array: {
-      Array_type *vec = value.array->get();
+      Array_type *vec = value.array.get();
       Array_type::iterator myend = vec->end(), mybegin = vec->begin();
       s_out += "[";
       for (Array_type::iterator iter = mybegin; iter != myend; ++iter) {
@@ -1248,7 +1481,7 @@ std::string &Value::append_repr(std::string &s_out) const {
       s_out += "]";
     } break;
     case Map: {
-      Map_type *map = value.map->get();
+      Map_type *map = value.map.get();
       Map_type::iterator myend = map->end(), mybegin = map->begin();
       s_out += "{";
       for (Map_type::iterator iter = mybegin; iter != myend; ++iter) {
@@ -1270,35 +1503,7 @@ std::string &Value::append_repr(std::string &s_out) const {
   return s_out;
 }
 
-Value::~Value() {
-  switch (type) {
-    case Undefined:
-    case shcore::Null:
-    case Bool:
-    case Integer:
-    case UInteger:
-    case Float:
-      break;
-    case String:
-      delete value.s;
-      break;
-    case Object:
-      delete value.o;
-      break;
-    case Array:
-      delete value.array;
-      break;
-    case Map:
-      delete value.map;
-      break;
-    case MapRef:
-      delete value.mapref;
-      break;
-    case Function:
-      delete value.func;
-      break;
-  }
-}
+Value::~Value() { destruct(); }
 
 inline Exception type_conversion_error(Value_type from, Value_type expected) {
   return Exception::type_error("Invalid typecast: " + type_name(expected) +
@@ -1331,7 +1536,7 @@ bool Value::as_bool() const {
       return value.d != 0.0;
     case String:
       try {
-        return lexical_cast<bool>(*value.s);
+        return lexical_cast<bool>(value.s);
       } catch (...) {
       }
       break;
@@ -1360,7 +1565,7 @@ int64_t Value::as_int() const {
       return value.b ? 1 : 0;
     case String:
       try {
-        return lexical_cast<int64_t>(*value.s);
+        return lexical_cast<int64_t>(value.s);
       } catch (...) {
       }
       break;
@@ -1388,7 +1593,7 @@ uint64_t Value::as_uint() const {
       return value.b ? 1 : 0;
     case String:
       try {
-        return lexical_cast<uint64_t>(*value.s);
+        return lexical_cast<uint64_t>(value.s);
       } catch (...) {
       }
       break;
@@ -1418,7 +1623,7 @@ double Value::as_double() const {
       return value.b ? 1.0 : 0.0;
     case String:
       try {
-        return lexical_cast<double>(*value.s);
+        return lexical_cast<double>(value.s);
       } catch (...) {
       }
       break;
@@ -1439,7 +1644,7 @@ std::string Value::as_string() const {
     case Bool:
       return lexical_cast<std::string>(value.b);
     case String:
-      return *value.s;
+      return value.s;
     default:
       break;
   }
@@ -1611,13 +1816,13 @@ std::string Value::yaml(int indent) const {
       return string2yaml(descr(), indent);
 
     case Value_type::String:
-      return string2yaml(*value.s, indent);
+      return string2yaml(value.s, indent);
 
     case Value_type::Array: {
       std::string array;
       bool first_item = true;
 
-      for (const auto &v : **value.array) {
+      for (const auto &v : *value.array) {
         if (first_item) {
           first_item = false;
         } else {
@@ -1636,10 +1841,10 @@ std::string Value::yaml(int indent) const {
     }
 
     case Value_type::Map:
-      return map2yaml(*value.map, indent);
+      return map2yaml(value.map, indent);
 
     case Value_type::MapRef:
-      return map2yaml(value.mapref->lock(), indent);
+      return map2yaml(value.mapref.lock(), indent);
   }
 
   throw std::logic_error("Type '" + type_name(type) + "' was not handled.");
@@ -1652,7 +1857,7 @@ const std::string &Argument_list::string_at(unsigned int i) const {
     throw Exception::argument_error("Insufficient number of arguments");
   switch (at(i).type) {
     case String:
-      return *at(i).value.s;
+      return at(i).value.s;
     default:
       throw Exception::type_error(
           str_format("Argument #%u is expected to be a string", (i + 1)));
@@ -1710,7 +1915,7 @@ std::shared_ptr<Object_bridge> Argument_list::object_at(unsigned int i) const {
   if (at(i).type != Object)
     throw Exception::type_error(
         str_format("Argument #%u is expected to be an object", (i + 1)));
-  return *at(i).value.o;
+  return at(i).value.o;
 }
 
 std::shared_ptr<Value::Map_type> Argument_list::map_at(unsigned int i) const {
@@ -1719,7 +1924,7 @@ std::shared_ptr<Value::Map_type> Argument_list::map_at(unsigned int i) const {
   if (at(i).type != Map)
     throw Exception::type_error(
         str_format("Argument #%u is expected to be a map", (i + 1)));
-  return *at(i).value.map;
+  return at(i).value.map;
 }
 
 std::shared_ptr<Value::Array_type> Argument_list::array_at(
@@ -1729,7 +1934,7 @@ std::shared_ptr<Value::Array_type> Argument_list::array_at(
   if (at(i).type != Array)
     throw Exception::type_error(
         str_format("Argument #%u is expected to be an array", (i + 1)));
-  return *at(i).value.array;
+  return at(i).value.array;
 }
 
 void Argument_list::ensure_count(unsigned int c, const char *context) const {
@@ -1769,7 +1974,7 @@ const std::string &Argument_map::string_at(const std::string &key) const {
   const Value &v(at(key));
   switch (v.type) {
     case String:
-      return *v.value.s;
+      return v.value.s;
     default:
       throw Exception::type_error(std::string("Argument ")
                                       .append(key)
@@ -1819,7 +2024,7 @@ std::shared_ptr<Object_bridge> Argument_map::object_at(
   if (value.type != Object)
     throw Exception::type_error("Argument '" + key +
                                 "' is expected to be an object");
-  return *value.value.o;
+  return value.value.o;
 }
 
 std::shared_ptr<Value::Map_type> Argument_map::map_at(
@@ -1828,7 +2033,7 @@ std::shared_ptr<Value::Map_type> Argument_map::map_at(
   if (value.type != Map)
     throw Exception::type_error("Argument '" + key +
                                 "' is expected to be a map");
-  return *value.value.map;
+  return value.value.map;
 }
 
 std::shared_ptr<Value::Array_type> Argument_map::array_at(
@@ -1837,7 +2042,7 @@ std::shared_ptr<Value::Array_type> Argument_map::array_at(
   if (value.type != Array)
     throw Exception::type_error("Argument '" + key +
                                 "' is expected to be an array");
-  return *value.value.array;
+  return value.value.array;
 }
 
 bool Argument_map::comp(const std::string &lhs, const std::string &rhs) {
@@ -26,7 +26,9 @@
 #include <cctype>
 #include <cstdarg>
 #include <limits>
+#include <mutex>
 #include <tuple>
+#include <unordered_map>
 #include "scripting/common.h"
 #include "shellcore/utils_help.h"
 #include "utils/utils_general.h"
@@ -381,6 +383,12 @@ void Cpp_object_bridge::set_member(size_t, Value) {
   throw Exception::attrib_error("Can't set object member using an index");
 }
 
+bool Cpp_object_bridge::is_iterable() const { return false; }
+
+Value Cpp_object_bridge::next_item() {
+  throw Exception::type_error("Object is not iterable");
+}
+
 bool Cpp_object_bridge::has_method(const std::string &name) const {
   auto method_index = _funcs.find(name);
 
@@ -457,8 +465,7 @@ Value Cpp_object_bridge::call_advanced(const std::string &name,
   auto func = lookup_function_overload(name, style, args);
   if (func) {
     ScopedStyle ss(this, style);
-    auto scope = get_function_name(name, true);
-    return call_function(scope, func, args);
+    return call_function(name, func, args);
   } else {
     throw Exception::attrib_error("Invalid object function " + name);
   }
@@ -468,11 +475,11 @@ Value Cpp_object_bridge::call_advanced(const std::string &name,
  * Utility function to handle function calls using both legacy and new
  * export framework.
  *
- * On new framework, any error will be prepended with the given scope
- * which usually is <class>.<function>
+ * On new framework, any error will be prepended with the qualified name of
+ * the function, i.e. <class>.<function>, it's computed only if call fails.
  */
 Value Cpp_object_bridge::call_function(
-    const std::string &scope, const std::shared_ptr<Cpp_function> &func,
+    const std::string &name, const std::shared_ptr<Cpp_function> &func,
     const Argument_list &args) {
   if (func->is_legacy) {
     return func->invoke(args);
@@ -481,12 +488,15 @@ Value Cpp_object_bridge::call_function(
       return func->invoke(args);
     } catch (shcore::Exception &e) {
       auto error = e.error();
-      (*error)["message"] = shcore::Value(scope + ": " + e.what());
+      (*error)["message"] =
+          shcore::Value(get_function_name(name, true) + ": " + e.what());
       throw;
     } catch (std::runtime_error &e) {
-      throw shcore::Exception::runtime_error(scope + ": " + e.what());
+      throw shcore::Exception::runtime_error(get_function_name(name, true) +
+                                             ": " + e.what());
     } catch (std::logic_error &e) {
-      throw shcore::Exception::logic_error(scope + ": " + e.what());
+      throw shcore::Exception::logic_error(get_function_name(name, true) +
+                                           ": " + e.what());
     } catch (...) {
       throw;
     }
@@ -500,12 +510,7 @@ std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function(
 
 std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function(
     const std::string &method, const NamingStyle &style) const {
-  // NOTE this linear lookup is no good, but needed until the naming style
-  // mechanism is improved
-  std::multimap<std::string, std::shared_ptr<Cpp_function>>::const_iterator i;
-  for (i = _funcs.begin(); i != _funcs.end(); ++i) {
-    if (i->second->name(style) == method) break;
-  }
+  const auto i = find_function(method, style);
   if (i == _funcs.end()) {
     return std::shared_ptr<Cpp_function>(nullptr);
   }
@@ -513,20 +518,43 @@ std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function(
   return i->second;
 }
 
-std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function_overload(
-    const std::string &method, const NamingStyle &style,
-    const shcore::Argument_list &args) const {
-  // NOTE this linear lookup is no good, but needed until the naming style
-  // mechanism is improved
-  std::multimap<std::string, std::shared_ptr<Cpp_function>>::const_iterator i;
+Cpp_object_bridge::Function_map::const_iterator
+Cpp_object_bridge::find_function(const std::string &method,
+                                 const NamingStyle &style) const {
+  // functions are registered using their LowerCamelCase names, which in
+  // almost all cases can be obtained directly from the name in other styles
+  std::string converted;
+  const auto &key = LowerCamelCase == style
+                        ? method
+                        : (converted = shcore::to_camel_case(method));
+  auto i = _funcs.lower_bound(key);
+
+  if (i != _funcs.end() && i->first == key &&
+      i->second->name(style) == method) {
+    return i;
+  }
+
+  // name was registered using a custom name in the given style
   for (i = _funcs.begin(); i != _funcs.end(); ++i) {
     if (i->second->name(style) == method) break;
   }
+
+  return i;
+}
+
+std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function_overload(
+    const std::string &method, const NamingStyle &style,
+    const shcore::Argument_list &args) const {
+  auto i = find_function(method, style);
   if (i == _funcs.end()) {
     throw Exception::attrib_error("Invalid object function " + method);
   }
 
+  // there are no overloads of legacy functions
+  if (i->second->is_legacy) return i->second;
+
   std::vector<Value_type> arg_types;
+  arg_types.reserve(args.size());
   for (const auto &arg : args) {
     arg_types.push_back(arg.type);
   }
@@ -592,8 +620,7 @@ Value Cpp_object_bridge::call(const std::string &name,
                               const Argument_list &args) {
   auto func = lookup_function_overload(name, LowerCamelCase, args);
   assert(func);
-  auto scope = get_function_name(name, true);
-  return call_function(scope, func, args);
+  return call_function(name, func, args);
 }
 
 shcore::Value Cpp_object_bridge::help(const shcore::Argument_list &args) {
@@ -694,42 +721,56 @@ Cpp_function::Cpp_function(const Metadata *meta, const Function &func)
 // TODO(alfredo) legacy, delme
 Cpp_function::Cpp_function(const std::string &name_, const Function &func,
                            bool var_args)
-    : _func(func) {
-  // The | separator is used when specific names are given for a function
-  // Otherwise the function name is retrieved based on the style
-  auto index = name_.find("|");
-  if (index == std::string::npos) {
-    _meta_tmp.name[LowerCamelCase] = get_member_name(name_, LowerCamelCase);
-    _meta_tmp.name[LowerCaseUnderscores] =
-        get_member_name(name_, LowerCaseUnderscores);
-  } else {
-    _meta_tmp.name[LowerCamelCase] = name_.substr(0, index);
-    _meta_tmp.name[LowerCaseUnderscores] = name_.substr(index + 1);
-  }
-  _meta_tmp.var_args = var_args;
-  _meta = &_meta_tmp;
-}
+    : _func(func), _meta(legacy_metadata(name_, nullptr, var_args)) {}
 
 // TODO(alfredo) legacy, delme
 Cpp_function::Cpp_function(
     const std::string &name_, const Function &func,
     const std::vector<std::pair<std::string, Value_type>> &args)
-    : _func(func) {
-  // The | separator is used when specific names are given for a function
-  // Otherwise the function name is retrieved based on the style
-  auto index = name_.find("|");
-  if (index == std::string::npos) {
-    _meta_tmp.name[LowerCamelCase] = get_member_name(name_, LowerCamelCase);
-    _meta_tmp.name[LowerCaseUnderscores] =
-        get_member_name(name_, LowerCaseUnderscores);
-  } else {
-    _meta_tmp.name[LowerCamelCase] = name_.substr(0, index);
-    _meta_tmp.name[LowerCaseUnderscores] = name_.substr(index + 1);
+    : _func(func), _meta(legacy_metadata(name_, &args, false)) {}
+
+const Cpp_function::Metadata *Cpp_function::legacy_metadata(
+    const std::string &name,
+    const std::vector<std::pair<std::string, Value_type>> *args,
+    bool var_args) {
+  // legacy functions are registered each time an object is created, metadata
+  // is shared by all functions with the same name and signature, entries are
+  // never removed as functions keep pointers to them
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::unique_ptr<Metadata>> table;
+
+  std::string key = name;
+  key += var_args ? "(...)" : "(";
+
+  if (args) {
+    for (const auto &arg : *args) {
+      key += arg.first;
+      key += ':';
+      key += std::to_string(static_cast<int>(arg.second));
+      key += ',';
+    }
   }
-  _meta_tmp.param_types = args;
-  _meta_tmp.var_args = false;
-  _meta_tmp.signature = Cpp_function::gen_signature(args);
-  _meta = &_meta_tmp;
+
+  key += ')';
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto &md = table[key];
+
+  if (!md) {
+    md.reset(new Metadata());
+    // The | separator is used when specific names are given for a function
+    // Otherwise the function name is retrieved based on the style
+    md->set_name(name);
+    md->var_args = var_args;
+    md->return_type = Undefined;
+
+    if (args) {
+      md->param_types = *args;
+      md->signature = gen_signature(*args);
+    }
+  }
+
+  return md.get();
 }
 
 const std::string &Cpp_function::name() const {
@@ -26,6 +26,7 @@
 
 #include "modules/devapi/base_resultset.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/shellcore/shell_console.h"
 #include "shellcore/base_session.h"
 #include "shellcore/interrupt_handler.h"
@@ -82,7 +83,10 @@ void Base_shell::finish_init() {
 #endif
   }
   // Final initialization that must happen outside the constructor
-  switch_shell_mode(initial_mode, {}, true);
+  {
+    mysqlshdk::Scoped_stage stage("initial mode");
+    switch_shell_mode(initial_mode, {}, true);
+  }
 
   // Pre-init the SQL completer, since it's used in places other than SQL mode
   _provider_sql.reset(new shcore::completer::Provider_sql());
@@ -623,7 +627,21 @@ void Base_shell::set_global_object(
   }
 }
 
+void Base_shell::set_lazy_global_object(
+    const std::string &name,
+    const std::function<std::shared_ptr<shcore::Cpp_object_bridge>()> &factory,
+    shcore::IShell_core::Mode_mask modes) {
+  _shell->set_lazy_global(
+      name,
+      [factory]() {
+        return shcore::Value(
+            std::dynamic_pointer_cast<shcore::Object_bridge>(factory()));
+      },
+      modes);
+}
+
 void Base_shell::load_plugins() {
+  mysqlshdk::Scoped_stage stage("load plugins");
   const auto initial_mode = _shell->interactive_mode();
   const std::string plugin_directories[] = {
       shcore::path::join_path(shcore::get_user_config_path(), "init.d")};
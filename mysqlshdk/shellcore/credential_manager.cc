@@ -24,6 +24,7 @@
 #include "mysqlshdk/shellcore/credential_manager.h"
 
 #include <algorithm>
+#include <limits>
 
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
@@ -36,6 +37,7 @@ using mysqlshdk::db::Connection_options;
 
 using mysql::secret_store::api::Helper_interface;
 using mysql::secret_store::api::Helper_name;
+using mysql::secret_store::api::Helper_options;
 using mysql::secret_store::api::Secret_spec;
 using mysql::secret_store::api::Secret_type;
 using mysql::secret_store::api::get_available_helpers;
@@ -51,6 +53,8 @@ constexpr auto k_disabled_helper_name = "<disabled>";
 constexpr auto k_credential_helper_option = "credentialStore.helper";
 constexpr auto k_save_passwords_option = "credentialStore.savePasswords";
 constexpr auto k_exclude_filters_option = "credentialStore.excludeFilters";
+constexpr auto k_persistent_option = "credentialStore.persistent";
+constexpr auto k_cache_ttl_option = "credentialStore.cacheTtl";
 
 constexpr auto k_credential_helper_cmdline = "--credential-store-helper=val";
 constexpr auto k_save_passwords_cmdline = "--save-passwords=value";
@@ -98,8 +102,9 @@ std::string get_helper_name(const std::string &helper) {
   return helper == k_default_helper ? get_default_helper_name() : helper;
 }
 
-std::unique_ptr<Helper_interface> get_helper(const std::string &helper) {
-  return get_helper(get_helper_by_name(get_helper_name(helper)));
+std::unique_ptr<Helper_interface> get_helper(const std::string &helper,
+                                             const Helper_options &options) {
+  return get_helper(get_helper_by_name(get_helper_name(helper)), options);
 }
 
 std::string get_url(const Connection_options &options) {
@@ -251,14 +256,26 @@ void Credential_manager::register_options(Options *options) {
         }
 
         return ret_val.json(false);
-      });
+      })(&m_persistent_helper, false, k_persistent_option,
+         "Keeps the credential helper running between the requests, instead "
+         "of starting it for each of them.")(
+      &m_cache_ttl, 0, k_cache_ttl_option,
+      "Number of seconds the passwords fetched from the credential helper "
+      "are kept in memory, 0 disables the cache.",
+      opts::Range<int>(0, std::numeric_limits<int>::max()));
 }
 
 void Credential_manager::handle_notification(const std::string &name,
                                              const Object_bridge_ref &,
                                              Value::Map_type_ref data) {
   if (name == SN_SHELL_OPTION_CHANGED) {
-    if (data->get_string("option") == k_credential_helper_option) {
+    const auto option = data->get_string("option");
+
+    if ((option == k_persistent_option || option == k_cache_ttl_option) &&
+        m_helper) {
+      // recreate the helper using the new options
+      set_helper(m_helper_string);
+    } else if (option == k_credential_helper_option) {
       if (!m_helper ||
           get_helper_name(m_helper_string) != m_helper->name().get()) {
         set_helper(m_helper_string);
@@ -274,7 +291,10 @@ void Credential_manager::set_helper(const std::string &helper) {
   if (k_disabled_helper_name == helper) {
     m_helper.reset(nullptr);
   } else {
-    m_helper = get_helper(helper);
+    Helper_options options;
+    options.persistent = m_persistent_helper;
+    options.cache_ttl = std::chrono::seconds(m_cache_ttl);
+    m_helper = get_helper(helper, options);
   }
 }
 
@@ -97,6 +97,8 @@ class Credential_manager : public NotificationObserver {
   std::string m_helper_string;
   Save_passwords m_save_passwords = Save_passwords::PROMPT;
   std::vector<std::string> m_ignore_filters;
+  bool m_persistent_helper = false;
+  int m_cache_ttl = 0;
   bool m_is_initialized = false;
 };
 
@@ -31,6 +31,7 @@
 #endif
 #include "mysqlshdk/include/shellcore/base_shell.h"
 #include "mysqlshdk/include/shellcore/utils_help.h"
+#include "mysqlshdk/libs/utils/profiling.h"
 #include "scripting/lang_base.h"
 #include "scripting/object_registry.h"
 #include "shellcore/base_session.h"
@@ -196,6 +197,8 @@ void Shell_core::init_js() {
   Shell_javascript *js;
   _langs[Mode::JavaScript] = js = new Shell_javascript(this);
 
+  create_lazy_globals(Mode::JavaScript);
+
   for (std::map<std::string, std::pair<Mode_mask, Value>>::const_iterator iter =
            _globals.begin();
        iter != _globals.end(); ++iter) {
@@ -211,6 +214,8 @@ void Shell_core::init_py() {
   if (_langs.find(Mode::Python) == _langs.end()) {
     _langs[Mode::Python] = py = new Shell_python(this);
 
+    create_lazy_globals(Mode::Python);
+
     for (std::map<std::string, std::pair<Mode_mask, Value>>::const_iterator
              iter = _globals.begin();
          iter != _globals.end(); ++iter) {
@@ -223,6 +228,7 @@ void Shell_core::init_py() {
 
 void Shell_core::set_global(const std::string &name, const Value &value,
                             Mode_mask mode) {
+  m_lazy_globals.erase(name);
   _globals[name] = std::make_pair(mode, value);
 
   for (std::map<Mode, Shell_language *>::const_iterator iter = _langs.begin();
@@ -235,12 +241,53 @@ void Shell_core::set_global(const std::string &name, const Value &value,
 }
 
 Value Shell_core::get_global(const std::string &name) {
+  create_lazy_global(name);
   return (_globals.count(name) > 0) ? _globals[name].second : Value();
 }
 
+void Shell_core::set_lazy_global(const std::string &name,
+                                 const std::function<Value()> &factory,
+                                 Mode_mask mode) {
+  _globals.erase(name);
+  m_lazy_globals[name] = std::make_pair(mode, factory);
+
+  // create it right away if it's needed by an already existing context
+  for (const auto &lang : _langs) {
+    if (mode.is_set(lang.first) && lang.first != Mode::SQL) {
+      create_lazy_global(name);
+      break;
+    }
+  }
+}
+
+void Shell_core::create_lazy_global(const std::string &name) {
+  const auto global = m_lazy_globals.find(name);
+
+  if (global != m_lazy_globals.end()) {
+    const auto mode = global->second.first;
+    const auto factory = std::move(global->second.second);
+    m_lazy_globals.erase(global);
+
+    mysqlshdk::Scoped_stage stage(name.c_str());
+    set_global(name, factory(), mode);
+  }
+}
+
+void Shell_core::create_lazy_globals(Mode mode) {
+  std::vector<std::string> names;
+
+  for (const auto &global : m_lazy_globals) {
+    if (global.second.first.is_set(mode)) names.emplace_back(global.first);
+  }
+
+  for (const auto &name : names) create_lazy_global(name);
+}
+
 std::vector<std::string> Shell_core::get_global_objects(Mode mode) {
   std::vector<std::string> globals;
 
+  create_lazy_globals(mode);
+
   for (auto entry : _globals) {
     if (entry.second.first.is_set(mode) &&
         entry.second.second.type == shcore::Object)
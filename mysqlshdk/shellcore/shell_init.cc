@@ -24,6 +24,12 @@
 #include "shellcore/shell_init.h"
 #include <mysql.h>
 
+#include <algorithm>
+
+#include "mysqlshdk/libs/db/mysql/session_pool.h"
+#include "mysqlshdk/libs/db/replay/setup.h"
+#include "shellcore/interrupt_handler.h"
+
 #ifdef HAVE_V8
 namespace shcore {
 extern void JScript_context_init();
@@ -37,6 +43,49 @@ void thread_init() { mysql_thread_init(); }
 
 void thread_end() { mysql_thread_end(); }
 
+std::size_t worker_thread_count(std::size_t max_threads, std::size_t tasks) {
+  if (mysqlshdk::db::replay::g_replay_mode !=
+      mysqlshdk::db::replay::Mode::Direct) {
+    return 1;
+  }
+
+  return std::max<std::size_t>(std::min(max_threads, tasks), 1);
+}
+
+Worker_threads::~Worker_threads() { join_all(); }
+
+void Worker_threads::start(const std::function<void()> &function) {
+  m_threads.emplace_back([this, function]() {
+    Mysql_thread mysql_thread;
+    // ^C is handled by the thread which started the workers
+    shcore::Block_interrupts block_interrupts;
+
+    try {
+      function();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_error) m_error = std::current_exception();
+    }
+  });
+}
+
+void Worker_threads::join() {
+  join_all();
+
+  std::exception_ptr error;
+  std::swap(error, m_error);
+
+  if (error) std::rethrow_exception(error);
+}
+
+void Worker_threads::join_all() {
+  for (auto &thread : m_threads) {
+    if (thread.joinable()) thread.join();
+  }
+
+  m_threads.clear();
+}
+
 void global_init() {
 #ifdef HAVE_V8
   shcore::JScript_context_init();
@@ -48,6 +97,10 @@ void global_init() {
 }
 
 void global_end() {
+  // pooled sessions need to be closed while the client library is still
+  // initialized
+  mysqlshdk::db::mysql::Session_pool::get()->clear();
+
   thread_end();
   mysql_library_end();
 
@@ -403,7 +403,11 @@ Shell_options::Shell_options(int argc, char **argv,
         "by default.")
     (&storage.default_compress, false, SHCORE_DEFAULT_COMPRESS,
         "Enable compression in client/server protocol by default "
-        "in global shell sessions.");
+        "in global shell sessions.")
+    (&storage.result_prefetch_rows, 0, SHCORE_RESULT_PREFETCH_ROWS,
+        "Number of rows of a query result which are read ahead in a "
+        "background thread, 0 disables it.",
+        shcore::opts::Range<int>(0, std::numeric_limits<int>::max()));
 
   add_startup_options()
     (cmdline("--name-cache"),
@@ -455,6 +459,8 @@ Shell_options::Shell_options(int argc, char **argv,
         "in the server connected to. Must be used with --mysql.")
     (cmdline("--trace-proto"),
         assign_value(&storage.trace_protocol, true))
+    (cmdline("--debug-startup"),
+        assign_value(&storage.debug_startup, true))
     (cmdline("--ssl[=opt]"), deprecated("--ssl-mode",
       std::bind(&Shell_options::set_ssl_mode, this, _1, _2), "REQUIRED",
      {
@@ -32,7 +32,7 @@
 #include "mysqlshdk/include/shellcore/base_shell.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/db/column.h"
-#include "mysqlshdk/libs/utils/dtoa.h"
+#include "mysqlshdk/libs/utils/fast_dtoa.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_json.h"
 #include "shellcore/interrupt_handler.h"
@@ -328,7 +328,8 @@ class Field_formatter {
       auto value = row->get_float(index);
       char buffer[32];
       size_t len;
-      len = my_gcvt(value, MY_GCVT_ARG_FLOAT, sizeof(buffer) - 1, buffer, NULL);
+      len = shcore::fast_gcvt(value, MY_GCVT_ARG_FLOAT, sizeof(buffer) - 1,
+                              buffer, NULL);
       tmp.assign(buffer, len);
     } else if (m_type == mysqlshdk::db::Type::Integer) {
       return std::to_string(row->get_int(index));
@@ -338,8 +339,8 @@ class Field_formatter {
       auto value = row->get_double(index);
       char buffer[32];
       size_t len;
-      len =
-          my_gcvt(value, MY_GCVT_ARG_DOUBLE, sizeof(buffer) - 1, buffer, NULL);
+      len = shcore::fast_gcvt(value, MY_GCVT_ARG_DOUBLE, sizeof(buffer) - 1,
+                              buffer, NULL);
       tmp.assign(buffer, len);
     } else {
       return row->get_as_string(index);
@@ -623,7 +624,7 @@ void dump_json_row(shcore::JSON_dumper *dumper,
   dumper->start_object();
 
   for (size_t col_index = 0; col_index < metadata.size(); col_index++) {
-    auto column = metadata[col_index];
+    const auto &column = metadata[col_index];
 
     dumper->append_string(column.get_column_label());
     auto type = column.get_type();
@@ -709,11 +710,9 @@ size_t Resultset_dumper_base::dump_tabbed() {
   // Now prints the records
   while (row && !m_cancelled) {
     for (size_t field_index = 0; field_index < field_count; field_index++) {
-      auto column = metadata[field_index];
       if (fmt[field_index].put(row, field_index)) {
         m_printer->print(fmt[field_index].c_str());
       } else {
-        mysqlshdk::db::is_string_type(column.get_type());
         m_printer->print(row->get_string(field_index));
       }
       m_printer->print(field_index < (field_count - 1) ? "\t" : "\n");
@@ -751,7 +750,7 @@ size_t Resultset_dumper_base::dump_vertical() {
     m_printer->print(row_header);
 
     for (size_t col_index = 0; col_index < metadata.size(); col_index++) {
-      auto column = metadata[col_index];
+      const auto &column = metadata[col_index];
 
       std::string padding(max_col_len - column.get_column_label().size(), ' ');
       std::string label = padding + column.get_column_label() + ": ";
@@ -295,7 +295,16 @@ void Help_registry::add_split_help(const std::string &prefix,
 
 void Help_registry::add_help(const std::string &token,
                              const std::string &data) {
-  m_help_data[token] = data;
+  m_pending_help_data.emplace_back(token, data);
+}
+
+void Help_registry::index_help_data() {
+  // later registrations of the same token take precedence
+  for (auto &entry : m_pending_help_data)
+    m_help_data[entry.first] = std::move(entry.second);
+
+  m_pending_help_data.clear();
+  m_pending_help_data.shrink_to_fit();
 }
 
 void Help_registry::add_help(const std::string &prefix, const std::string &tag,
@@ -650,8 +659,10 @@ void Help_registry::register_keyword(const std::string &keyword,
 std::string Help_registry::get_token(const std::string &token) {
   std::string ret_val;
 
-  if (m_help_data.find(token) != m_help_data.end())
-    ret_val = m_help_data[token];
+  if (!m_pending_help_data.empty()) index_help_data();
+
+  const auto it = m_help_data.find(token);
+  if (it != m_help_data.end()) ret_val = it->second;
 
   return ret_val;
 }
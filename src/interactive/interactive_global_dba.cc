@@ -81,23 +81,23 @@ mysqlsh::dba::Cluster_check_info Global_dba::check_preconditions(
   return dba->check_preconditions(group_session, function_name);
 }
 
-std::vector<std::pair<std::string, std::string>>
-Global_dba::get_replicaset_instances_status(
+std::vector<mysqlsh::dba::Dba::Reboot_instance_state>
+Global_dba::get_reboot_instances_state(
     std::shared_ptr<mysqlsh::dba::Cluster> cluster,
     const shcore::Value::Map_type_ref &options) const {
   ScopedStyle ss(_target.get(), naming_style);
   auto dba = std::dynamic_pointer_cast<mysqlsh::dba::Dba>(_target);
-  return dba->get_replicaset_instances_status(cluster, options);
+  return dba->get_reboot_instances_state(cluster, options);
 }
 
 void Global_dba::validate_instances_status_reboot_cluster(
-    std::shared_ptr<mysqlsh::dba::Cluster> cluster,
     std::shared_ptr<mysqlshdk::db::ISession> member_session,
-    shcore::Value::Map_type_ref options) const {
+    const std::vector<mysqlsh::dba::Dba::Reboot_instance_state> &instances)
+    const {
   ScopedStyle ss(_target.get(), naming_style);
   auto dba = std::dynamic_pointer_cast<mysqlsh::dba::Dba>(_target);
-  return dba->validate_instances_status_reboot_cluster(cluster, member_session,
-                                                       options);
+  return dba->validate_instances_status_reboot_cluster(member_session,
+                                                       instances);
 }
 
 shcore::Argument_list Global_dba::check_instance_op_params(
@@ -529,13 +529,19 @@ shcore::Value Global_dba::reboot_cluster_from_complete_outage(
       cluster = dba->get_cluster(cluster_name.c_str(), metadata, group_session);
     }
 
+    // Probe all the instances at once, their state is used to verify them
+    // and to get their connectivity status
+    const auto instances_state = get_reboot_instances_state(cluster, options);
+
     // Verify the status of the instances
-    validate_instances_status_reboot_cluster(
-        cluster, cluster->get_group_session(), options);
+    validate_instances_status_reboot_cluster(cluster->get_group_session(),
+                                             instances_state);
 
     // Get the all the instances and their status
-    std::vector<std::pair<std::string, std::string>> instances_status =
-        get_replicaset_instances_status(cluster, options);
+    std::vector<std::pair<std::string, std::string>> instances_status;
+    for (const auto &state : instances_state) {
+      instances_status.emplace_back(state.address, state.connect_error);
+    }
 
     mysqlshdk::db::Connection_options group_cnx_opts =
         group_session->get_connection_options();
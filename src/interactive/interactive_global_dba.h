@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "modules/adminapi/common/common.h"
+#include "modules/adminapi/mod_dba.h"
 #include "modules/adminapi/mod_dba_cluster.h"
 #include "modules/interactive_object_wrapper.h"
 
@@ -63,14 +64,13 @@ class Global_dba : public Interactive_object_wrapper {
   mysqlsh::dba::Cluster_check_info check_preconditions(
       std::shared_ptr<mysqlshdk::db::ISession> group_session,
       const std::string &function_name) const;
-  std::vector<std::pair<std::string, std::string>>
-  get_replicaset_instances_status(
-      std::shared_ptr<mysqlsh::dba::Cluster> cluster,
-      const shcore::Value::Map_type_ref &options) const;
+  std::vector<mysqlsh::dba::Dba::Reboot_instance_state>
+  get_reboot_instances_state(std::shared_ptr<mysqlsh::dba::Cluster> cluster,
+                             const shcore::Value::Map_type_ref &options) const;
   void validate_instances_status_reboot_cluster(
-      std::shared_ptr<mysqlsh::dba::Cluster> cluster,
       std::shared_ptr<mysqlshdk::db::ISession> member_session,
-      shcore::Value::Map_type_ref options) const;
+      const std::vector<mysqlsh::dba::Dba::Reboot_instance_state> &instances)
+      const;
   shcore::Argument_list check_instance_op_params(
       const shcore::Argument_list &args, const std::string &function_name);
   shcore::Value perform_instance_operation(const shcore::Argument_list &args,
@@ -406,7 +406,7 @@ bool Command_line_shell::cmd_history(const std::vector<std::string> &args) {
     }
   } else if (args[1] == "save") {
     std::string path = history_file();
-    if (linenoiseHistorySave(path.c_str()) < 0) {
+    if (!_history.save(path)) {
       print_diag(shcore::str_format("Could not save command history to %s: %s",
                                     path.c_str(), strerror(errno)));
     } else {
@@ -781,7 +781,10 @@ void Command_line_shell::command_loop() {
         mysqlsh::current_console()->raw_print(
             cmd + "\n", mysqlsh::Output_stream::STDOUT, false);
     }
-    process_line(cmd);
+    if (cmd.find('\n') == std::string::npos)
+      process_line(cmd);
+    else
+      process_pasted_input(cmd);
     reconnect_if_needed();
     detect_session_change();
   }
@@ -789,6 +792,29 @@ void Command_line_shell::command_loop() {
   std::cout << "Bye!\n";
 }
 
+void Command_line_shell::process_pasted_input(const std::string &input) {
+  const auto lines = shcore::str_split(input, "\n");
+
+  // SQL splitter processes the whole paste at once, shell commands are
+  // recognized only at the beginning of the input, so it can be used only if
+  // the paste doesn't contain any
+  bool bulk = interactive_mode() == shcore::Shell_core::Mode::SQL;
+
+  for (const auto &line : lines) {
+    if (!bulk) break;
+    const auto first = line.find_first_not_of(" \t");
+    if (first != std::string::npos && line[first] == '\\') bulk = false;
+  }
+
+  if (bulk) {
+    process_line(input);
+  } else {
+    for (const auto &line : lines) {
+      process_line(line);
+    }
+  }
+}
+
 void Command_line_shell::print_banner() {
   std::string welcome_msg("MySQL Shell ");
   welcome_msg += MYSH_FULL_VERSION;
@@ -76,6 +76,11 @@ class Command_line_shell : public Mysql_shell,
   void handle_interrupt();
   bool _interrupted = false;
 
+  /**
+   * Processes multiple lines received at once from a bracketed paste.
+   */
+  void process_pasted_input(const std::string &input);
+
  protected:
   void pause_history(bool flag) { _history.pause(flag); }
 
@@ -131,6 +136,7 @@ class Command_line_shell : public Mysql_shell,
   FRIEND_TEST(Cmdline_shell, query_variable_x);
   FRIEND_TEST(Cmdline_shell, help);
   FRIEND_TEST(Cmdline_shell, prompt);
+  FRIEND_TEST(Cmdline_shell, process_pasted_input);
   FRIEND_TEST(Shell_history, check_password_history_linenoise);
   FRIEND_TEST(Shell_history, history_linenoise);
   FRIEND_TEST(Shell_history, history_management);
@@ -40,10 +40,11 @@ class Command_show : public IShell_command {
 
   bool execute(const std::vector<std::string> &args) override;
 
+ protected:
+  std::shared_ptr<Shell_reports> m_reports;
+
  private:
   void list_reports() const;
-
-  std::shared_ptr<Shell_reports> m_reports;
 };
 
 }  // namespace mysqlsh
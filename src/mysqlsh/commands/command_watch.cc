@@ -23,14 +23,272 @@
 
 #include "src/mysqlsh/commands/command_watch.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/textui/term_vt100.h"
 #include "mysqlshdk/libs/textui/textui.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// how often the interruption flag is checked while waiting for a report
+constexpr std::chrono::milliseconds k_poll_interval{100};
+
+std::chrono::milliseconds refresh_interval(float seconds) {
+  return std::chrono::milliseconds{static_cast<int64_t>(1000.0f * seconds)};
+}
+
+struct Report_output {
+  std::string text;
+  Clock::duration duration;
+};
+
+/**
+ * Executes a report at a fixed rate in a background thread. The most recent
+ * output is handed over to the thread which displays it, so a slow report
+ * does not delay the screen updates and vice versa.
+ */
+class Background_report final {
+ public:
+  Background_report(const std::function<std::string()> &report,
+                    std::chrono::milliseconds interval)
+      : m_report(report),
+        m_interval(interval),
+        m_thread(&Background_report::run, this) {}
+
+  Background_report(const Background_report &other) = delete;
+  Background_report(Background_report &&other) = delete;
+
+  Background_report &operator=(const Background_report &other) = delete;
+  Background_report &operator=(Background_report &&other) = delete;
+
+  ~Background_report() {
+    stop();
+
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  /**
+   * Waits for the next output of the report.
+   *
+   * @param timeout how long to wait
+   * @param output receives the output
+   *
+   * @returns true if new output was available
+   *
+   * @throws exception thrown by the report
+   */
+  bool wait_for_output(std::chrono::milliseconds timeout,
+                       Report_output *output) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_output_ready.wait_for(lock, timeout,
+                            [this]() { return m_has_output || m_error; });
+
+    if (m_error) {
+      std::exception_ptr error;
+      std::swap(error, m_error);
+      std::rethrow_exception(error);
+    }
+
+    if (!m_has_output) return false;
+
+    *output = std::move(m_output);
+    m_has_output = false;
+
+    return true;
+  }
+
+  /**
+   * Asks the background thread to finish, does not wait for it.
+   *
+   * @returns true if report is being executed at the moment
+   */
+  bool stop() {
+    bool running = false;
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+      running = m_running;
+    }
+
+    m_wake_up.notify_one();
+
+    return running;
+  }
+
+ private:
+  void run() {
+    mysqlsh::Mysql_thread mysql_thread;
+    // ^C is handled by the main thread
+    shcore::Interrupts::ignore_thread();
+
+    auto next = Clock::now();
+
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stop) break;
+        m_running = true;
+      }
+
+      Report_output output;
+      std::exception_ptr error;
+      const auto start = Clock::now();
+
+      try {
+        output.text = m_report();
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      output.duration = Clock::now() - start;
+
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_running = false;
+
+        if (error) {
+          m_error = error;
+        } else {
+          m_output = std::move(output);
+          m_has_output = true;
+        }
+
+        m_output_ready.notify_one();
+
+        if (error) break;
+
+        // refreshes are scheduled at a fixed rate, skip the ones which were
+        // missed
+        next = std::max(next + m_interval, Clock::now());
+        m_wake_up.wait_until(lock, next, [this]() { return m_stop; });
+      }
+    }
+  }
+
+  const std::function<std::string()> m_report;
+  const std::chrono::milliseconds m_interval;
+
+  std::mutex m_mutex;
+  std::condition_variable m_output_ready;
+  std::condition_variable m_wake_up;
+  bool m_stop = false;
+  bool m_running = false;
+  bool m_has_output = false;
+  Report_output m_output;
+  std::exception_ptr m_error;
+
+  // needs to be the last member, uses all the other ones
+  std::thread m_thread;
+};
+
+/**
+ * Displays subsequent outputs of a report. If screen is cleared between the
+ * refreshes, only the lines which have changed since the previous output are
+ * written.
+ */
+class Screen_writer final {
+ public:
+  explicit Screen_writer(bool clear_screen) : m_clear_screen(clear_screen) {}
+
+  void write(const std::string &output) {
+    if (!m_clear_screen) {
+      current_console()->print(output);
+      return;
+    }
+
+    auto lines = shcore::str_split(output, "\n");
+
+    if (!lines.empty() && lines.back().empty()) {
+      lines.pop_back();
+    }
+
+    const bool fits = fits_screen(lines);
+
+    // rows cannot be addressed if the previous output has scrolled the screen
+    if (m_fits && fits) {
+      update(lines);
+    } else {
+      redraw(lines);
+    }
+
+    m_fits = fits;
+    m_lines = std::move(lines);
+  }
+
+ private:
+  static bool fits_screen(const std::vector<std::string> &lines) {
+    int rows = 0;
+    int columns = 0;
+
+    if (!mysqlshdk::vt100::get_screen_size(&rows, &columns)) {
+      return false;
+    }
+
+    // the last row holds the cursor
+    if (lines.size() >= static_cast<std::size_t>(rows)) {
+      return false;
+    }
+
+    // length in bytes is used, lines with multi-byte characters may be
+    // needlessly treated as wrapped, which means a full redraw
+    for (const auto &line : lines) {
+      if (line.length() >= static_cast<std::size_t>(columns)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  void redraw(const std::vector<std::string> &lines) const {
+    mysqlshdk::textui::clear_screen();
+    current_console()->println(shcore::str_join(lines, "\n"));
+  }
+
+  void update(const std::vector<std::string> &lines) const {
+    const auto console = current_console();
+
+    for (std::size_t i = 0; i < lines.size(); ++i) {
+      if (i >= m_lines.size() || lines[i] != m_lines[i]) {
+        mysqlshdk::vt100::cursor_home(static_cast<int>(i) + 1, 1);
+        console->print(lines[i]);
+        mysqlshdk::vt100::erase_end_of_line();
+      }
+    }
+
+    // move the cursor below the output, erase lines left by previous output
+    mysqlshdk::vt100::cursor_home(static_cast<int>(lines.size()) + 1, 1);
+
+    if (lines.size() < m_lines.size()) {
+      mysqlshdk::vt100::erase_down();
+    }
+  }
+
+  const bool m_clear_screen;
+  bool m_fits = false;
+  std::vector<std::string> m_lines;
+};
+
+}  // namespace
+
 bool Command_watch::execute(const std::vector<std::string> &args) {
   if (args.size() == 1 ||
       std::find(args.begin(), args.end(), "--help") != args.end()) {
@@ -44,9 +302,6 @@ bool Command_watch::execute(const std::vector<std::string> &args) {
     shcore::Interrupt_handler inth(
         [&iterrupted]() { return (iterrupted = true); });
 
-    // convert seconds to milliseconds
-    const auto interval = static_cast<uint32_t>(1000.0f * m_refresh_interval);
-
     if (m_clear_screen && !mysqlshdk::textui::supports_screen_control()) {
       current_console()->print_warning(
           "Terminal does not support ANSI escape sequences, screen will not "
@@ -58,26 +313,85 @@ bool Command_watch::execute(const std::vector<std::string> &args) {
       mysqlshdk::textui::scroll_screen();
     }
 
-    while (!iterrupted) {
-      if (m_clear_screen) {
-        mysqlshdk::textui::clear_screen();
+    if (m_reports->is_native_report(new_args[1])) {
+      watch_in_background(new_args, iterrupted);
+    } else {
+      watch(new_args, iterrupted);
+    }
+
+    return true;
+  }
+}
+
+void Command_watch::watch_in_background(const std::vector<std::string> &args,
+                                        const bool &interrupted) {
+  const auto session = _shell->get_dev_session();
+  const std::string name = args[1];
+  const std::vector<std::string> report_args{args.begin() + 2, args.end()};
+
+  Background_report report(
+      [this, &session, &name, &report_args]() {
+        return m_reports->call_report(name, session, report_args);
+      },
+      refresh_interval(m_refresh_interval));
+  Screen_writer writer{m_clear_screen};
+  Report_output output;
+
+  while (!interrupted) {
+    if (report.wait_for_output(k_poll_interval, &output)) {
+      if (m_show_timing) {
+        output.text += footer(output.duration);
       }
 
-      Command_show::execute(new_args);
+      writer.write(output.text);
+    }
+  }
+
+  // don't wait for the report which is currently executed
+  if (report.stop() && session) {
+    session->kill_query();
+  }
+}
 
-      shcore::sleep_ms(interval);
+void Command_watch::watch(const std::vector<std::string> &args,
+                          const bool &interrupted) {
+  const auto interval = refresh_interval(m_refresh_interval);
+  Screen_writer writer{m_clear_screen};
+  auto next = Clock::now();
+
+  while (!interrupted) {
+    const auto start = Clock::now();
+    auto output = m_reports->call_report(
+        args[1], _shell->get_dev_session(), {args.begin() + 2, args.end()});
+
+    if (m_show_timing) {
+      output += footer(Clock::now() - start);
     }
 
-    return true;
+    writer.write(output);
+
+    // refreshes are scheduled at a fixed rate, skip the ones which were missed
+    next = std::max(next + interval, Clock::now());
+    shcore::sleep_ms(static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(next -
+                                                              Clock::now())
+            .count()));
   }
 }
 
+std::string Command_watch::footer(Clock::duration duration) const {
+  return shcore::str_format(
+      "\nReport executed in %.3fs, refreshing every %gs.\n",
+      std::chrono::duration<double>(duration).count(), m_refresh_interval);
+}
+
 std::vector<std::string> Command_watch::parse_arguments(
     const std::vector<std::string> &args) {
   // options handled by \watch
   static constexpr auto k_no_refresh = "--nocls";
   static constexpr auto k_interval_long = "--interval";
   static constexpr auto k_interval_short = "-i";
+  static constexpr auto k_timing = "--timing";
 
   // arguments passed to \show, options handled by \watch should be removed
   std::vector<std::string> new_args;
@@ -94,6 +408,8 @@ std::vector<std::string> Command_watch::parse_arguments(
   while (current != end) {
     if (*current == k_no_refresh) {
       m_clear_screen = false;
+    } else if (*current == k_timing) {
+      m_show_timing = true;
     } else if (shcore::str_beginswith(*current, k_interval_long) ||
                shcore::str_beginswith(*current, k_interval_short)) {
       const char *value = nullptr;
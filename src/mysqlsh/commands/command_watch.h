@@ -23,6 +23,7 @@
 #ifndef SRC_MYSQLSH_COMMANDS_COMMAND_WATCH_H_
 #define SRC_MYSQLSH_COMMANDS_COMMAND_WATCH_H_
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -43,10 +44,26 @@ class Command_watch : public Command_show {
   std::vector<std::string> parse_arguments(
       const std::vector<std::string> &args);
 
+  /**
+   * Executes a native report in a background thread, at a fixed rate, while
+   * the current thread displays its output.
+   */
+  void watch_in_background(const std::vector<std::string> &args,
+                           const bool &interrupted);
+
+  /**
+   * Executes a report in the current thread, at a fixed rate.
+   */
+  void watch(const std::vector<std::string> &args, const bool &interrupted);
+
+  std::string footer(std::chrono::steady_clock::duration duration) const;
+
   // default values of options handled by \watch
   bool m_clear_screen = true;
 
   float m_refresh_interval = 2.0f;
+
+  bool m_show_timing = false;
 };
 
 }  // namespace mysqlsh
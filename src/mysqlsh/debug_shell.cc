@@ -62,6 +62,11 @@ void handle_debug_options(int *argc, char ***argv) {
   if (const char *debug = getenv("TEST_DEBUG")) {
     print_traces = atoi(debug);
   }
+  if (const char *format = getenv("MYSQLSH_RECORDER_FORMAT")) {
+    if (strcasecmp(format, "binary") == 0)
+      mysqlshdk::db::replay::set_trace_format(
+          mysqlshdk::db::replay::Trace_format::Binary);
+  }
   if (const char *mode = getenv("MYSQLSH_RECORDER_MODE")) {
     if (strcasecmp(mode, "direct") == 0 || !*mode) {
       mysqlshdk::db::replay::set_mode(Mode::Direct, 0);
@@ -147,6 +152,31 @@ void handle_debug_options(int *argc, char ***argv) {
                   << e.what() << std::endl;
       }
       exit(0);
+    } else if (strncmp((*argv)[i], "--convert-trace=",
+                       strlen("--convert-trace=")) == 0) {
+      // mysqlshrec --convert-trace=json|binary <source> <target>
+      const char *format = strchr((*argv)[i], '=') + 1;
+      if (i + 2 >= c ||
+          (strcasecmp(format, "json") != 0 &&
+           strcasecmp(format, "binary") != 0)) {
+        std::cerr << "Usage: --convert-trace=json|binary <source> <target>"
+                  << std::endl;
+        exit(1);
+      }
+      try {
+        size_t count = mysqlshdk::db::replay::convert_trace(
+            (*argv)[i + 1], (*argv)[i + 2],
+            strcasecmp(format, "binary") == 0
+                ? mysqlshdk::db::replay::Trace_format::Binary
+                : mysqlshdk::db::replay::Trace_format::Json);
+        std::cout << "Converted " << count << " trace entries to "
+                  << (*argv)[i + 2] << std::endl;
+      } catch (const std::exception &e) {
+        std::cerr << "Failed to convert session trace: " << e.what()
+                  << std::endl;
+        exit(1);
+      }
+      exit(0);
     } else {
       (*argv)[j++] = (*argv)[i];
     }
@@ -25,6 +25,7 @@
 #include <errno.h>
 #include <algorithm>
 #include <cassert>
+#include <fstream>
 #include <iostream>
 #include <limits>
 
@@ -32,6 +33,27 @@
 
 namespace mysqlsh {
 
+namespace {
+
+/**
+ * Counts the entries stored in the history file, which can be more than the
+ * number of entries loaded by linenoise.
+ */
+uint64_t count_file_entries(const std::string &path) {
+  std::ifstream file(path);
+  std::string line;
+  uint64_t entries = 0;
+
+  // empty lines are skipped by linenoiseHistoryLoad()
+  while (std::getline(file, line)) {
+    if (!line.empty() && line[0] != '\r') ++entries;
+  }
+
+  return entries;
+}
+
+}  // namespace
+
 History::History() { linenoiseHistoryFree(); }
 
 bool History::load(const std::string &path) {
@@ -39,13 +61,24 @@ bool History::load(const std::string &path) {
   linenoiseHistorySetMaxLen(_limit);
   if (linenoiseHistoryLoad(path.c_str()) < 0) {
     linenoiseHistorySetMaxLen(_limit + 1);
-    return errno == ENOENT;  // file not found is OK
+    if (errno != ENOENT) return false;
+
+    // file not found is OK
+    _file = path;
+    _file_entries = 0;
+    _rewrite_file = false;
+    return true;
   } else {
     _serial = 0;
     for (int c = linenoiseHistorySize(), i = 0; i < c; i++) {
       _serials.push_back(++_serial);
     }
     linenoiseHistorySetMaxLen(_limit + 1);
+
+    _file = path;
+    _saved_serial = _serial;
+    _file_entries = count_file_entries(path);
+    _rewrite_file = false;
     return true;
   }
 }
@@ -53,13 +86,36 @@ bool History::load(const std::string &path) {
 bool History::save(const std::string &file) {
   clear_temporary();
 
-  return linenoiseHistorySave(file.c_str()) >= 0;
+  // serials are increasing, entries after this one are not in the file yet
+  const auto first_new =
+      std::upper_bound(_serials.begin(), _serials.end(), _saved_serial);
+  const uint64_t new_entries = _serials.end() - first_new;
+
+  if (_rewrite_file || file != _file ||
+      _file_entries + new_entries > 2 * static_cast<uint64_t>(_limit)) {
+    if (linenoiseHistorySave(file.c_str()) < 0) return false;
+
+    _file_entries = _serials.size();
+  } else {
+    // creates the file if it does not exist yet
+    const auto index = static_cast<int>(first_new - _serials.begin());
+    if (linenoiseHistoryAppend(file.c_str(), index) < 0) return false;
+
+    _file_entries += new_entries;
+  }
+
+  _file = file;
+  _saved_serial = last_entry();
+  _rewrite_file = false;
+  return true;
 }
 
 void History::clear() {
   _last_entry_was_temporary = false;
   _serial = 0;
   _serials.clear();
+  _saved_serial = 0;
+  _rewrite_file = true;
   linenoiseHistoryFree();
 }
 
@@ -159,6 +215,8 @@ void History::del(uint32_t serial_first, uint32_t serial_last) {
   assert(serial_last >= first_entry() && serial_last <= last_entry());
   assert(serial_first <= serial_last);
 
+  if (serial_first <= _saved_serial) _rewrite_file = true;
+
   auto iter = _serials.end();
   for (uint32_t ser = serial_last; ser >= serial_first; ser--) {
     iter = std::find(_serials.begin(), _serials.end(), ser);
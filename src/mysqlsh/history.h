@@ -32,6 +32,13 @@ namespace mysqlsh {
 class History {
  public:
   History();
+
+  /**
+   * Saves the history to the given file. If the history was loaded from or
+   * saved to the same file before, only new entries are appended to it, the
+   * whole file is rewritten when entries were deleted or the file holds twice
+   * as many entries as the history limit.
+   */
   bool save(const std::string &file);
   bool load(const std::string &file);
 
@@ -56,6 +63,15 @@ class History {
   int _paused = 0;
   bool _last_entry_was_temporary = false;
 
+  // file the history was loaded from or saved to
+  std::string _file;
+  // serial of the last entry stored in the file
+  uint32_t _saved_serial = 0;
+  // number of entries in the file, including the ones dropped from history
+  uint64_t _file_entries = 0;
+  // set when entries stored in the file are deleted
+  bool _rewrite_file = true;
+
   void clear_temporary();
 };
 
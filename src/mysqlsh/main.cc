@@ -28,6 +28,7 @@
 #include "mysqlshdk/libs/innodbcluster/cluster.h"
 #include "mysqlshdk/libs/textui/textui.h"
 #include "mysqlshdk/libs/utils/document_parser.h"
+#include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
@@ -40,8 +41,10 @@
 #endif
 
 #include <sys/stat.h>
+#include <chrono>
 #include <clocale>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 
@@ -618,7 +621,47 @@ static void finalize_shell(mysqlsh::Command_line_shell *shell) {
   mysqlsh::global_end();
 }
 
+static void print_startup_profile(
+    const mysqlshdk::utils::Profile_timer &timer) {
+  using milliseconds = std::chrono::duration<double, std::milli>;
+  const auto &points = timer.trace_points();
+
+  if (points.empty()) return;
+
+  std::string report = "Startup profile:\n";
+  report += shcore::str_format("%10s %10s  %s\n", "start (ms)", "time (ms)",
+                               "stage");
+
+  for (const auto &point : points) {
+    report += shcore::str_format(
+        "%10.3f %10.3f  %*s%s\n",
+        milliseconds(point.start - points.front().start).count(),
+        milliseconds(point.end - point.start).count(), point.depth * 2, "",
+        point.note);
+  }
+
+  report += shcore::str_format("%10s %10.3f  total\n", "",
+                               timer.total_milliseconds_ellapsed());
+  std::cerr << report;
+}
+
 int main(int argc, char **argv) {
+  // --debug-startup is handled before anything else, so that all of the
+  // startup stages are measured
+  for (int i = 1; i < argc && strcmp(argv[i], "--") != 0; ++i) {
+    if (strcmp(argv[i], "--debug-startup") == 0) {
+      mysqlshdk::utils::Profile_timer::activate();
+      break;
+    }
+  }
+
+  const auto print_profile = shcore::on_leave_scope([]() {
+    if (mysqlshdk::utils::g_active_timer) {
+      print_startup_profile(*mysqlshdk::utils::g_active_timer);
+      mysqlshdk::utils::Profile_timer::deactivate();
+    }
+  });
+
   std::string mysqlsh_path = shcore::get_binary_path();
   g_mysqlsh_path = mysqlsh_path.c_str();
 
@@ -655,9 +698,11 @@ int main(int argc, char **argv) {
   Interrupt_helper sighelper;
   shcore::Interrupts::init(&sighelper);
 
+  mysqlshdk::stage_begin("process options");
   std::shared_ptr<mysqlsh::Shell_options> shell_options =
       process_args(&argc, &argv);
   const mysqlsh::Shell_options::Storage &options = shell_options->get();
+  mysqlshdk::stage_end();
 
   if (options.exit_code != 0) return options.exit_code;
 
@@ -673,9 +718,16 @@ int main(int argc, char **argv) {
 
     bool valid_color_capability = detect_color_capability();
 
-    shell.reset(new mysqlsh::Command_line_shell(shell_options), finalize_shell);
+    {
+      mysqlshdk::Scoped_stage stage("create shell");
+      shell.reset(new mysqlsh::Command_line_shell(shell_options),
+                  finalize_shell);
+    }
 
-    init_shell(shell);
+    {
+      mysqlshdk::Scoped_stage stage("init shell");
+      init_shell(shell);
+    }
 
     log_debug("Using color mode %i",
               static_cast<int>(mysqlshdk::textui::get_color_capability()));
@@ -723,6 +775,7 @@ int main(int argc, char **argv) {
       // Open the default shell session
       if (options.has_connection_data()) {
         try {
+          mysqlshdk::Scoped_stage stage("connect");
           auto restore_print_on_error =
               shcore::Scoped_callback([shell]() { shell->restore_print(); });
 
@@ -814,6 +867,8 @@ int main(int argc, char **argv) {
       g_shell_ptr = shell.get();
       if (valid_color_capability) shell->load_prompt_theme(pick_prompt_theme());
 
+      mysqlshdk::Scoped_stage execute_stage("execute");
+
       if (shell_cli_operation && !shell_cli_operation->empty()) {
         try {
           shell->print_result(shell_cli_operation->execute());
@@ -47,6 +47,7 @@
 #include "mysqlshdk/libs/db/utils_error.h"
 #include "mysqlshdk/libs/innodbcluster/cluster.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
+#include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/shellcore/credential_manager.h"
 #include "scripting/shexcept.h"
@@ -442,8 +443,15 @@ REGISTER_HELP(CMD_WATCH_DETAIL2,
 REGISTER_HELP(CMD_WATCH_DETAIL3,
               "@li --nocls - Don't clear the screen between refreshes.");
 REGISTER_HELP(CMD_WATCH_DETAIL4,
+              "@li --timing - Display the execution time of the report below "
+              "its output.");
+REGISTER_HELP(CMD_WATCH_DETAIL5,
+              "Refreshes are scheduled at a fixed rate. Built-in reports are "
+              "executed in the background, and only the lines which have "
+              "changed since the previous refresh are redrawn.");
+REGISTER_HELP(CMD_WATCH_DETAIL6,
               "If executed without the report name, lists available reports.");
-REGISTER_HELP(CMD_WATCH_DETAIL5, "For more information see \\show command.");
+REGISTER_HELP(CMD_WATCH_DETAIL7, "For more information see \\show command.");
 REGISTER_HELP(CMD_WATCH_EXAMPLE, "<b>\\watch</b>");
 REGISTER_HELP(CMD_WATCH_EXAMPLE_DESC,
               "Lists available reports, both built-in and user-defined.");
@@ -465,50 +473,59 @@ Mysql_shell::Mysql_shell(std::shared_ptr<Shell_options> cmdline_options,
     : mysqlsh::Base_shell(cmdline_options, custom_delegate) {
   DEBUG_OBJ_ALLOC(Mysql_shell);
 
+  mysqlshdk::Scoped_stage stage("Mysql_shell");
+
   // Registers the interactive objects if required
   _global_shell = std::shared_ptr<mysqlsh::Shell>(new mysqlsh::Shell(this));
-  _global_js_sys =
-      std::shared_ptr<mysqlsh::Sys>(new mysqlsh::Sys(_shell.get()));
-  _global_dba =
-      std::shared_ptr<mysqlsh::dba::Dba>(new mysqlsh::dba::Dba(_shell.get()));
-  _global_util =
-      std::shared_ptr<mysqlsh::Util>(new mysqlsh::Util(_shell.get()));
 
   if (options().wizards) {
     auto interactive_shell = std::shared_ptr<shcore::Global_shell>(
         new shcore::Global_shell(*_shell.get()));
-    auto interactive_dba = std::shared_ptr<shcore::Global_dba>(
-        new shcore::Global_dba(*_shell.get()));
-
     interactive_shell->set_target(_global_shell);
-    interactive_dba->set_target(_global_dba);
 
     set_global_object(
         "shell",
         std::dynamic_pointer_cast<shcore::Cpp_object_bridge>(interactive_shell),
         shcore::IShell_core::all_scripting_modes());
-    set_global_object(
-        "dba",
-        std::dynamic_pointer_cast<shcore::Cpp_object_bridge>(interactive_dba),
-        shcore::IShell_core::all_scripting_modes());
   } else {
     set_global_object(
         "shell",
         std::dynamic_pointer_cast<shcore::Cpp_object_bridge>(_global_shell),
         shcore::IShell_core::all_scripting_modes());
-    set_global_object(
-        "dba",
-        std::dynamic_pointer_cast<shcore::Cpp_object_bridge>(_global_dba),
-        shcore::IShell_core::all_scripting_modes());
   }
 
-  set_global_object(
+  // The remaining global objects are not needed until a scripting language is
+  // used, i.e. SQL batch sessions never create them
+  set_lazy_global_object(
+      "dba",
+      [this]() -> std::shared_ptr<shcore::Cpp_object_bridge> {
+        _global_dba = std::make_shared<mysqlsh::dba::Dba>(_shell.get());
+
+        if (options().wizards) {
+          auto interactive_dba =
+              std::make_shared<shcore::Global_dba>(*_shell.get());
+          interactive_dba->set_target(_global_dba);
+          return interactive_dba;
+        }
+
+        return _global_dba;
+      },
+      shcore::IShell_core::all_scripting_modes());
+
+  set_lazy_global_object(
       "sys",
-      std::dynamic_pointer_cast<shcore::Cpp_object_bridge>(_global_js_sys),
+      [this]() {
+        _global_js_sys = std::make_shared<mysqlsh::Sys>(_shell.get());
+        return _global_js_sys;
+      },
       shcore::IShell_core::Mode_mask(shcore::IShell_core::Mode::JavaScript));
-  set_global_object(
+
+  set_lazy_global_object(
       "util",
-      std::dynamic_pointer_cast<shcore::Cpp_object_bridge>(_global_util),
+      [this]() {
+        _global_util = std::make_shared<mysqlsh::Util>(_shell.get());
+        return _global_util;
+      },
       shcore::IShell_core::all_scripting_modes());
 
   auto shell_cli_operation = cmdline_options->get_shell_cli_operation();
@@ -523,8 +540,10 @@ Mysql_shell::Mysql_shell(std::shared_ptr<Shell_options> cmdline_options,
     });
     shell_cli_operation->register_provider(
         "cluster", [this]() { return this->set_default_cluster(""); });
-    shell_cli_operation->register_provider("util",
-                                           [this]() { return _global_util; });
+    shell_cli_operation->register_provider("util", [this]() {
+      return std::dynamic_pointer_cast<shcore::Cpp_object_bridge>(
+          _shell->get_global("util").as_object());
+    });
     shell_cli_operation->register_provider("shell.options", [this]() {
       return _global_shell->get_shell_options();
     });
@@ -626,7 +645,10 @@ Mysql_shell::Mysql_shell(std::shared_ptr<Shell_options> cmdline_options,
   SET_SHELL_COMMAND("\\show", "CMD_SHOW", Mysql_shell::cmd_show);
   SET_SHELL_COMMAND("\\watch", "CMD_WATCH", Mysql_shell::cmd_watch);
 
-  shcore::Credential_manager::get().initialize();
+  {
+    mysqlshdk::Scoped_stage credentials_stage("credential manager");
+    shcore::Credential_manager::get().initialize();
+  }
 }
 
 Mysql_shell::~Mysql_shell() { DEBUG_OBJ_DEALLOC(Mysql_shell); }
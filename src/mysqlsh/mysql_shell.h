@@ -111,6 +111,7 @@ class Mysql_shell : public mysqlsh::Base_shell {
   FRIEND_TEST(Cmdline_shell, check_history_source);
   FRIEND_TEST(Cmdline_shell, history_autosave_int);
   FRIEND_TEST(Cmdline_shell, check_help_shows_history);
+  FRIEND_TEST(Cmdline_shell, lazy_globals);
   FRIEND_TEST(Interactive_dba_create_cluster, read_only_no_prompts);
 #endif
 };
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef UNITTEST_BENCHMARKS_BENCHMARK_H_
+#define UNITTEST_BENCHMARKS_BENCHMARK_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+
+namespace benchmarks {
+
+/**
+ * State of a single benchmark run.
+ *
+ * Benchmark functions loop over keep_running(), timing is measured from the
+ * first call until it returns false:
+ *
+ *   BENCHMARK(foo) {
+ *     std::string input = make_input();
+ *     while (state->keep_running()) {
+ *       do_foo(input);
+ *     }
+ *     state->set_bytes_processed(state->iterations() * input.size());
+ *   }
+ */
+class State {
+  using clock = std::chrono::steady_clock;
+
+ public:
+  explicit State(uint64_t max_iterations) : m_max_iterations(max_iterations) {}
+
+  inline bool keep_running() {
+    if (m_iterations == 0 && !m_started) {
+      m_started = true;
+      m_start = clock::now();
+    }
+    if (m_iterations < m_max_iterations) {
+      ++m_iterations;
+      return true;
+    }
+    m_elapsed += clock::now() - m_start;
+    return false;
+  }
+
+  /**
+   * Excludes the code executed until resume_timing() from the measurement.
+   */
+  void pause_timing() { m_elapsed += clock::now() - m_start; }
+  void resume_timing() { m_start = clock::now(); }
+
+  uint64_t iterations() const { return m_iterations; }
+
+  void set_bytes_processed(uint64_t bytes) { m_bytes = bytes; }
+  void set_items_processed(uint64_t items) { m_items = items; }
+
+  void skip(const std::string &reason) {
+    m_skip_reason = reason;
+    m_iterations = m_max_iterations;
+  }
+
+  uint64_t elapsed_ns() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(m_elapsed)
+        .count();
+  }
+  uint64_t bytes_processed() const { return m_bytes; }
+  uint64_t items_processed() const { return m_items; }
+  const std::string &skip_reason() const { return m_skip_reason; }
+
+ private:
+  uint64_t m_max_iterations;
+  uint64_t m_iterations = 0;
+  bool m_started = false;
+  clock::time_point m_start;
+  clock::duration m_elapsed = clock::duration::zero();
+  uint64_t m_bytes = 0;
+  uint64_t m_items = 0;
+  std::string m_skip_reason;
+};
+
+using Benchmark_function = std::function<void(State *)>;
+
+bool register_benchmark(const char *name, Benchmark_function function);
+
+/**
+ * Prevents the compiler from optimizing away a computed value.
+ */
+template <typename T>
+inline void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+/**
+ * Random generator with a fixed seed, so that all runs (and all builds) work
+ * on exactly the same input data.
+ */
+inline std::mt19937_64 &random_generator() {
+  static std::mt19937_64 generator(0x6d7973716c7368);
+  return generator;
+}
+
+std::string random_string(size_t length, const char *alphabet =
+                                             "abcdefghijklmnopqrstuvwxyz"
+                                             "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                             "0123456789 ");
+
+/**
+ * Path of a scratch file for benchmarks that need input on disk.
+ */
+std::string temporary_path(const std::string &name);
+
+}  // namespace benchmarks
+
+#define BENCHMARK(name)                                                 \
+  static void benchmark_##name(::benchmarks::State *state);             \
+  static const bool benchmark_##name##_registered =                     \
+      ::benchmarks::register_benchmark(#name, benchmark_##name);        \
+  static void benchmark_##name(::benchmarks::State *state)
+
+#endif  // UNITTEST_BENCHMARKS_BENCHMARK_H_
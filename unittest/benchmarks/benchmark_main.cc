@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/utils_json.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "unittest/benchmarks/benchmark.h"
+
+namespace benchmarks {
+
+namespace {
+
+std::map<std::string, Benchmark_function> &registry() {
+  static std::map<std::string, Benchmark_function> benchmarks;
+  return benchmarks;
+}
+
+struct Options {
+  std::string filter = ".*";
+  std::string format = "console";
+  std::string output;
+  double min_time = 0.5;
+  int repetitions = 3;
+  bool list = false;
+};
+
+struct Run {
+  std::string name;
+  uint64_t iterations = 0;
+  double ns_per_iteration = 0;
+  double bytes_per_second = 0;
+  double items_per_second = 0;
+  std::string skip_reason;
+};
+
+State run_once(const Benchmark_function &function, uint64_t iterations) {
+  State state(iterations);
+  function(&state);
+  return state;
+}
+
+/**
+ * Runs the benchmark with an increasing number of iterations, until a single
+ * run takes at least min_time seconds, then repeats it with that number of
+ * iterations and reports the median.
+ */
+Run run_benchmark(const std::string &name, const Benchmark_function &function,
+                  const Options &options) {
+  const uint64_t min_ns = static_cast<uint64_t>(options.min_time * 1e9);
+  uint64_t iterations = 1;
+  Run run;
+  run.name = name;
+
+  for (;;) {
+    State state = run_once(function, iterations);
+    if (!state.skip_reason().empty()) {
+      run.skip_reason = state.skip_reason();
+      return run;
+    }
+    if (state.elapsed_ns() >= min_ns || iterations >= (1ULL << 40)) break;
+
+    // aim a bit over the minimum time, never grow more than 10x at once
+    double factor = state.elapsed_ns() == 0
+                        ? 10.0
+                        : 1.4 * min_ns / state.elapsed_ns();
+    factor = std::max(2.0, std::min(factor, 10.0));
+    iterations = static_cast<uint64_t>(iterations * factor);
+  }
+
+  std::vector<Run> runs;
+  for (int i = 0; i < std::max(1, options.repetitions); ++i) {
+    State state = run_once(function, iterations);
+    Run r;
+    const double seconds = state.elapsed_ns() / 1e9;
+    r.iterations = state.iterations();
+    r.ns_per_iteration =
+        static_cast<double>(state.elapsed_ns()) / state.iterations();
+    if (seconds > 0) {
+      r.bytes_per_second = state.bytes_processed() / seconds;
+      r.items_per_second = state.items_processed() / seconds;
+    }
+    runs.push_back(r);
+  }
+
+  std::sort(runs.begin(), runs.end(), [](const Run &a, const Run &b) {
+    return a.ns_per_iteration < b.ns_per_iteration;
+  });
+  const Run &median = runs[runs.size() / 2];
+  run.iterations = median.iterations;
+  run.ns_per_iteration = median.ns_per_iteration;
+  run.bytes_per_second = median.bytes_per_second;
+  run.items_per_second = median.items_per_second;
+  return run;
+}
+
+std::string format_rate(double value, const char *unit) {
+  static const char *prefixes[] = {"", "k", "M", "G", "T"};
+  size_t i = 0;
+  while (value >= 1000.0 && i < 4) {
+    value /= 1000.0;
+    ++i;
+  }
+  return shcore::str_format("%.2f %s%s/s", value, prefixes[i], unit);
+}
+
+void print_console(const std::vector<Run> &runs) {
+  size_t width = 20;
+  for (const auto &run : runs) width = std::max(width, run.name.size());
+
+  std::cout << shcore::str_format("%-*s %15s %12s  %s\n",
+                                  static_cast<int>(width), "Benchmark",
+                                  "Time (ns)", "Iterations", "Rate");
+  std::cout << std::string(width + 60, '-') << "\n";
+  for (const auto &run : runs) {
+    if (!run.skip_reason.empty()) {
+      std::cout << shcore::str_format("%-*s SKIPPED: %s\n",
+                                      static_cast<int>(width),
+                                      run.name.c_str(),
+                                      run.skip_reason.c_str());
+      continue;
+    }
+    std::string rate;
+    if (run.bytes_per_second > 0)
+      rate = format_rate(run.bytes_per_second, "B");
+    if (run.items_per_second > 0) {
+      if (!rate.empty()) rate.append(", ");
+      rate.append(format_rate(run.items_per_second, "items"));
+    }
+    std::cout << shcore::str_format(
+        "%-*s %15.1f %12llu  %s\n", static_cast<int>(width), run.name.c_str(),
+        run.ns_per_iteration,
+        static_cast<unsigned long long>(run.iterations),  // NOLINT
+        rate.c_str());
+  }
+}
+
+std::string to_json(const std::vector<Run> &runs, const Options &options) {
+  shcore::JSON_dumper dumper(true);
+  dumper.start_object();
+  dumper.append_string("context");
+  dumper.start_object();
+  dumper.append_string("executable", "run_benchmarks");
+  dumper.append_float("min_time", options.min_time);
+  dumper.append_int64("repetitions", options.repetitions);
+  dumper.end_object();
+
+  dumper.append_string("benchmarks");
+  dumper.start_array();
+  for (const auto &run : runs) {
+    dumper.start_object();
+    dumper.append_string("name", run.name);
+    if (!run.skip_reason.empty()) {
+      dumper.append_string("skipped", run.skip_reason);
+    } else {
+      dumper.append_uint64("iterations", run.iterations);
+      dumper.append_float("ns_per_iteration", run.ns_per_iteration);
+      dumper.append_float("bytes_per_second", run.bytes_per_second);
+      dumper.append_float("items_per_second", run.items_per_second);
+    }
+    dumper.end_object();
+  }
+  dumper.end_array();
+  dumper.end_object();
+  return dumper.str();
+}
+
+void usage() {
+  std::cout
+      << "Usage: run_benchmarks [options]\n"
+         "  --filter=<regex>     run only benchmarks whose name matches\n"
+         "  --list               list available benchmarks\n"
+         "  --min-time=<sec>     minimum duration of a single run (0.5)\n"
+         "  --repetitions=<n>    number of measured runs, median is "
+         "reported (3)\n"
+         "  --format=console|json\n"
+         "  --output=<file>      write JSON results to the given file\n";
+}
+
+bool parse_options(int argc, char **argv, Options *options) {
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    const char *value = strchr(arg, '=');
+    value = value ? value + 1 : "";
+
+    if (shcore::str_beginswith(arg, "--filter=")) {
+      options->filter = value;
+    } else if (strcmp(arg, "--list") == 0) {
+      options->list = true;
+    } else if (shcore::str_beginswith(arg, "--min-time=")) {
+      options->min_time = std::atof(value);
+    } else if (shcore::str_beginswith(arg, "--repetitions=")) {
+      options->repetitions = std::atoi(value);
+    } else if (shcore::str_beginswith(arg, "--format=")) {
+      options->format = value;
+      if (options->format != "console" && options->format != "json") {
+        std::cerr << "Invalid format: " << value << "\n";
+        return false;
+      }
+    } else if (shcore::str_beginswith(arg, "--output=")) {
+      options->output = value;
+    } else {
+      if (strcmp(arg, "--help") != 0)
+        std::cerr << "Invalid option " << arg << "\n";
+      usage();
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool register_benchmark(const char *name, Benchmark_function function) {
+  registry()[name] = std::move(function);
+  return true;
+}
+
+std::string random_string(size_t length, const char *alphabet) {
+  const size_t alphabet_size = strlen(alphabet);
+  std::uniform_int_distribution<size_t> distribution(0, alphabet_size - 1);
+  std::string result;
+  result.reserve(length);
+  for (size_t i = 0; i < length; ++i)
+    result.push_back(alphabet[distribution(random_generator())]);
+  return result;
+}
+
+std::string temporary_path(const std::string &name) {
+  const char *tmpdir = getenv("TMPDIR");
+#ifdef _WIN32
+  if (!tmpdir) tmpdir = getenv("TEMP");
+  if (!tmpdir) tmpdir = ".";
+#else
+  if (!tmpdir) tmpdir = "/tmp";
+#endif
+  return shcore::path::join_path(tmpdir, name);
+}
+
+}  // namespace benchmarks
+
+int main(int argc, char **argv) {
+  using benchmarks::Options;
+  using benchmarks::Run;
+
+  Options options;
+  if (!benchmarks::parse_options(argc, argv, &options)) return 1;
+
+  std::regex filter;
+  try {
+    filter = std::regex(options.filter);
+  } catch (const std::regex_error &e) {
+    std::cerr << "Invalid filter: " << e.what() << "\n";
+    return 1;
+  }
+
+  std::vector<Run> runs;
+  for (const auto &b : benchmarks::registry()) {
+    if (!std::regex_search(b.first, filter)) continue;
+
+    if (options.list) {
+      std::cout << b.first << "\n";
+      continue;
+    }
+
+    // input generators are re-seeded, so each benchmark gets the same data
+    // no matter which other benchmarks were selected
+    benchmarks::random_generator().seed(0x6d7973716c7368);
+    try {
+      runs.push_back(benchmarks::run_benchmark(b.first, b.second, options));
+    } catch (const std::exception &e) {
+      std::cerr << b.first << ": " << e.what() << "\n";
+      return 1;
+    }
+    if (options.format == "console") std::cerr << "." << std::flush;
+  }
+  if (options.list) return 0;
+  if (options.format == "console") std::cerr << "\n";
+
+  const std::string json = benchmarks::to_json(runs, options);
+
+  if (options.format == "json")
+    std::cout << json << "\n";
+  else
+    benchmarks::print_console(runs);
+
+  if (!options.output.empty()) {
+    std::ofstream out(options.output);
+    if (!out.good()) {
+      std::cerr << options.output << ": " << strerror(errno) << "\n";
+      return 1;
+    }
+    out << json << "\n";
+  }
+  return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/include/scripting/jscript_context.h"
+#include "mysqlshdk/include/scripting/object_registry.h"
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/shellcore/shell_console.h"
+#include "unittest/benchmarks/benchmark.h"
+
+namespace shcore {
+extern void JScript_context_init();
+}  // namespace shcore
+
+namespace benchmarks {
+
+namespace {
+
+void discard(void *, const char *) {}
+
+class JS_environment {
+ public:
+  JS_environment()
+      : m_deleg(nullptr, &discard, nullptr, nullptr, &discard, &discard),
+        m_options{std::make_shared<mysqlsh::Shell_options>(0, nullptr)},
+        m_console{std::make_shared<mysqlsh::Shell_console>(&m_deleg)} {
+    shcore::JScript_context_init();
+    m_context.reset(new shcore::JScript_context(&m_registry));
+  }
+
+  shcore::JScript_context *context() { return m_context.get(); }
+
+ private:
+  shcore::Interpreter_delegate m_deleg;
+  mysqlsh::Scoped_shell_options m_options;
+  mysqlsh::Scoped_console m_console;
+  shcore::Object_registry m_registry;
+  std::unique_ptr<shcore::JScript_context> m_context;
+};
+
+JS_environment *environment() {
+  static JS_environment env;
+  return &env;
+}
+
+shcore::Value make_row_like_map() {
+  auto map = shcore::Value::new_map();
+  auto m = map.as_map();
+  for (int i = 0; i < 20; ++i) {
+    (*m)["column" + std::to_string(i)] =
+        i % 2 ? shcore::Value(random_string(20)) : shcore::Value(i * 1000);
+  }
+  return map;
+}
+
+template <typename F>
+void with_js_scope(shcore::JScript_context *js, F &&f) {
+  v8::Isolate::Scope isolate_scope(js->isolate());
+  v8::HandleScope handle_scope(js->isolate());
+  v8::TryCatch try_catch{js->isolate()};
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(js->isolate(), js->context()));
+  f();
+}
+
+}  // namespace
+
+BENCHMARK(js_bridge_to_v8) {
+  auto js = environment()->context();
+  const shcore::Value value = make_row_like_map();
+
+  with_js_scope(js, [&]() {
+    while (state->keep_running()) {
+      // handles are released with each inner scope, otherwise the outer one
+      // would keep growing with the number of iterations
+      v8::HandleScope inner_scope(js->isolate());
+      auto obj = js->shcore_value_to_v8_value(value);
+      do_not_optimize(obj);
+    }
+  });
+  state->set_items_processed(state->iterations());
+}
+
+BENCHMARK(js_bridge_round_trip) {
+  auto js = environment()->context();
+  const shcore::Value value = make_row_like_map();
+
+  with_js_scope(js, [&]() {
+    while (state->keep_running()) {
+      v8::HandleScope inner_scope(js->isolate());
+      shcore::Value back =
+          js->v8_value_to_shcore_value(js->shcore_value_to_v8_value(value));
+      do_not_optimize(back);
+    }
+  });
+  state->set_items_processed(state->iterations());
+}
+
+BENCHMARK(js_bridge_strings) {
+  auto js = environment()->context();
+  const shcore::Value value(random_string(1024));
+
+  with_js_scope(js, [&]() {
+    while (state->keep_running()) {
+      v8::HandleScope inner_scope(js->isolate());
+      shcore::Value back =
+          js->v8_value_to_shcore_value(js->shcore_value_to_v8_value(value));
+      do_not_optimize(back);
+    }
+  });
+  state->set_bytes_processed(state->iterations() * 1024);
+}
+
+}  // namespace benchmarks
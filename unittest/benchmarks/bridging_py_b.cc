@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/* python_context.h includes Python.h so it needs to be the first include to
+ * avoid error: "_POSIX_C_SOURCE" redefined */
+#include "mysqlshdk/include/scripting/python_context.h"
+
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/shellcore/shell_console.h"
+#include "unittest/benchmarks/benchmark.h"
+
+namespace benchmarks {
+
+namespace {
+
+void discard(void *, const char *) {}
+
+class Python_environment {
+ public:
+  Python_environment()
+      : m_deleg(nullptr, &discard, nullptr, nullptr, &discard, &discard),
+        m_options{std::make_shared<mysqlsh::Shell_options>(0, nullptr)},
+        m_console{std::make_shared<mysqlsh::Shell_console>(&m_deleg)},
+        m_context(false) {}
+
+  shcore::Python_context *context() { return &m_context; }
+
+ private:
+  shcore::Interpreter_delegate m_deleg;
+  mysqlsh::Scoped_shell_options m_options;
+  mysqlsh::Scoped_console m_console;
+  shcore::Python_context m_context;
+};
+
+Python_environment *environment() {
+  static Python_environment env;
+  return &env;
+}
+
+shcore::Value make_row_like_map() {
+  auto map = shcore::Value::new_map();
+  auto m = map.as_map();
+  for (int i = 0; i < 20; ++i) {
+    (*m)["column" + std::to_string(i)] =
+        i % 2 ? shcore::Value(random_string(20)) : shcore::Value(i * 1000);
+  }
+  return map;
+}
+
+}  // namespace
+
+BENCHMARK(py_bridge_to_python) {
+  auto py = environment()->context();
+  const shcore::Value value = make_row_like_map();
+
+  while (state->keep_running()) {
+    PyObject *obj = py->shcore_value_to_pyobj(value);
+    Py_XDECREF(obj);
+  }
+  state->set_items_processed(state->iterations());
+}
+
+BENCHMARK(py_bridge_round_trip) {
+  auto py = environment()->context();
+  const shcore::Value value = make_row_like_map();
+
+  while (state->keep_running()) {
+    PyObject *obj = py->shcore_value_to_pyobj(value);
+    shcore::Value back = py->pyobj_to_shcore_value(obj);
+    Py_XDECREF(obj);
+    do_not_optimize(back);
+  }
+  state->set_items_processed(state->iterations());
+}
+
+BENCHMARK(py_bridge_strings) {
+  auto py = environment()->context();
+  const shcore::Value value(random_string(1024));
+
+  while (state->keep_running()) {
+    PyObject *obj = py->shcore_value_to_pyobj(value);
+    shcore::Value back = py->pyobj_to_shcore_value(obj);
+    Py_XDECREF(obj);
+    do_not_optimize(back);
+  }
+  state->set_bytes_processed(state->iterations() * 1024);
+}
+
+}  // namespace benchmarks
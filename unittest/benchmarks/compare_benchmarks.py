@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+# Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License, version 2.0,
+# as published by the Free Software Foundation.
+#
+# This program is also distributed with certain software (including
+# but not limited to OpenSSL) that is licensed under separate terms, as
+# designated in a particular file or component or in included license
+# documentation.  The authors of MySQL hereby grant you an additional
+# permission to link the program and your derivative works with the
+# separately licensed software that they have included with MySQL.
+# This program is distributed in the hope that it will be useful,  but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+# the GNU General Public License, version 2.0, for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+"""Compares two result files written by run_benchmarks --output=<file>.
+
+Usage: compare_benchmarks.py <baseline.json> <contender.json> [--threshold=N]
+
+Prints the relative change of the time per iteration of every benchmark
+present in both files. Exits with 1 if any benchmark is slower than the
+baseline by more than N percent (default: 10), so it can be used as a CI gate.
+Results of other harnesses which use the same layout (a "benchmarks" list of
+objects with "name" and "ns_per_iteration") can be compared as well.
+"""
+
+from __future__ import print_function
+
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    results = {}
+    for b in data.get("benchmarks", []):
+        if "skipped" in b:
+            continue
+        results[b["name"]] = float(b["ns_per_iteration"])
+    return results
+
+
+def main(argv):
+    threshold = 10.0
+    files = []
+    for arg in argv[1:]:
+        if arg.startswith("--threshold="):
+            threshold = float(arg.split("=", 1)[1])
+        elif arg.startswith("--"):
+            print(__doc__)
+            return 2
+        else:
+            files.append(arg)
+
+    if len(files) != 2:
+        print(__doc__)
+        return 2
+
+    baseline = load(files[0])
+    contender = load(files[1])
+
+    width = max([len(n) for n in baseline] + [len("Benchmark")])
+    print("%-*s %15s %15s %9s" % (width, "Benchmark", "Baseline (ns)",
+                                   "Contender (ns)", "Change"))
+    print("-" * (width + 42))
+
+    regressions = []
+    for name in sorted(baseline):
+        if name not in contender:
+            print("%-*s %15.1f %15s" % (width, name, baseline[name], "-"))
+            continue
+        old = baseline[name]
+        new = contender[name]
+        change = (new - old) * 100.0 / old if old else 0.0
+        mark = ""
+        if change > threshold:
+            regressions.append(name)
+            mark = "  <-- REGRESSION"
+        print("%-*s %15.1f %15.1f %+8.1f%%%s" % (width, name, old, new, change,
+                                                 mark))
+
+    for name in sorted(set(contender) - set(baseline)):
+        print("%-*s %15s %15.1f" % (width, name, "-", contender[name]))
+
+    if regressions:
+        print("\n%d benchmark(s) regressed more than %.1f%%: %s" %
+              (len(regressions), threshold, ", ".join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/mysqlx/expr_parser.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "unittest/benchmarks/benchmark.h"
+
+namespace benchmarks {
+
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Row_copy;
+using mysqlshdk::db::Type;
+
+BENCHMARK(row_copy) {
+  const std::vector<Type> types{Type::Integer, Type::UInteger, Type::Double,
+                                Type::String,  Type::String,   Type::Decimal,
+                                Type::DateTime, Type::Null};
+  Mutable_row row(types);
+  row.set_row_values(int64_t(-123456), uint64_t(987654321), 3.14159,
+                     random_string(16), random_string(200), "12345.6789",
+                     "2019-01-01 12:34:56", nullptr);
+
+  while (state->keep_running()) {
+    Row_copy copy(row);
+    do_not_optimize(copy);
+  }
+  state->set_items_processed(state->iterations());
+}
+
+BENCHMARK(expr_parser) {
+  const std::vector<std::string> expressions{
+      "name = :name and age > 18",
+      "$.address.zip in (10000, 20000, 30000) or $.tags[0] like 'a%'",
+      "date_add(created, interval 1 day) < now()",
+      "(a + b) * c - d / 2 >= 100 and not (e is null)",
+      "json_contains($.tags, '[\"x\"]') and cast(id as unsigned) % 2 = 0"};
+  size_t bytes = 0;
+
+  while (state->keep_running()) {
+    for (const auto &expression : expressions) {
+      std::vector<std::string> placeholders;
+      mysqlx::Expr_parser parser(expression, true, false, &placeholders);
+      auto expr = parser.expr();
+      do_not_optimize(expr);
+      bytes += expression.size();
+    }
+  }
+  state->set_bytes_processed(bytes);
+  state->set_items_processed(state->iterations() * expressions.size());
+}
+
+}  // namespace benchmarks
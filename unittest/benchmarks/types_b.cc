@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "unittest/benchmarks/benchmark.h"
+
+namespace benchmarks {
+
+namespace {
+
+/**
+ * A document shaped like the output of cluster.status() or a DbDoc, with
+ * nested maps, arrays, strings and numbers.
+ */
+std::string make_json_document(size_t members) {
+  std::string json = "{\"defaultReplicaSet\": {\"name\": \"default\", ";
+  json.append("\"topology\": {");
+  for (size_t i = 0; i < members; ++i) {
+    if (i > 0) json.append(", ");
+    const std::string address =
+        "host" + std::to_string(i) + ".example.com:3306";
+    json.append("\"")
+        .append(address)
+        .append("\": {\"address\": \"")
+        .append(address)
+        .append("\", \"mode\": \"R/O\", \"readReplicas\": {}, ")
+        .append("\"role\": \"HA\", \"status\": \"ONLINE\", ")
+        .append("\"version\": \"8.0.16\", \"weight\": 0.5, ")
+        .append("\"transactions\": ")
+        .append(std::to_string(1000000 + i))
+        .append(", \"tags\": [\"")
+        .append(random_string(10))
+        .append("\", \"")
+        .append(random_string(10))
+        .append("\", true, false, null]}");
+  }
+  json.append("}}, \"groupInformationSourceMember\": \"host0:3306\"}");
+  return json;
+}
+
+}  // namespace
+
+BENCHMARK(value_parse) {
+  const std::string json = make_json_document(50);
+
+  while (state->keep_running()) {
+    shcore::Value value = shcore::Value::parse(json);
+    do_not_optimize(value);
+  }
+  state->set_bytes_processed(state->iterations() * json.size());
+}
+
+BENCHMARK(value_parse_strings) {
+  std::string json = "[";
+  for (int i = 0; i < 1000; ++i) {
+    if (i > 0) json.append(",");
+    json.append("'").append(random_string(32)).append("\\n'");
+  }
+  json.append("]");
+
+  while (state->keep_running()) {
+    shcore::Value value = shcore::Value::parse(json);
+    do_not_optimize(value);
+  }
+  state->set_bytes_processed(state->iterations() * json.size());
+}
+
+BENCHMARK(value_json_dump) {
+  const shcore::Value value = shcore::Value::parse(make_json_document(50));
+  size_t size = 0;
+
+  while (state->keep_running()) {
+    size += value.json(false).size();
+  }
+  do_not_optimize(size);
+  state->set_bytes_processed(size);
+}
+
+BENCHMARK(value_descr) {
+  const shcore::Value value = shcore::Value::parse(make_json_document(50));
+  size_t size = 0;
+
+  while (state->keep_running()) {
+    size += value.descr(true).size();
+  }
+  do_not_optimize(size);
+  state->set_bytes_processed(size);
+}
+
+BENCHMARK(value_map_build) {
+  std::vector<std::string> keys;
+  for (int i = 0; i < 100; ++i) keys.push_back(random_string(12));
+
+  while (state->keep_running()) {
+    auto map = shcore::Value::new_map();
+    for (const auto &key : keys) {
+      (*map.as_map())[key] = shcore::Value(key);
+    }
+    do_not_optimize(map);
+  }
+  state->set_items_processed(state->iterations() * keys.size());
+}
+
+BENCHMARK(value_array_build) {
+  const std::string text = random_string(40);
+
+  while (state->keep_running()) {
+    auto array = shcore::Value::new_array();
+    auto a = array.as_array();
+    for (int i = 0; i < 100; ++i) {
+      a->push_back(shcore::Value(text));
+      a->push_back(shcore::Value(i));
+    }
+    do_not_optimize(array);
+  }
+  state->set_items_processed(state->iterations() * 200);
+}
+
+}  // namespace benchmarks
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "mysqlshdk/include/shellcore/shell_resultset_dumper.h"
+#include "mysqlshdk/libs/utils/document_parser.h"
+#include "mysqlshdk/libs/utils/utils_buffered_input.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_json.h"
+#include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
+#include "unittest/benchmarks/benchmark.h"
+
+namespace benchmarks {
+
+namespace {
+
+std::string make_sql_script(size_t statements) {
+  std::string script;
+  for (size_t i = 0; i < statements; ++i) {
+    switch (i % 5) {
+      case 0:
+        script.append("-- comment number ")
+            .append(std::to_string(i))
+            .append("\nSELECT * FROM t1 WHERE a = '")
+            .append(random_string(32))
+            .append("';\n");
+        break;
+      case 1:
+        script.append("INSERT INTO `schema`.`table` VALUES (")
+            .append(std::to_string(i))
+            .append(", \"")
+            .append(random_string(64))
+            .append("\", /* inline; comment */ NULL);\n");
+        break;
+      case 2:
+        script.append(
+            "DELIMITER $$\nCREATE PROCEDURE p() BEGIN SELECT 1; "
+            "SELECT 2; END$$\nDELIMITER ;\n");
+        break;
+      case 3:
+        script.append("UPDATE t2 SET b = b + 1,\n  c = 'multi\nline'\n")
+            .append("WHERE id IN (1, 2, 3);\n");
+        break;
+      default:
+        script.append("# hash comment\nSHOW TABLES;\n");
+        break;
+    }
+  }
+  return script;
+}
+
+std::string make_json_documents(size_t count) {
+  std::string data;
+  for (size_t i = 0; i < count; ++i) {
+    data.append("{\"_id\": \"")
+        .append(random_string(24, "0123456789abcdef"))
+        .append("\", \"name\": \"")
+        .append(random_string(20))
+        .append("\", \"age\": ")
+        .append(std::to_string(i % 100))
+        .append(", \"tags\": [\"a\", \"b\", \"c\"], \"address\": {")
+        .append("\"street\": \"")
+        .append(random_string(30))
+        .append("\", \"zip\": ")
+        .append(std::to_string(10000 + i))
+        .append("}, \"created\": {\"$date\": \"2019-01-01T00:00:00Z\"}}\n");
+  }
+  return data;
+}
+
+}  // namespace
+
+BENCHMARK(sql_splitter) {
+  const std::string script = make_sql_script(10000);
+  size_t count = 0;
+
+  while (state->keep_running()) {
+    std::istringstream stream(script);
+    mysqlshdk::utils::iterate_sql_stream(
+        &stream, 64 * 1024,
+        [&count](const char *, size_t, const std::string &, size_t) {
+          ++count;
+          return true;
+        },
+        [](const std::string &) {});
+  }
+  do_not_optimize(count);
+  state->set_bytes_processed(state->iterations() * script.size());
+  state->set_items_processed(count);
+}
+
+BENCHMARK(get_utf8_sizes_ascii) {
+  const std::string text = random_string(4096);
+  size_t total = 0;
+
+  while (state->keep_running()) {
+    total += std::get<0>(
+        mysqlsh::get_utf8_sizes(text.data(), text.size(), mysqlsh::Print_flags()));
+  }
+  do_not_optimize(total);
+  state->set_bytes_processed(state->iterations() * text.size());
+}
+
+BENCHMARK(get_utf8_sizes_multibyte) {
+  std::string text;
+  while (text.size() < 4096)
+    text.append(random_string(8)).append("\xc3\xa1\xe3\x81\x82\xf0\x9f\x98\x80");
+  size_t total = 0;
+
+  while (state->keep_running()) {
+    total += std::get<0>(
+        mysqlsh::get_utf8_sizes(text.data(), text.size(), mysqlsh::Print_flags()));
+  }
+  do_not_optimize(total);
+  state->set_bytes_processed(state->iterations() * text.size());
+}
+
+BENCHMARK(json_document_parser) {
+  const std::string data = make_json_documents(5000);
+  const std::string path =
+      temporary_path("mysqlsh_json_document_parser_benchmark.json");
+  shcore::create_file(path, data);
+
+  shcore::Document_reader_options options;
+  options.convert_bson_types = true;
+  size_t count = 0;
+
+  while (state->keep_running()) {
+    shcore::Buffered_input input(path);
+    shcore::Json_reader reader(&input, options);
+    while (!reader.eof()) {
+      if (!reader.next().empty()) ++count;
+    }
+  }
+
+  shcore::delete_file(path);
+  do_not_optimize(count);
+  state->set_bytes_processed(state->iterations() * data.size());
+  state->set_items_processed(count);
+}
+
+BENCHMARK(json_dumper_scalars) {
+  const std::string text = random_string(40);
+  size_t size = 0;
+
+  while (state->keep_running()) {
+    shcore::JSON_dumper dumper(false);
+    dumper.start_array();
+    for (int i = 0; i < 1000; ++i) {
+      dumper.start_object();
+      dumper.append_int64("id", i);
+      dumper.append_float("value", i * 1.25);
+      dumper.append_string("text", text);
+      dumper.append_null("nothing");
+      dumper.end_object();
+    }
+    dumper.end_array();
+    size += dumper.str().size();
+  }
+  do_not_optimize(size);
+  state->set_bytes_processed(size);
+  state->set_items_processed(state->iterations() * 1000);
+}
+
+}  // namespace benchmarks
@@ -198,4 +198,80 @@ TEST(Cmdline_shell, help) {
   EXPECT_EQ(expected, capture);
 }
 
+TEST(Cmdline_shell, lazy_globals) {
+  {
+    char *args[] = {const_cast<char *>("ut"), const_cast<char *>("--sql"),
+                    nullptr};
+    Command_line_shell shell(std::make_shared<Shell_options>(2, args));
+    shell.finish_init();
+
+    // SQL mode does not use the global objects
+    EXPECT_EQ(nullptr, shell._global_dba);
+    EXPECT_EQ(nullptr, shell._global_util);
+    EXPECT_EQ(nullptr, shell._global_js_sys);
+
+    // explicit request creates only the requested object
+    EXPECT_TRUE(shell.shell_context()->get_global("dba").as_object());
+    EXPECT_NE(nullptr, shell._global_dba);
+    EXPECT_EQ(nullptr, shell._global_util);
+
+#ifdef HAVE_PYTHON
+    // context of a scripting language creates the objects it uses
+    shell.shell_context()->init_py();
+    EXPECT_NE(nullptr, shell._global_util);
+    EXPECT_EQ(nullptr, shell._global_js_sys);
+    EXPECT_TRUE(shell.shell_context()->get_global("util").as_object());
+#endif  // HAVE_PYTHON
+  }
+
+#ifdef HAVE_V8
+  {
+    char *args[] = {const_cast<char *>("ut"), const_cast<char *>("--js"),
+                    nullptr};
+    Command_line_shell shell(std::make_shared<Shell_options>(2, args));
+    shell.finish_init();
+
+    EXPECT_NE(nullptr, shell._global_dba);
+    EXPECT_NE(nullptr, shell._global_util);
+    EXPECT_NE(nullptr, shell._global_js_sys);
+  }
+#endif  // HAVE_V8
+}
+
+class Recording_shell : public Command_line_shell {
+ public:
+  using Command_line_shell::Command_line_shell;
+
+  void process_line(const std::string &line) override {
+    lines.push_back(line);
+  }
+
+  std::vector<std::string> lines;
+};
+
+TEST(Cmdline_shell, process_pasted_input) {
+  char *args[] = {const_cast<char *>("ut"), const_cast<char *>("--sql"),
+                  nullptr};
+  Recording_shell shell(std::make_shared<Shell_options>(2, args));
+  shell.finish_init();
+
+  // SQL is given to the splitter at once, statements may span lines
+  shell.process_pasted_input("select 1;\nselect\n2;");
+  EXPECT_EQ(std::vector<std::string>({"select 1;\nselect\n2;"}), shell.lines);
+
+  // shell commands are recognized only at the beginning of a line, so each
+  // line is processed separately
+  shell.lines.clear();
+  shell.process_pasted_input("select 1;\n  \\status\nselect 2;");
+  EXPECT_EQ(
+      std::vector<std::string>({"select 1;", "  \\status", "select 2;"}),
+      shell.lines);
+
+  // backslash which is not at the beginning of a line is not a command
+  shell.lines.clear();
+  shell.process_pasted_input("select '\\';\nselect 2;");
+  EXPECT_EQ(std::vector<std::string>({"select '\\';\nselect 2;"}),
+            shell.lines);
+}
+
 }  // namespace mysqlsh
@@ -657,6 +657,7 @@ TEST_F(Completer_frontend, js_shell) {
                                        "listCredentials()",
                                        "log()",
                                        "options",
+                                       "parallel()",
                                        "parseUri()",
                                        "prompt()",
                                        "reconnect()",
@@ -1146,6 +1147,7 @@ TEST_F(Completer_frontend, py_shell) {
                                        "list_credentials()",
                                        "log()",
                                        "options",
+                                       "parallel()",
                                        "parse_uri()",
                                        "prompt()",
                                        "reconnect()",
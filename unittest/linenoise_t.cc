@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gtest_clean.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "ext/linenoise-ng/include/linenoise.h"
+
+namespace linenoise_test {
+
+#ifndef _WIN32
+
+/**
+ * Connects stdin and stdout to a pseudo terminal, so that linenoise() can be
+ * fed with the key strokes sent by a terminal.
+ */
+class Terminal {
+ public:
+  Terminal() {
+    m_master = posix_openpt(O_RDWR | O_NOCTTY);
+    grantpt(m_master);
+    unlockpt(m_master);
+    m_slave = open(ptsname(m_master), O_RDWR | O_NOCTTY);
+
+    // input is processed by linenoise only
+    termios attributes;
+    tcgetattr(m_slave, &attributes);
+    cfmakeraw(&attributes);
+    tcsetattr(m_slave, TCSANOW, &attributes);
+
+    winsize size{24, 80, 0, 0};
+    ioctl(m_slave, TIOCSWINSZ, &size);
+
+    fflush(stdout);
+    m_stdin = dup(STDIN_FILENO);
+    m_stdout = dup(STDOUT_FILENO);
+    dup2(m_slave, STDIN_FILENO);
+    dup2(m_slave, STDOUT_FILENO);
+
+    const char *term = getenv("TERM");
+    if (term) m_term = term;
+    setenv("TERM", "xterm", 1);
+
+    // echoed text needs to be read, otherwise linenoise() would block
+    m_reader = std::thread([this]() {
+      pollfd fd{m_master, POLLIN, 0};
+      char buffer[4096];
+
+      while (!m_stop) {
+        if (poll(&fd, 1, 10) > 0 && read(m_master, buffer, sizeof(buffer)) <= 0)
+          break;
+      }
+    });
+  }
+
+  Terminal(const Terminal &) = delete;
+  Terminal &operator=(const Terminal &) = delete;
+
+  ~Terminal() {
+    stop_reader();
+
+    fflush(stdout);
+    dup2(m_stdin, STDIN_FILENO);
+    dup2(m_stdout, STDOUT_FILENO);
+    close(m_stdin);
+    close(m_stdout);
+    close(m_slave);
+    if (m_master != -1) close(m_master);
+
+    if (m_term.empty())
+      unsetenv("TERM");
+    else
+      setenv("TERM", m_term.c_str(), 1);
+  }
+
+  void type(const std::string &keys) {
+    ASSERT_EQ(static_cast<ssize_t>(keys.length()),
+              write(m_master, keys.c_str(), keys.length()));
+  }
+
+  /**
+   * Closes the terminal once all of the input was read.
+   */
+  void hang_up() {
+    int pending = 0;
+
+    do {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      ioctl(m_slave, FIONREAD, &pending);
+    } while (pending > 0);
+
+    stop_reader();
+    close(m_master);
+    m_master = -1;
+  }
+
+ private:
+  void stop_reader() {
+    m_stop = true;
+    if (m_reader.joinable()) m_reader.join();
+  }
+
+  int m_master = -1;
+  int m_slave = -1;
+  int m_stdin = -1;
+  int m_stdout = -1;
+  std::string m_term;
+  std::atomic<bool> m_stop{false};
+  std::thread m_reader;
+};
+
+constexpr const char k_paste_start[] = "\x1b[200~";
+constexpr const char k_paste_end[] = "\x1b[201~";
+constexpr const char k_enter[] = "\r";
+
+std::string paste(const std::string &text) {
+  return k_paste_start + text + k_paste_end;
+}
+
+/**
+ * Reads a line using linenoise(), input is sent to the terminal by the
+ * callback. Returns false if linenoise() returned NULL.
+ */
+template <typename F>
+bool read_line(F &&type, std::string *line) {
+  Terminal terminal;
+  auto result = std::async(std::launch::async, []() -> std::pair<bool, std::string> {
+    char *input = linenoise("> ");
+    if (!input) return {false, ""};
+    std::string copy = input;
+    free(input);
+    return {true, copy};
+  });
+
+  type(&terminal);
+
+  if (result.wait_for(std::chrono::seconds(10)) != std::future_status::ready) {
+    ADD_FAILURE() << "linenoise() did not return";
+    terminal.hang_up();
+  }
+
+  const auto ret = result.get();
+  *line = ret.second;
+  return ret.first;
+}
+
+TEST(Linenoise_paste, single_line) {
+  std::string line;
+
+  // pasted text is inserted at the cursor, it's not accepted without Enter
+  ASSERT_TRUE(read_line(
+      [](Terminal *t) {
+        t->type("sel2");
+        t->type("\x1b[D");  // left arrow
+        t->type(paste("ect 1, "));
+        t->type(k_enter);
+      },
+      &line));
+  EXPECT_EQ("select 1, 2", line);
+
+  // pasted text can be edited
+  ASSERT_TRUE(read_line(
+      [](Terminal *t) {
+        t->type(paste("select 1"));
+        t->type("\x7f");  // backspace
+        t->type("2");
+        t->type(k_enter);
+      },
+      &line));
+  EXPECT_EQ("select 2", line);
+
+  // pasted text can be discarded
+  EXPECT_FALSE(read_line(
+      [](Terminal *t) {
+        t->type(paste("drop schema test"));
+        t->type("\x03");  // ^C
+      },
+      &line));
+}
+
+TEST(Linenoise_paste, multi_line) {
+  std::string line;
+
+  // all lines are returned at once, only after Enter is pressed, terminals
+  // send CR as the line separator
+  ASSERT_TRUE(read_line(
+      [](Terminal *t) {
+        t->type(paste("select 1;\rselect 2;\r\nsel"));
+        t->type("ect 3;");
+        t->type(k_enter);
+      },
+      &line));
+  EXPECT_EQ("select 1;\nselect 2;\nselect 3;", line);
+
+  // text after the cursor follows the last pasted line
+  ASSERT_TRUE(read_line(
+      [](Terminal *t) {
+        t->type("xy");
+        t->type("\x1b[D");  // left arrow
+        t->type(paste("a\rb"));
+        t->type(paste("c\rd"));
+        t->type(k_enter);
+      },
+      &line));
+  EXPECT_EQ("xa\nbc\ndy", line);
+
+  // pasted lines are discarded by ^C
+  EXPECT_FALSE(read_line(
+      [](Terminal *t) {
+        t->type(paste("drop schema test;\r"));
+        t->type("\x03");  // ^C
+      },
+      &line));
+
+  // next call does not return the lines discarded before
+  ASSERT_TRUE(read_line(
+      [](Terminal *t) {
+        t->type("select 4;");
+        t->type(k_enter);
+      },
+      &line));
+  EXPECT_EQ("select 4;", line);
+}
+
+TEST(Linenoise_paste, overflow) {
+  // edit buffer holds up to 4095 characters
+  const std::string k_long(5000, 'x');
+  const std::string k_truncated(4095, 'x');
+  std::string line;
+
+  // text which does not fit is truncated, it's not accepted without Enter
+  ASSERT_TRUE(read_line(
+      [&k_long](Terminal *t) {
+        t->type(paste(k_long));
+        t->type("\x7f");  // backspace
+        t->type(k_enter);
+      },
+      &line));
+  EXPECT_EQ(k_truncated.substr(1), line);
+
+  // last line of a multi-line paste is truncated as well
+  ASSERT_TRUE(read_line(
+      [&k_long](Terminal *t) {
+        t->type(paste("select 1;\r" + k_long));
+        t->type(k_enter);
+      },
+      &line));
+  EXPECT_EQ("select 1;\n" + k_truncated, line);
+
+  // long lines before the last one are returned as they are
+  ASSERT_TRUE(read_line(
+      [&k_long](Terminal *t) {
+        t->type(paste(k_long + "\rselect 1;"));
+        t->type(k_enter);
+      },
+      &line));
+  EXPECT_EQ(k_long + "\nselect 1;", line);
+}
+
+TEST(Linenoise_paste, unterminated) {
+  std::string line;
+
+  // terminal hangs up before the paste ends, nothing is accepted
+  EXPECT_FALSE(read_line(
+      [](Terminal *t) {
+        t->type(k_paste_start);
+        t->type("select 1;\rselect 2;\r");
+        t->hang_up();
+      },
+      &line));
+
+  EXPECT_FALSE(read_line(
+      [](Terminal *t) {
+        t->type(paste("select 1;"));
+        t->hang_up();
+      },
+      &line));
+
+  // key strokes after the end of the paste are not part of it
+  ASSERT_TRUE(read_line(
+      [](Terminal *t) {
+        t->type(paste("select 1") + ";" + k_enter);
+      },
+      &line));
+  EXPECT_EQ("select 1;", line);
+}
+
+#endif  // !_WIN32
+
+}  // namespace linenoise_test
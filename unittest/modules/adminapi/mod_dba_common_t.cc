@@ -25,9 +25,13 @@
 
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/group_replication_options.h"
+#include "modules/adminapi/common/instance_probe.h"
+#include "modules/adminapi/common/instance_validations.h"
 #include "modules/adminapi/common/metadata_storage.h"
+#include "modules/adminapi/common/sql.h"
 #include "modules/mod_shell.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/utils_connection.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "scripting/types.h"
@@ -555,6 +559,227 @@ TEST_F(Dba_common_test, resolve_instance_ssl_cluster_with_ssl_disabled) {
   testutil->destroy_sandbox(_mysql_sandbox_port2);
 }
 
+TEST_F(Dba_common_test, validate_schemas) {
+  using mysqlsh::dba::checks::validate_schemas;
+  using mysqlshdk::db::Type;
+
+  const auto schemas_query =
+      "SELECT schema_name FROM information_schema.schemata WHERE schema_name "
+      "NOT IN ('mysql', 'sys', 'performance_schema', 'information_schema') "
+      "ORDER BY schema_name";
+  const auto engine_query = [](const std::string &schema) {
+    return "SELECT table_name FROM information_schema.tables WHERE "
+           "table_schema = '" +
+           schema + "' AND engine NOT IN ('InnoDB', 'MEMORY')";
+  };
+  const auto pk_query = [](const std::string &schema) {
+    return "SELECT t.table_name FROM information_schema.tables t     LEFT "
+           "JOIN (SELECT table_name                FROM "
+           "information_schema.statistics                WHERE table_schema "
+           "= '" +
+           schema +
+           "'                GROUP BY table_name, index_name                "
+           "HAVING SUM(CASE                    WHEN non_unique = 0 AND "
+           "nullable <> 'YES'                    THEN 1 ELSE 0 END) = "
+           "COUNT(*)               ) puks     ON t.table_name = "
+           "puks.table_name WHERE t.table_schema = '" +
+           schema +
+           "'     AND puks.table_name IS NULL     AND t.table_type = 'BASE "
+           "TABLE'";
+  };
+  const auto no_tables = Fake_result_data{"", {"table_name"}, {Type::String}};
+
+  auto mock_session = std::make_shared<Mock_session>();
+
+  // TEST: issues from all of the schemas are reported, in order
+  mock_session->expect_query(schemas_query)
+      .then_return(
+          {{"", {"schema_name"}, {Type::String}, {{"db1"}, {"db2"}}}});
+  mock_session->expect_query(engine_query("db1"))
+      .then_return({{"", {"table_name"}, {Type::String}, {{"t1"}}}});
+  mock_session->expect_query(pk_query("db1")).then_return({no_tables});
+  mock_session->expect_query(engine_query("db2"))
+      .then_return({{"", {"table_name"}, {Type::String}, {{"t2"}}}});
+  mock_session->expect_query(pk_query("db2"))
+      .then_return({{"", {"table_name"}, {Type::String}, {{"t3"}, {"t4"}}}});
+
+  EXPECT_FALSE(validate_schemas(mock_session));
+  MY_EXPECT_STDOUT_CONTAINS(
+      "The following tables use a storage engine that are not supported by "
+      "Group Replication:");
+  MY_EXPECT_STDOUT_CONTAINS("db1.t1, db2.t2\n");
+  MY_EXPECT_STDOUT_CONTAINS(
+      "The following tables do not have a Primary Key or equivalent column:");
+  MY_EXPECT_STDOUT_CONTAINS("db2.t3, db2.t4\n");
+  // there's no limit by default
+  MY_EXPECT_STDOUT_NOT_CONTAINS("Validation stopped");
+  output_handler.wipe_all();
+
+  // TEST: scan stops once the limit of issues is reached
+  mock_session->expect_query(schemas_query)
+      .then_return(
+          {{"", {"schema_name"}, {Type::String}, {{"db1"}, {"db2"}}}});
+  mock_session->expect_query(engine_query("db1"))
+      .then_return(
+          {{"", {"table_name"}, {Type::String}, {{"t1"}, {"t2"}, {"t3"}}}});
+
+  mysqlsh::dba::checks::Schema_validation_options options;
+  options.max_issues = 2;
+
+  EXPECT_FALSE(validate_schemas(mock_session, options));
+  MY_EXPECT_STDOUT_CONTAINS("db1.t1, db1.t2\n");
+  MY_EXPECT_STDOUT_NOT_CONTAINS("db1.t3");
+  MY_EXPECT_STDOUT_CONTAINS(
+      "Validation stopped after 2 incompatible tables were found, there may "
+      "be more.");
+  MY_EXPECT_STDOUT_NOT_CONTAINS("do not have a Primary Key");
+  output_handler.wipe_all();
+
+  // TEST: errors are reported to the caller
+  mock_session->expect_query(schemas_query)
+      .then_return(
+          {{"", {"schema_name"}, {Type::String}, {{"db1"}, {"db2"}}}});
+  mock_session->expect_query(engine_query("db1")).then_throw();
+
+  EXPECT_THROW(validate_schemas(mock_session), std::runtime_error);
+  MY_EXPECT_STDOUT_NOT_CONTAINS("WARNING");
+  output_handler.wipe_all();
+
+  // TEST: no issues
+  mock_session->expect_query(schemas_query)
+      .then_return({{"", {"schema_name"}, {Type::String}, {{"db1"}}}});
+  mock_session->expect_query(engine_query("db1")).then_return({no_tables});
+  mock_session->expect_query(pk_query("db1")).then_return({no_tables});
+
+  EXPECT_TRUE(validate_schemas(mock_session));
+  MY_EXPECT_STDOUT_NOT_CONTAINS("WARNING");
+}
+
+TEST_F(Dba_common_test, get_slave_replication_state) {
+  using mysqlsh::dba::get_slave_replication_state;
+  using mysqlsh::dba::SlaveReplicationState;
+  using mysqlshdk::db::Type;
+
+  const std::string query =
+      "select @@global.gtid_executed, @@global.gtid_purged";
+  const auto gtids = [](const std::string &executed) {
+    return Fake_result_data{"",
+                            {"@@global.gtid_executed", "@@global.gtid_purged"},
+                            {Type::String, Type::String},
+                            {{executed, ""}}};
+  };
+  const std::string uuid = "3e11fa47-71ca-11e1-9e33-c80aa9429562";
+
+  auto mock_session = std::make_shared<Mock_session>();
+
+  mock_session->expect_query(query).then_return({gtids(uuid + ":1-10")});
+  EXPECT_EQ(SlaveReplicationState::Recoverable,
+            get_slave_replication_state(mock_session, uuid + ":1-5"));
+
+  mock_session->expect_query(query).then_return({gtids(uuid + ":1-10")});
+  EXPECT_EQ(SlaveReplicationState::Diverged,
+            get_slave_replication_state(mock_session, uuid + ":1-20"));
+
+  // TEST: malformed GTID set is reported as a regular shell error
+  mock_session->expect_query(query).then_return({gtids(uuid + ":1-10")});
+  EXPECT_THROW_LIKE(get_slave_replication_state(mock_session, uuid + ":5-3"),
+                    shcore::Exception,
+                    "Malformed GTID set specification '" + uuid + ":5-3'.");
+
+  mock_session->expect_query(query).then_return({gtids("not a GTID set")});
+  EXPECT_THROW_LIKE(get_slave_replication_state(mock_session, uuid + ":1"),
+                    shcore::Exception,
+                    "Malformed GTID set specification 'not a GTID set'.");
+}
+
+TEST_F(Dba_common_test, probe_instances) {
+  using mysqlsh::dba::probe_instances;
+
+  testutil->deploy_sandbox(_mysql_sandbox_port1, "root");
+  testutil->deploy_sandbox(_mysql_sandbox_port2, "root");
+
+  const auto options = [](int port) {
+    return shcore::get_connection_options(
+        "root:root@localhost:" + std::to_string(port), false);
+  };
+
+  // third sandbox is not deployed
+  const std::vector<mysqlshdk::db::Connection_options> instances = {
+      options(_mysql_sandbox_port2), options(_mysql_sandbox_port3),
+      options(_mysql_sandbox_port1), options(_mysql_sandbox_port2)};
+
+  // TEST: results are in order of the instances
+  {
+    // each call writes its own element
+    std::vector<int> ports(instances.size(), 0);
+
+    const auto results = probe_instances(
+        instances,
+        [&ports](std::size_t index,
+                 const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+          ports[index] =
+              session->query("SELECT @@port")->fetch_one()->get_int(0);
+        });
+
+    ASSERT_EQ(instances.size(), results.size());
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      SCOPED_TRACE(i);
+      EXPECT_EQ(instances[i].get_port(), results[i].connection.get_port());
+      EXPECT_TRUE(results[i].connection.has(mysqlshdk::db::kConnectTimeout));
+      EXPECT_FALSE(results[i].error);
+    }
+
+    EXPECT_EQ(std::vector<int>({_mysql_sandbox_port2, 0, _mysql_sandbox_port1,
+                                _mysql_sandbox_port2}),
+              ports);
+
+    // TEST: unreachable instances are reported, without calling the probe
+    EXPECT_TRUE(results[0].connect_error.empty());
+    EXPECT_FALSE(results[1].connect_error.empty());
+    EXPECT_TRUE(results[2].connect_error.empty());
+    EXPECT_TRUE(results[3].connect_error.empty());
+  }
+
+  // TEST: errors thrown by the probe are stored with the instance, remaining
+  // instances are still probed
+  for (const std::size_t threads : {1, 16}) {
+    SCOPED_TRACE(threads);
+    std::vector<int> probed(instances.size(), 0);
+
+    const auto results = probe_instances(
+        instances,
+        [&probed](std::size_t index,
+                  const std::shared_ptr<mysqlshdk::db::ISession> &) {
+          probed[index] = 1;
+          if (index != 3) throw std::runtime_error("probe failed");
+        },
+        std::chrono::milliseconds(mysqlshdk::db::k_default_connect_timeout),
+        threads);
+
+    ASSERT_EQ(instances.size(), results.size());
+    EXPECT_EQ(std::vector<int>({1, 0, 1, 1}), probed);
+
+    for (const std::size_t i : {0, 2}) {
+      SCOPED_TRACE(i);
+      ASSERT_TRUE(results[i].error);
+
+      try {
+        std::rethrow_exception(results[i].error);
+      } catch (const std::runtime_error &e) {
+        EXPECT_STREQ("probe failed", e.what());
+      }
+    }
+
+    EXPECT_FALSE(results[1].error);
+    EXPECT_FALSE(results[1].connect_error.empty());
+    EXPECT_FALSE(results[3].error);
+  }
+
+  testutil->destroy_sandbox(_mysql_sandbox_port1);
+  testutil->destroy_sandbox(_mysql_sandbox_port2);
+}
+
 TEST_F(Dba_common_test, check_admin_account_access_restrictions) {
   using mysqlsh::dba::check_admin_account_access_restrictions;
   using mysqlshdk::db::Type;
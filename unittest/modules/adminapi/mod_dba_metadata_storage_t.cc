@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/adminapi/common/metadata_storage.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
+#include "unittest/test_utils/shell_base_test.h"
+
+namespace testing {
+
+using mysqlshdk::db::Type;
+
+namespace {
+
+constexpr const char k_gtid_query[] = "SELECT @@GLOBAL.gtid_executed";
+constexpr const char k_replicasets_query[] =
+    "SELECT replicaset_id, cluster_id, topology_type, active "
+    "FROM mysql_innodb_cluster_metadata.replicasets";
+constexpr const char k_instances_query[] =
+    "SELECT host_id, replicaset_id, mysql_server_uuid, instance_name, role, "
+    "JSON_UNQUOTE(JSON_EXTRACT(addresses, '$.mysqlClassic')), "
+    "JSON_UNQUOTE(JSON_EXTRACT(addresses, '$.mysqlX')), "
+    "JSON_UNQUOTE(JSON_EXTRACT(addresses, '$.grLocal')) "
+    "FROM mysql_innodb_cluster_metadata.instances ORDER BY instance_id";
+
+}  // namespace
+
+class Metadata_storage_cache : public tests::Shell_base_test {
+ protected:
+  void SetUp() override {
+    tests::Shell_base_test::SetUp();
+
+    m_session = std::make_shared<Mock_session>();
+    m_metadata = std::make_shared<mysqlsh::dba::MetadataStorage>(m_session);
+  }
+
+  void TearDown() override {
+    m_metadata.reset();
+    m_session.reset();
+
+    tests::Shell_base_test::TearDown();
+  }
+
+  void expect_gtid(const std::string &gtid) {
+    m_session->expect_query(k_gtid_query)
+        .then_return({{"", {"@@GLOBAL.gtid_executed"}, {Type::String},
+                       {{gtid}}}});
+  }
+
+  void expect_tables(const std::vector<std::string> &addresses) {
+    m_session->expect_query(k_replicasets_query)
+        .then_return({{"",
+                       {"replicaset_id", "cluster_id", "topology_type",
+                        "active"},
+                       {Type::UInteger, Type::UInteger, Type::String,
+                        Type::Integer},
+                       {{"1", "1", "pm", "1"}}}});
+
+    Fake_result_data instances{
+        "",
+        {"host_id", "replicaset_id", "mysql_server_uuid", "instance_name",
+         "role", "classic", "x", "gr"},
+        {Type::UInteger, Type::UInteger, Type::String, Type::String,
+         Type::String, Type::String, Type::String, Type::String},
+        {}};
+
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      instances.rows.push_back({std::to_string(i + 1), "1",
+                                "uuid" + std::to_string(i + 1), addresses[i],
+                                "HA", addresses[i], addresses[i] + "0",
+                                addresses[i] + "1"});
+    }
+
+    m_session->expect_query(k_instances_query).then_return({instances});
+  }
+
+  void expect_snapshot(const std::string &gtid,
+                       const std::vector<std::string> &addresses) {
+    expect_gtid(gtid);
+    expect_tables(addresses);
+  }
+
+  void expect_count_query(uint64_t count) {
+    m_session
+        ->expect_query(
+            "SELECT COUNT(*) as count FROM "
+            "mysql_innodb_cluster_metadata.instances WHERE replicaset_id = 1")
+        .then_return({{"", {"count"}, {Type::Integer},
+                       {{std::to_string(count)}}}});
+  }
+
+  std::shared_ptr<Mock_session> m_session;
+  std::shared_ptr<mysqlsh::dba::MetadataStorage> m_metadata;
+};
+
+TEST_F(Metadata_storage_cache, no_scope) {
+  // without a scope every call queries the server
+  expect_count_query(2);
+  EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+
+  expect_count_query(3);
+  EXPECT_EQ(3u, m_metadata->get_replicaset_count(1));
+}
+
+TEST_F(Metadata_storage_cache, loaded_once_per_scope) {
+  mysqlsh::dba::MetadataStorage::Cache_scope scope(m_metadata);
+
+  expect_snapshot("uuid:1-10", {"h1:3306", "h2:3306"});
+
+  // all of these are answered by a single snapshot, the mock fails on any
+  // further query
+  EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+  EXPECT_EQ(0u, m_metadata->get_replicaset_count(2));
+  EXPECT_EQ("h2:3306", m_metadata->get_instance("h2:3306").label);
+  EXPECT_EQ("h2:33060", m_metadata->get_instance("h2:3306").xendpoint);
+  EXPECT_TRUE(m_metadata->is_instance_on_replicaset(1, "h1:3306"));
+  EXPECT_FALSE(m_metadata->is_instance_on_replicaset(1, "h3:3306"));
+  EXPECT_EQ(2u, m_metadata->get_replicaset_instances(1).size());
+  EXPECT_EQ(1u, m_metadata->get_cluster_id(uint64_t{1}));
+  EXPECT_TRUE(m_metadata->is_replicaset_active(1));
+  EXPECT_EQ(mysqlshdk::gr::Topology_mode::SINGLE_PRIMARY,
+            m_metadata->get_replicaset_topology_mode(1));
+  EXPECT_THROW(m_metadata->get_instance("h3:3306"), shcore::Exception);
+
+  {
+    // nested scopes share the snapshot
+    mysqlsh::dba::MetadataStorage::Cache_scope nested(m_metadata);
+    EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+  }
+
+  EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+}
+
+TEST_F(Metadata_storage_cache, dropped_after_write) {
+  mysqlsh::dba::MetadataStorage::Cache_scope scope(m_metadata);
+
+  expect_snapshot("uuid:1-10", {"h1:3306", "h2:3306"});
+  EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+
+  m_session
+      ->expect_query(
+          "DELETE FROM mysql_innodb_cluster_metadata.instances WHERE "
+          "addresses->'$.mysqlClassic' = 'h2:3306'")
+      .then_return({});
+  m_metadata->remove_instance("h2:3306");
+
+  // snapshot is reloaded within the same scope
+  expect_snapshot("uuid:1-11", {"h1:3306"});
+  EXPECT_EQ(1u, m_metadata->get_replicaset_count(1));
+  EXPECT_FALSE(m_metadata->is_instance_on_replicaset(1, "h2:3306"));
+}
+
+TEST_F(Metadata_storage_cache, dropped_after_write_by_other_object) {
+  mysqlsh::dba::MetadataStorage::Cache_scope scope(m_metadata);
+
+  expect_snapshot("uuid:1-10", {"h1:3306", "h2:3306"});
+  EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+
+  // metadata is modified through a different session
+  auto other_session = std::make_shared<Mock_session>();
+  auto other = std::make_shared<mysqlsh::dba::MetadataStorage>(other_session);
+  other_session
+      ->expect_query(
+          "DELETE FROM mysql_innodb_cluster_metadata.instances WHERE "
+          "addresses->'$.mysqlClassic' = 'h1:3306'")
+      .then_return({});
+  other->remove_instance("h1:3306");
+
+  expect_snapshot("uuid:1-11", {"h2:3306"});
+  EXPECT_EQ(1u, m_metadata->get_replicaset_count(1));
+  EXPECT_TRUE(m_metadata->is_instance_on_replicaset(1, "h2:3306"));
+}
+
+TEST_F(Metadata_storage_cache, validated_by_gtid) {
+  {
+    mysqlsh::dba::MetadataStorage::Cache_scope scope(m_metadata);
+    expect_snapshot("uuid:1-10", {"h1:3306", "h2:3306"});
+    EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+  }
+
+  {
+    // GTID_EXECUTED did not change, snapshot is reused
+    mysqlsh::dba::MetadataStorage::Cache_scope scope(m_metadata);
+    expect_gtid("uuid:1-10");
+    EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+    EXPECT_TRUE(m_metadata->is_instance_on_replicaset(1, "h2:3306"));
+  }
+
+  {
+    // some other client changed something, snapshot is loaded again, the
+    // value of GTID_EXECUTED which was just read is reused
+    mysqlsh::dba::MetadataStorage::Cache_scope scope(m_metadata);
+    expect_gtid("uuid:1-12");
+    expect_tables({"h1:3306", "h2:3306", "h3:3306"});
+    EXPECT_EQ(3u, m_metadata->get_replicaset_count(1));
+    EXPECT_TRUE(m_metadata->is_instance_on_replicaset(1, "h3:3306"));
+  }
+
+  {
+    mysqlsh::dba::MetadataStorage::Cache_scope scope(m_metadata);
+    expect_gtid("uuid:1-12");
+    EXPECT_EQ(3u, m_metadata->get_replicaset_count(1));
+  }
+}
+
+TEST_F(Metadata_storage_cache, bypassed_in_transaction) {
+  mysqlsh::dba::MetadataStorage::Cache_scope scope(m_metadata);
+
+  expect_snapshot("uuid:1-10", {"h1:3306", "h2:3306"});
+  EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+
+  {
+    EXPECT_CALL(*m_session, execute("start transaction"));
+    mysqlsh::dba::MetadataStorage::Transaction tx(m_metadata);
+
+    // changes of the transaction are not visible in GTID_EXECUTED
+    expect_count_query(5);
+    EXPECT_EQ(5u, m_metadata->get_replicaset_count(1));
+    expect_count_query(5);
+    EXPECT_EQ(5u, m_metadata->get_replicaset_count(1));
+
+    EXPECT_CALL(*m_session, execute("rollback"));
+  }
+
+  // rollback drops the snapshot
+  expect_snapshot("uuid:1-10", {"h1:3306", "h2:3306"});
+  EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+}
+
+TEST_F(Metadata_storage_cache, load_failure) {
+  mysqlsh::dba::MetadataStorage::Cache_scope scope(m_metadata);
+
+  // snapshot cannot be loaded, calls fall back to the regular queries
+  m_session->expect_query(k_gtid_query).then_throw();
+  expect_count_query(2);
+  EXPECT_EQ(2u, m_metadata->get_replicaset_count(1));
+}
+
+}  // namespace testing
@@ -23,9 +23,11 @@
 
 #include <memory>
 #include <string>
+#include <thread>
 
 #include "modules/mod_shell_reports.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/mocks/gmock_clean.h"
@@ -265,4 +267,27 @@ TEST_F(Mod_shell_reports_test, report_optional_string_option) {
               ::testing::HasSubstr(k_expected_value));
 }
 
+TEST_F(Mod_shell_reports_test, native_report) {
+  auto report = shcore::make_unique<Report>(
+      k_test_report, Report::Type::REPORT,
+      [](const std::shared_ptr<ShellBaseSession> &, const shcore::Array_t &,
+         const shcore::Dictionary_t &) { return make_report(); });
+
+  m_reports->register_report(std::move(report));
+
+  EXPECT_TRUE(m_reports->is_native_report(k_test_report));
+  EXPECT_TRUE(m_reports->is_native_report(shcore::str_upper(k_test_report)));
+  EXPECT_TRUE(m_reports->is_native_report("query"));
+  EXPECT_FALSE(m_reports->is_native_report("unknown"));
+
+  // native reports can be called from a background thread
+  std::string output;
+  std::thread thread([this, &output]() {
+    output = m_reports->call_report(k_test_report, m_session, {});
+  });
+  thread.join();
+
+  EXPECT_THAT(output, ::testing::HasSubstr(k_expected_value));
+}
+
 }  // namespace tests
@@ -21,7 +21,13 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <chrono>
+
 #include "modules/mod_shell.h"
+#include "mysqlshdk/include/scripting/shexcept.h"
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
 #include "scripting/types.h"
 #include "unittest/test_utils.h"
 #include "unittest/test_utils/mocks/gmock_clean.h"
@@ -209,4 +215,115 @@ TEST_F(mod_shell_test, connect) {
   _shell->connect(args);
 }
 
+TEST_F(mod_shell_test, parallel) {
+  const auto job = [](const std::string &uri, shcore::Value sql) {
+    const auto dict = shcore::make_dict();
+    dict->set("connection", shcore::Value(uri));
+    dict->set("sql", sql);
+    return shcore::Value(dict);
+  };
+
+  const auto statements = shcore::make_array();
+  statements->emplace_back("select 1");
+  statements->emplace_back("select 2, 3");
+
+  const auto jobs = shcore::make_array();
+  jobs->emplace_back(job(_mysql_uri, shcore::Value(statements)));
+  jobs->emplace_back(
+      job(_mysql_uri, shcore::Value("select * from mysql.no_such_table")));
+  jobs->emplace_back(job(_mysql_uri, shcore::Value("select sleep(0.1)")));
+
+  const auto options = shcore::make_dict();
+  options->set("threads", shcore::Value(2));
+
+  const auto results = _shell->parallel(jobs, options);
+  ASSERT_EQ(3, results->size());
+
+  // results are in order of the jobs
+  for (std::size_t i = 0; i < results->size(); ++i) {
+    EXPECT_EQ(i, results->at(i).as_map()->get_uint("index"));
+  }
+
+  {
+    const auto result = results->at(0).as_map();
+    EXPECT_TRUE(result->is_null("error"));
+    const auto stmts = result->get_array("results");
+    ASSERT_EQ(2, stmts->size());
+    EXPECT_EQ(1, stmts->at(0).as_map()->get_array("rows")->size());
+
+    const auto second = stmts->at(1).as_map();
+    const auto columns = second->get_array("columns");
+    ASSERT_EQ(2, columns->size());
+    EXPECT_EQ("2", columns->at(0).get_string());
+    EXPECT_EQ("3", columns->at(1).get_string());
+
+    const auto rows = second->get_array("rows");
+    ASSERT_EQ(1, rows->size());
+    EXPECT_EQ(2, rows->at(0).as_array()->at(0).as_int());
+    EXPECT_EQ(3, rows->at(0).as_array()->at(1).as_int());
+  }
+
+  {
+    const auto result = results->at(1).as_map();
+    EXPECT_NE(std::string::npos,
+              result->get_string("error").find("MySQL Error 1146"));
+    EXPECT_TRUE(result->get_array("results")->empty());
+  }
+
+  EXPECT_TRUE(results->at(2).as_map()->is_null("error"));
+
+  // invalid jobs
+  const auto invalid = shcore::make_array();
+  invalid->emplace_back(job(_mysql_uri, shcore::Value(1)));
+  EXPECT_THROW(_shell->parallel(invalid, {}), shcore::Exception);
+
+  options->set("threads", shcore::Value(0));
+  EXPECT_THROW(_shell->parallel(jobs, options), shcore::Exception);
+}
+
+TEST_F(mod_shell_test, parallel_cancel) {
+  const auto job = [this](const std::string &sql) {
+    const auto dict = shcore::make_dict();
+    dict->set("connection", shcore::Value(_mysql_uri));
+    dict->set("sql", shcore::Value(sql));
+    return shcore::Value(dict);
+  };
+
+  const auto jobs = shcore::make_array();
+  jobs->emplace_back(job("select 1"));
+  jobs->emplace_back(job("select sleep(10)"));
+  jobs->emplace_back(job("select 2"));
+
+  int reported = 0;
+  const auto callback = shcore::Cpp_function::create(
+      "callback",
+      [&reported](const shcore::Argument_list &) {
+        // ^C once the first job is finished, the second one is still running
+        ++reported;
+        shcore::Interrupts::interrupt();
+        return shcore::Value();
+      },
+      {{"result", shcore::Map}});
+
+  const auto options = shcore::make_dict();
+  options->set("threads", shcore::Value(2));
+  options->set("callback", shcore::Value(callback));
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_THROW(_shell->parallel(jobs, options), shcore::cancelled);
+
+  // running statement is killed, workers do not wait for it to finish
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  EXPECT_EQ(1, reported);
+
+  const auto session = mysqlshdk::db::mysql::Session::create();
+  session->connect(shcore::get_connection_options(_mysql_uri));
+  EXPECT_EQ(0, session
+                   ->query("select count(*) from information_schema.processlist "
+                           "where info = 'select sleep(10)'")
+                   ->fetch_one()
+                   ->get_uint(0));
+  session->close();
+}
+
 }  // namespace testing
@@ -21,13 +21,20 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <atomic>
+#include <thread>
+
 #include "modules/util/mod_util.h"
 #include "modules/util/upgrade_check.h"
+#include "mysqlshdk/include/scripting/shexcept.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/replay/setup.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 #include "unittest/test_utils.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
 
 using Version = mysqlshdk::utils::Version;
 
@@ -599,6 +606,254 @@ TEST_F(MySQL_upgrade_check_test, groupby_asc_desc_syntax) {
   EXPECT_TRUE(shcore::str_beginswith(issues[5].description, "EVENT"));
 }
 
+TEST(Upgrade_check_query_cache, shared_definitions) {
+  auto mock_session = std::make_shared<testing::Mock_session>();
+  const std::vector<std::string> names = {"schema", "name", "column", "type",
+                                          "definition"};
+  const std::vector<mysqlshdk::db::Type> types(5, mysqlshdk::db::Type::String);
+
+  // each of the definitions is fetched once, even though it's used by both
+  // checks
+  mock_session
+      ->expect_query(
+          "select table_schema, table_name, '', 'VIEW', "
+          "UPPER(view_definition) from information_schema.views")
+      .then_return({{"",
+                     names,
+                     types,
+                     {{"db", "v", "", "VIEW",
+                       "SELECT TOUCHES(A, B) FROM T GROUP BY A DESC"}}}});
+  mock_session
+      ->expect_query(
+          "select routine_schema, routine_name, '', routine_type, "
+          "UPPER(routine_definition) from information_schema.routines")
+      .then_return({{"", names, types, {}}});
+  mock_session
+      ->expect_query(
+          "select TABLE_SCHEMA,TABLE_NAME,COLUMN_NAME, 'COLUMN', "
+          "UPPER(GENERATION_EXPRESSION) from information_schema.columns where "
+          "extra regexp 'generated';")
+      .then_return({{"", names, types, {}}});
+  mock_session
+      ->expect_query(
+          "select TRIGGER_SCHEMA, TRIGGER_NAME, '', 'TRIGGER', "
+          "UPPER(ACTION_STATEMENT) from information_schema.triggers")
+      .then_return({{"",
+                     names,
+                     types,
+                     {{"db", "t", "", "TRIGGER",
+                       "DELETE FROM T WHERE GLENGTH(A) > 0"}}}});
+  mock_session
+      ->expect_query(
+          "select event_schema, event_name, '', 'EVENT', "
+          "UPPER(EVENT_DEFINITION) from information_schema.events")
+      .then_return({{"", names, types, {}}});
+
+  std::vector<std::unique_ptr<Upgrade_check>> checklist;
+  checklist.emplace_back(Sql_upgrade_check::get_removed_functions_check());
+  checklist.emplace_back(Sql_upgrade_check::get_groupby_asc_syntax_check());
+
+  std::vector<std::vector<Upgrade_issue>> results;
+  run_upgrade_checks(
+      checklist, Upgrade_check_options{"5.7.25", "8.0.16", ""},
+      {mock_session},
+      [&results](Upgrade_check *, std::vector<Upgrade_issue> &&issues,
+                 std::exception_ptr error) {
+        EXPECT_FALSE(error);
+        results.emplace_back(std::move(issues));
+      });
+
+  ASSERT_EQ(2, results.size());
+
+  ASSERT_EQ(2, results[0].size());
+  EXPECT_EQ("v", results[0][0].table);
+  EXPECT_NE(std::string::npos, results[0][0].description.find("ST_TOUCHES"));
+  EXPECT_EQ("t", results[0][1].table);
+  EXPECT_NE(std::string::npos, results[0][1].description.find("ST_LENGTH"));
+
+  ASSERT_EQ(1, results[1].size());
+  EXPECT_EQ("v", results[1][0].table);
+  EXPECT_EQ("VIEW uses removed GROUP BY DESC syntax",
+            results[1][0].description);
+}
+
+TEST(Upgrade_check_query_cache, release) {
+  auto mock_session = std::make_shared<testing::Mock_session>();
+  const std::string query = "select 1";
+
+  mock_session->expect_query(query).then_return(
+      {{query, {"1"}, {mysqlshdk::db::Type::Integer}, {{"1"}}}});
+
+  Upgrade_check_query_cache cache;
+  for (int i = 0; i < 3; ++i) cache.add_consumer({query});
+  ASSERT_TRUE(cache.is_shared(query));
+
+  // consumer which has failed before reaching the query
+  cache.release(query);
+
+  // query is executed once
+  EXPECT_EQ(1, cache.fetch(query, mock_session.get())->size());
+  EXPECT_TRUE(cache.is_shared(query));
+  EXPECT_EQ(1, cache.fetch(query, mock_session.get())->size());
+
+  // rows are released by the last consumer
+  EXPECT_FALSE(cache.is_shared(query));
+}
+
+namespace {
+
+class Test_upgrade_check : public Upgrade_check {
+ public:
+  Test_upgrade_check(const char *name, const std::function<void()> &action)
+      : Upgrade_check(name), m_action(action) {}
+
+  Upgrade_issue::Level get_level() const override {
+    return Upgrade_issue::WARNING;
+  }
+
+  std::vector<Upgrade_issue> run(std::shared_ptr<mysqlshdk::db::ISession>,
+                                 const Upgrade_check_options &) override {
+    m_action();
+    return {};
+  }
+
+ private:
+  std::function<void()> m_action;
+};
+
+}  // namespace
+
+TEST(Upgrade_check_concurrency, failed_check) {
+  std::vector<std::unique_ptr<Upgrade_check>> checklist;
+  checklist.emplace_back(new Test_upgrade_check(
+      "fails", []() { throw std::runtime_error("check failed"); }));
+  checklist.emplace_back(new Test_upgrade_check("succeeds", []() {}));
+
+  std::vector<std::string> output;
+  run_upgrade_checks(checklist, Upgrade_check_options{"5.7.25", "8.0.16", ""},
+                     {std::make_shared<testing::Mock_session>(),
+                      std::make_shared<testing::Mock_session>()},
+                     [&output](Upgrade_check *check,
+                               std::vector<Upgrade_issue> &&,
+                               std::exception_ptr error) {
+                       output.emplace_back(check->get_name());
+                       if (error) output.emplace_back("error");
+                     });
+
+  EXPECT_EQ((std::vector<std::string>{"fails", "error", "succeeds"}), output);
+}
+
+TEST(Upgrade_check_concurrency, replay) {
+  namespace replay = mysqlshdk::db::replay;
+
+  const auto caller = std::this_thread::get_id();
+  std::vector<std::thread::id> threads;
+  std::vector<std::unique_ptr<Upgrade_check>> checklist;
+
+  for (const auto name : {"first", "second", "third"}) {
+    checklist.emplace_back(new Test_upgrade_check(
+        name, [&threads]() { threads.push_back(std::this_thread::get_id()); }));
+  }
+
+  const auto old_mode = replay::g_replay_mode;
+  replay::set_mode(replay::Mode::Replay, 0);
+  shcore::on_leave_scope restore_mode(
+      [old_mode]() { replay::set_mode(old_mode, 0); });
+
+  // sessions are recorded in the order in which they are used, so checks are
+  // executed one by one in the calling thread
+  std::vector<std::string> output;
+  run_upgrade_checks(checklist, Upgrade_check_options{"5.7.25", "8.0.16", ""},
+                     {std::make_shared<testing::Mock_session>(),
+                      std::make_shared<testing::Mock_session>()},
+                     [&output](Upgrade_check *check,
+                               std::vector<Upgrade_issue> &&,
+                               std::exception_ptr error) {
+                       output.emplace_back(check->get_name());
+                       if (error) output.emplace_back("error");
+                     });
+
+  EXPECT_EQ((std::vector<std::string>{"first", "second", "third"}), output);
+  EXPECT_EQ(std::vector<std::thread::id>(3, caller), threads);
+}
+
+TEST(Upgrade_check_concurrency, interrupted) {
+  // queries are killed using a new session, nothing listens on this port
+  const mysqlshdk::db::Connection_options connection{"root@127.0.0.1:1"};
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions;
+
+  for (int i = 0; i < 2; ++i) {
+    auto session = std::make_shared<testing::NiceMock<testing::Mock_session>>();
+    ON_CALL(*session, get_connection_options())
+        .WillByDefault(testing::ReturnRef(connection));
+    sessions.emplace_back(std::move(session));
+  }
+
+  std::atomic<bool> interrupted{false};
+  std::vector<std::unique_ptr<Upgrade_check>> checklist;
+  checklist.emplace_back(new Test_upgrade_check("first", []() {}));
+  checklist.emplace_back(new Test_upgrade_check("second", [&interrupted]() {
+    for (int i = 0; i < 100 && !interrupted; ++i) shcore::sleep_ms(100);
+  }));
+  checklist.emplace_back(new Test_upgrade_check("third", []() {}));
+
+  std::vector<std::string> output;
+  EXPECT_THROW(
+      run_upgrade_checks(checklist,
+                         Upgrade_check_options{"5.7.25", "8.0.16", ""},
+                         sessions,
+                         [&output, &interrupted](Upgrade_check *check,
+                                                 std::vector<Upgrade_issue> &&,
+                                                 std::exception_ptr) {
+                           output.emplace_back(check->get_name());
+                           // ^C while the second check is running
+                           shcore::Interrupts::interrupt();
+                           interrupted = true;
+                         }),
+      shcore::cancelled);
+
+  EXPECT_EQ(std::vector<std::string>{"first"}, output);
+}
+
+TEST_F(MySQL_upgrade_check_test, concurrent_checks) {
+  if (_target_server_version < Version(5, 7, 0) ||
+      _target_server_version >= Version(8, 0, 0))
+    SKIP_TEST("This test requires running against MySQL server version 5.7");
+
+  auto checklist = Upgrade_check::create_checklist(
+      _target_server_version.get_base(), MYSH_VERSION);
+
+  const auto run = [&checklist, this](std::size_t sessions_count) {
+    std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions{session};
+
+    while (sessions.size() < sessions_count) {
+      auto s = mysqlshdk::db::mysql::Session::create();
+      s->connect(shcore::get_connection_options(_mysql_uri));
+      sessions.emplace_back(std::move(s));
+    }
+
+    std::vector<std::string> output;
+    run_upgrade_checks(checklist, opts, sessions,
+                       [&output](Upgrade_check *check,
+                                 std::vector<Upgrade_issue> &&issues,
+                                 std::exception_ptr error) {
+                         output.emplace_back(check->get_name());
+                         if (error) output.emplace_back("error");
+                         for (const auto &issue : issues)
+                           output.emplace_back(to_string(issue));
+                       });
+
+    for (std::size_t i = 1; i < sessions.size(); ++i) sessions[i]->close();
+
+    return output;
+  };
+
+  // results are reported in the same order, regardless of number of sessions
+  const auto sequential = run(1);
+  EXPECT_FALSE(sequential.empty());
+  EXPECT_EQ(sequential, run(3));
+}
+
 TEST_F(MySQL_upgrade_check_test, removed_sys_log_vars) {
   if (_target_server_version < Version(5, 7, 0) ||
       _target_server_version >= Version(8, 0, 13))
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/mysql-secret-store-fake/fake_helper.h"
+
+#ifdef _WIN32
+#include <process.h>
+#else  // ! _WIN32
+#include <unistd.h>
+#endif  // ! _WIN32
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "mysql-secret-store/core/program.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysql {
+namespace secret_store {
+
+namespace client {
+
+std::unique_ptr<common::Helper> get_helper();
+
+}  // namespace client
+
+namespace fake {
+
+namespace {
+
+constexpr auto k_serve_command = "serve";
+
+bool g_serving = false;
+
+int get_process_id() {
+#ifdef _WIN32
+  return _getpid();
+#else   // ! _WIN32
+  return getpid();
+#endif  // ! _WIN32
+}
+
+}  // namespace
+
+Fake_helper::Fake_helper() : Plaintext_helper("fake") {}
+
+void Fake_helper::store(const common::Secret &secret) {
+  log("store");
+  Plaintext_helper::store(secret);
+}
+
+void Fake_helper::get(const common::Secret_id &id, std::string *secret) {
+  log("get");
+  Plaintext_helper::get(id, secret);
+}
+
+void Fake_helper::erase(const common::Secret_id &id) {
+  log("erase");
+  Plaintext_helper::erase(id);
+}
+
+void Fake_helper::list(std::vector<common::Secret_id> *secrets) {
+  log("list");
+  Plaintext_helper::list(secrets);
+}
+
+void Fake_helper::log(const std::string &operation) {
+  const auto limit = getenv("MYSQLSH_FAKE_HELPER_SERVE_LIMIT");
+
+  if (g_serving && nullptr != limit && ++m_operations > atoi(limit)) {
+    // simulate a crash, request is left without a response
+    std::_Exit(1);
+  }
+
+  std::ofstream log_file{
+      shcore::path::join_path(shcore::get_user_config_path(), ".fake.log"),
+      std::ios::app};
+  log_file << get_process_id() << ' ' << operation << std::endl;
+}
+
+}  // namespace fake
+}  // namespace secret_store
+}  // namespace mysql
+
+// replaces main() of the mysql-secret-store-core library, the "serve" command
+// needs to be recognized before it's handled by the program
+int main(int argc, char *argv[]) {
+  using mysql::secret_store::client::get_helper;
+  using mysql::secret_store::core::Program;
+  using mysql::secret_store::fake::g_serving;
+  using mysql::secret_store::fake::k_serve_command;
+
+  g_serving = argc > 1 && 0 == strcmp(k_serve_command, argv[1]);
+
+  if (g_serving && nullptr != getenv("MYSQLSH_FAKE_HELPER_NO_SERVE")) {
+    std::cerr << "Unknown command: '" << k_serve_command << "'" << std::endl;
+    return 1;
+  }
+
+  return Program(get_helper()).run(argc, argv);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef UNITTEST_MYSQL_SECRET_STORE_FAKE_FAKE_HELPER_H_
+#define UNITTEST_MYSQL_SECRET_STORE_FAKE_FAKE_HELPER_H_
+
+#include <string>
+#include <vector>
+
+#include "unittest/mysql-secret-store-plaintext/plaintext_helper.h"
+
+namespace mysql {
+namespace secret_store {
+namespace fake {
+
+/**
+ * Plaintext helper which logs each operation, used to test how the shell
+ * talks to the helpers.
+ *
+ * Each operation appends "<process ID> <operation>" line to the
+ * ".fake.log" file in the user config path. Behaviour can be changed using
+ * environment variables:
+ *  - MYSQLSH_FAKE_HELPER_NO_SERVE - "serve" command is rejected, like it is
+ *    done by helpers which do not support it,
+ *  - MYSQLSH_FAKE_HELPER_SERVE_LIMIT - when serving, process exits without
+ *    responding once it's asked to execute more operations than specified.
+ */
+class Fake_helper : public plaintext::Plaintext_helper {
+ public:
+  Fake_helper();
+
+  void store(const common::Secret &) override;
+
+  void get(const common::Secret_id &, std::string *) override;
+
+  void erase(const common::Secret_id &) override;
+
+  void list(std::vector<common::Secret_id> *) override;
+
+ private:
+  void log(const std::string &operation);
+
+  int m_operations = 0;
+};
+
+}  // namespace fake
+}  // namespace secret_store
+}  // namespace mysql
+
+#endif  // UNITTEST_MYSQL_SECRET_STORE_FAKE_FAKE_HELPER_H_
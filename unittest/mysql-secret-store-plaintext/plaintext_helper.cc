@@ -125,9 +125,10 @@ std::vector<common::Secret>::iterator find_secret(
 
 }  // namespace
 
-Plaintext_helper::Plaintext_helper()
-    : common::Helper("plaintext", shcore::get_long_version(),
-                     MYSH_HELPER_COPYRIGHT) {}
+Plaintext_helper::Plaintext_helper() : Plaintext_helper("plaintext") {}
+
+Plaintext_helper::Plaintext_helper(const std::string &name)
+    : common::Helper(name, shcore::get_long_version(), MYSH_HELPER_COPYRIGHT) {}
 
 void Plaintext_helper::check_requirements() {}
 
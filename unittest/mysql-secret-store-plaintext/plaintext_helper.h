@@ -47,6 +47,9 @@ class Plaintext_helper : public common::Helper {
 
   void list(std::vector<common::Secret_id> *) override;
 
+ protected:
+  explicit Plaintext_helper(const std::string &name);
+
  private:
   std::string get_file_name() const;
 };
@@ -24,10 +24,12 @@
 #include <rapidjson/document.h>
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
@@ -42,6 +44,7 @@
 
 using mysql::secret_store::api::Helper_interface;
 using mysql::secret_store::api::Helper_name;
+using mysql::secret_store::api::Helper_options;
 using mysql::secret_store::api::Secret_spec;
 using mysql::secret_store::api::Secret_type;
 using mysql::secret_store::api::get_available_helpers;
@@ -119,13 +122,7 @@ class Mysql_secret_store_api_tester : public Helper_tester {
   void select_helper(const std::string &name) override {
     SCOPED_TRACE("Mysql_secret_store_api_tester::select_helper()");
 
-    auto helpers = get_available_helpers();
-    auto helper =
-        std::find_if(helpers.begin(), helpers.end(),
-                     [&name](const Helper_name &n) { return n.get() == name; });
-    ASSERT_NE(helpers.end(), helper);
-    m_helper = get_helper(*helper);
-    ASSERT_NE(nullptr, m_helper);
+    select_helper(name, {});
   }
 
   void clear_store() override {
@@ -192,10 +189,33 @@ class Mysql_secret_store_api_tester : public Helper_tester {
 
   std::string name() const { return m_helper->name().get(); }
 
+ protected:
+  void select_helper(const std::string &name, const Helper_options &options) {
+    auto helpers = get_available_helpers();
+    auto helper =
+        std::find_if(helpers.begin(), helpers.end(),
+                     [&name](const Helper_name &n) { return n.get() == name; });
+    ASSERT_NE(helpers.end(), helper);
+    m_helper = get_helper(*helper, options);
+    ASSERT_NE(nullptr, m_helper);
+  }
+
  private:
   std::unique_ptr<Helper_interface> m_helper;
 };
 
+class Mysql_secret_store_persistent_api_tester
+    : public Mysql_secret_store_api_tester {
+ public:
+  void select_helper(const std::string &name) override {
+    SCOPED_TRACE("Mysql_secret_store_persistent_api_tester::select_helper()");
+
+    Helper_options options;
+    options.persistent = true;
+    Mysql_secret_store_api_tester::select_helper(name, options);
+  }
+};
+
 class Shell_api_tester : public Helper_tester {
  public:
   Shell_api_tester() {}
@@ -1279,6 +1299,267 @@ REGISTER_TESTS(Mysql_secret_store_api_test);
 #define VALIDATION_TEST TEST_P
 #define NORMALIZATION_TEST TEST_P
 
+class Mysql_secret_store_persistent_api_test
+    : public Parametrized_helper_test<
+          Mysql_secret_store_persistent_api_tester> {};
+
+ADD_TESTS(Mysql_secret_store_persistent_api_test);
+
+#undef VALIDATION_TEST
+#undef NORMALIZATION_TEST
+
+REGISTER_TESTS(Mysql_secret_store_persistent_api_test);
+
+#ifdef _WIN32
+#define unsetenv(var) _putenv(var "=")
+#endif
+
+class Fake_helper_test : public ::testing::Test {
+ protected:
+  using Log = std::vector<std::pair<std::string, std::string>>;
+
+  void SetUp() override {
+    m_log_file =
+        shcore::path::join_path(shcore::get_user_config_path(), ".fake.log");
+    shcore::delete_file(m_log_file);
+  }
+
+  void TearDown() override {
+    unsetenv("MYSQLSH_FAKE_HELPER_NO_SERVE");
+    unsetenv("MYSQLSH_FAKE_HELPER_SERVE_LIMIT");
+    shcore::delete_file(m_log_file);
+  }
+
+  static std::unique_ptr<Helper_interface> get_fake_helper(
+      const Helper_options &options = {}) {
+    for (const auto &name : get_available_helpers()) {
+      if (name.get() == "fake") {
+        return get_helper(name, options);
+      }
+    }
+
+    return nullptr;
+  }
+
+  /**
+   * Provides the operations executed by the fake helper, as pairs of process
+   * ID and name of the operation.
+   */
+  Log read_log() const {
+    Log log;
+
+    if (shcore::file_exists(m_log_file)) {
+      for (const auto &line :
+           shcore::split_string(shcore::get_text_file(m_log_file), "\n")) {
+        const auto space = line.find(' ');
+
+        if (std::string::npos != space) {
+          log.emplace_back(line.substr(0, space), line.substr(space + 1));
+        }
+      }
+    }
+
+    return log;
+  }
+
+  static std::set<std::string> processes(const Log &log) {
+    std::set<std::string> pids;
+
+    for (const auto &entry : log) {
+      pids.emplace(entry.first);
+    }
+
+    return pids;
+  }
+
+  static void execute_operations(Helper_interface *helper) {
+    SCOPED_TRACE("Fake_helper_test::execute_operations()");
+
+    const Secret_spec spec{Secret_type::PASSWORD, "user@fake_test:3306"};
+    std::string secret;
+    std::vector<Secret_spec> specs;
+
+    ASSERT_TRUE(helper->store(spec, "one")) << helper->get_last_error();
+    ASSERT_TRUE(helper->get(spec, &secret)) << helper->get_last_error();
+    EXPECT_EQ("one", secret);
+    ASSERT_TRUE(helper->list(&specs)) << helper->get_last_error();
+    ASSERT_EQ(1, specs.size());
+    EXPECT_EQ(spec.url, specs[0].url);
+    ASSERT_TRUE(helper->erase(spec)) << helper->get_last_error();
+  }
+
+  std::string m_log_file;
+};
+
+TEST_F(Fake_helper_test, one_shot) {
+  const auto helper = get_fake_helper();
+
+  if (!helper) {
+    SKIP_TEST("Fake helper is not available");
+  }
+
+  execute_operations(helper.get());
+
+  const auto log = read_log();
+  ASSERT_EQ(4, log.size());
+  EXPECT_EQ("store", log[0].second);
+  EXPECT_EQ("get", log[1].second);
+  EXPECT_EQ("list", log[2].second);
+  EXPECT_EQ("erase", log[3].second);
+  // each operation is executed by a new process
+  EXPECT_EQ(4, processes(log).size());
+}
+
+TEST_F(Fake_helper_test, persistent) {
+  Helper_options options;
+  options.persistent = true;
+  const auto helper = get_fake_helper(options);
+
+  if (!helper) {
+    SKIP_TEST("Fake helper is not available");
+  }
+
+  execute_operations(helper.get());
+
+  const auto log = read_log();
+  ASSERT_EQ(4, log.size());
+  EXPECT_EQ("store", log[0].second);
+  EXPECT_EQ("get", log[1].second);
+  EXPECT_EQ("list", log[2].second);
+  EXPECT_EQ("erase", log[3].second);
+  // all operations are executed by the same process
+  EXPECT_EQ(1, processes(log).size());
+}
+
+TEST_F(Fake_helper_test, persistent_not_supported) {
+  putenv(const_cast<char *>("MYSQLSH_FAKE_HELPER_NO_SERVE=1"));
+
+  Helper_options options;
+  options.persistent = true;
+  const auto helper = get_fake_helper(options);
+
+  if (!helper) {
+    SKIP_TEST("Fake helper is not available");
+  }
+
+  // helper rejects the "serve" command, operations fall back to one-shot
+  // processes
+  execute_operations(helper.get());
+
+  const auto log = read_log();
+  ASSERT_EQ(4, log.size());
+  EXPECT_EQ("store", log[0].second);
+  EXPECT_EQ("get", log[1].second);
+  EXPECT_EQ("list", log[2].second);
+  EXPECT_EQ("erase", log[3].second);
+  EXPECT_EQ(4, processes(log).size());
+}
+
+TEST_F(Fake_helper_test, persistent_restarted) {
+  // persistent helper exits when asked for the third operation
+  putenv(const_cast<char *>("MYSQLSH_FAKE_HELPER_SERVE_LIMIT=2"));
+
+  Helper_options options;
+  options.persistent = true;
+  const auto helper = get_fake_helper(options);
+
+  if (!helper) {
+    SKIP_TEST("Fake helper is not available");
+  }
+
+  const Secret_spec spec{Secret_type::PASSWORD, "user@fake_test:3306"};
+  std::string secret;
+
+  ASSERT_TRUE(helper->store(spec, "one")) << helper->get_last_error();
+
+  for (int i = 0; i < 3; ++i) {
+    SCOPED_TRACE("get #" + std::to_string(i));
+    secret.clear();
+    EXPECT_TRUE(helper->get(spec, &secret)) << helper->get_last_error();
+    EXPECT_EQ("one", secret);
+  }
+
+  EXPECT_TRUE(helper->erase(spec)) << helper->get_last_error();
+
+  const auto log = read_log();
+  ASSERT_EQ(5, log.size());
+  // first server handles two operations
+  EXPECT_EQ(log[0].first, log[1].first);
+  // request which was left without a response is repeated by a new process
+  EXPECT_EQ("get", log[2].second);
+  EXPECT_NE(log[1].first, log[2].first);
+  // server is restarted by the next request
+  EXPECT_EQ("get", log[3].second);
+  EXPECT_EQ("erase", log[4].second);
+  EXPECT_EQ(log[3].first, log[4].first);
+  EXPECT_EQ(3, processes(log).size());
+}
+
+TEST_F(Fake_helper_test, cache) {
+  Helper_options options;
+  options.cache_ttl = std::chrono::seconds(60);
+  auto cached = get_fake_helper(options);
+  const auto direct = get_fake_helper();
+
+  if (!cached || !direct) {
+    SKIP_TEST("Fake helper is not available");
+  }
+
+  const Secret_spec spec{Secret_type::PASSWORD, "user@cache_test:3306"};
+  std::string secret;
+  const auto gets = [this]() {
+    const auto log = read_log();
+    return std::count_if(log.begin(), log.end(),
+                         [](const Log::value_type &entry) {
+                           return entry.second == "get";
+                         });
+  };
+
+  ASSERT_TRUE(direct->store(spec, "one"));
+  EXPECT_TRUE(cached->get(spec, &secret));
+  EXPECT_EQ("one", secret);
+  EXPECT_EQ(1, gets());
+
+  // secret is served from the cache
+  ASSERT_TRUE(direct->store(spec, "two"));
+  EXPECT_TRUE(cached->get(spec, &secret));
+  EXPECT_EQ("one", secret);
+  EXPECT_EQ(1, gets());
+
+  // storing updates the cache
+  EXPECT_TRUE(cached->store(spec, "three"));
+  EXPECT_TRUE(cached->get(spec, &secret));
+  EXPECT_EQ("three", secret);
+  EXPECT_EQ(1, gets());
+  EXPECT_TRUE(direct->get(spec, &secret));
+  EXPECT_EQ("three", secret);
+  EXPECT_EQ(2, gets());
+
+  // erasing removes the cached secret
+  EXPECT_TRUE(cached->erase(spec));
+  EXPECT_FALSE(cached->get(spec, &secret));
+  EXPECT_EQ(3, gets());
+
+  // entries expire
+  options.cache_ttl = std::chrono::milliseconds(1);
+  cached = get_fake_helper(options);
+
+  ASSERT_TRUE(direct->store(spec, "four"));
+  EXPECT_TRUE(cached->get(spec, &secret));
+  EXPECT_EQ("four", secret);
+
+  ASSERT_TRUE(direct->store(spec, "five"));
+  shcore::sleep_ms(10);
+  EXPECT_TRUE(cached->get(spec, &secret));
+  EXPECT_EQ("five", secret);
+  EXPECT_EQ(5, gets());
+
+  EXPECT_TRUE(direct->erase(spec));
+}
+
+#define VALIDATION_TEST TEST_P
+#define NORMALIZATION_TEST TEST_P
+
 class Shell_api_test : public Parametrized_helper_test<Shell_api_tester> {};
 
 ADD_TESTS(Shell_api_test);
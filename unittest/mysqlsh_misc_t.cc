@@ -61,6 +61,27 @@ TEST_F(Mysqlsh_misc, trace_proto) {
   MY_EXPECT_CMD_OUTPUT_CONTAINS(expected3);
 }
 
+TEST_F(Mysqlsh_misc, debug_startup) {
+  execute({_mysqlsh, "--debug-startup", _mysql_uri.c_str(), "--sql", "-e",
+           "select 1", nullptr});
+
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("Startup profile:");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("process options\n");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("create shell\n");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("init shell\n");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("connect\n");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("execute\n");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("total\n");
+  // global objects are not created in SQL mode
+  MY_EXPECT_CMD_OUTPUT_NOT_CONTAINS(" dba\n");
+  MY_EXPECT_CMD_OUTPUT_NOT_CONTAINS(" util\n");
+  wipe_out();
+
+  // report is printed only when requested
+  execute({_mysqlsh, _mysql_uri.c_str(), "--sql", "-e", "select 1", nullptr});
+  MY_EXPECT_CMD_OUTPUT_NOT_CONTAINS("Startup profile:");
+}
+
 TEST_F(Mysqlsh_misc, load_builtin_modules) {
 // Regression test for Bug #26174373
 // Built-in modules should auto-load in non-interactive sessions too
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gtest_clean.h"
+#include "unittest/mysqlshdk/libs/db/db_common.h"
+
+#include "mysqlshdk/libs/db/mutable_result.h"
+#include "mysqlshdk/libs/db/prefetching_result.h"
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+std::shared_ptr<Mutable_result> make_result(int rows) {
+  auto result = std::make_shared<Mutable_result>(
+      std::vector<Type>{Type::Integer, Type::String});
+
+  for (int i = 0; i < rows; ++i)
+    result->append(static_cast<int64_t>(i), std::to_string(i));
+
+  return result;
+}
+
+class Failing_result : public Mutable_result {
+ public:
+  Failing_result(const std::vector<Type> &types, int fail_after)
+      : Mutable_result(types), m_fail_after(fail_after) {}
+
+  const IRow *fetch_one() override {
+    if (m_fetched++ == m_fail_after) throw std::runtime_error("read failed");
+    return Mutable_result::fetch_one();
+  }
+
+ private:
+  int m_fail_after;
+  int m_fetched = 0;
+};
+
+}  // namespace
+
+TEST(Prefetching_result, fetch_all) {
+  for (const size_t capacity : {1, 2, 7, 1000}) {
+    SCOPED_TRACE("capacity: " + std::to_string(capacity));
+
+    Prefetching_result result(make_result(100), capacity);
+    EXPECT_TRUE(result.has_resultset());
+    EXPECT_EQ(2, result.get_metadata().size());
+
+    for (int i = 0; i < 100; ++i) {
+      const auto row = result.fetch_one();
+      ASSERT_NE(nullptr, row);
+      EXPECT_EQ(i, row->get_int(0));
+      EXPECT_EQ(std::to_string(i), row->get_string(1));
+    }
+
+    EXPECT_EQ(nullptr, result.fetch_one());
+    EXPECT_EQ(nullptr, result.fetch_one());
+    EXPECT_EQ(100, result.get_fetched_row_count());
+    EXPECT_FALSE(result.is_reading());
+  }
+
+  {
+    Prefetching_result result(make_result(0), 10);
+    EXPECT_EQ(nullptr, result.fetch_one());
+    EXPECT_EQ(0, result.get_fetched_row_count());
+  }
+}
+
+TEST(Prefetching_result, stop) {
+  // session stops the reader before the connection is used, rows which were
+  // read ahead and the remaining ones are still returned
+  const auto source = make_result(50);
+  Prefetching_result result(source, 5);
+
+  for (int i = 0; i < 10; ++i) ASSERT_EQ(i, result.fetch_one()->get_int(0));
+
+  source->stop_background_reader();
+  EXPECT_FALSE(result.is_reading());
+
+  for (int i = 10; i < 50; ++i) {
+    const auto row = result.fetch_one();
+    ASSERT_NE(nullptr, row);
+    EXPECT_EQ(i, row->get_int(0));
+  }
+
+  EXPECT_EQ(nullptr, result.fetch_one());
+
+  // other information about the result also stops the reader
+  Prefetching_result other(make_result(50), 5);
+  EXPECT_EQ(0, other.fetch_one()->get_int(0));
+  EXPECT_EQ(50, other.get_affected_row_count());
+  EXPECT_FALSE(other.is_reading());
+  EXPECT_EQ(1, other.fetch_one()->get_int(0));
+  EXPECT_EQ(2, other.get_fetched_row_count());
+}
+
+TEST(Prefetching_result, buffer) {
+  Prefetching_result result(make_result(20), 3);
+
+  for (int i = 0; i < 5; ++i) ASSERT_EQ(i, result.fetch_one()->get_int(0));
+
+  result.buffer();
+  EXPECT_FALSE(result.is_reading());
+
+  for (int pass = 0; pass < 2; ++pass) {
+    SCOPED_TRACE("pass: " + std::to_string(pass));
+
+    for (int i = 5; i < 20; ++i) {
+      const auto row = result.fetch_one();
+      ASSERT_NE(nullptr, row);
+      EXPECT_EQ(i, row->get_int(0));
+    }
+
+    EXPECT_EQ(nullptr, result.fetch_one());
+    EXPECT_EQ(15, result.get_fetched_row_count());
+
+    result.rewind();
+  }
+}
+
+TEST(Prefetching_result, error) {
+  const auto source = std::make_shared<Failing_result>(
+      std::vector<Type>{Type::Integer}, 3);
+
+  for (int i = 0; i < 10; ++i) source->append(static_cast<int64_t>(i));
+
+  Prefetching_result result(source, 2);
+
+  for (int i = 0; i < 3; ++i) ASSERT_EQ(i, result.fetch_one()->get_int(0));
+
+  EXPECT_THROW(result.fetch_one(), std::runtime_error);
+  EXPECT_EQ(nullptr, result.fetch_one());
+}
+
+TEST(Prefetching_result, destroy_while_reading) {
+  // rows are not consumed, thread is blocked on a full queue
+  for (int i = 0; i < 10; ++i) {
+    const auto source = make_result(1000);
+    { Prefetching_result result(source, 4); }
+    // background reader is no longer registered
+    source->stop_background_reader();
+  }
+}
+
+class Prefetching_result_session : public Db_tests {};
+
+TEST_F(Prefetching_result_session, query_while_reading) {
+  do {
+    SCOPED_TRACE(is_classic ? "mysql" : "mysqlx");
+    ASSERT_NO_THROW(session->connect(Connection_options(uri())));
+
+    static constexpr char k_query[] =
+        "SELECT a.n * 10 + b.n FROM "
+        "(SELECT 0 n UNION SELECT 1 UNION SELECT 2 UNION SELECT 3 UNION "
+        "SELECT 4 UNION SELECT 5 UNION SELECT 6 UNION SELECT 7 UNION "
+        "SELECT 8 UNION SELECT 9) a, "
+        "(SELECT 0 n UNION SELECT 1 UNION SELECT 2 UNION SELECT 3 UNION "
+        "SELECT 4 UNION SELECT 5 UNION SELECT 6 UNION SELECT 7 UNION "
+        "SELECT 8 UNION SELECT 9) b ORDER BY 1";
+
+    {
+      Prefetching_result result(session->query(k_query, false), 8);
+      int64_t expected = 0;
+
+      while (const auto row = result.fetch_one())
+        EXPECT_EQ(expected++, row->get_int(0));
+
+      EXPECT_EQ(100, expected);
+    }
+
+    {
+      Prefetching_result result(session->query(k_query, false), 8);
+      int64_t expected = 0;
+
+      for (; expected < 10; ++expected)
+        ASSERT_EQ(expected, result.fetch_one()->get_int(0));
+
+      // session stops the background reader before sending the query
+      auto other = session->query("SELECT 'other'");
+      EXPECT_EQ("other", other->fetch_one()->get_string(0));
+      EXPECT_FALSE(result.is_reading());
+
+      // rows which were not discarded by the session are returned in order
+      while (const auto row = result.fetch_one())
+        EXPECT_EQ(expected++, row->get_int(0));
+
+      EXPECT_GE(100, expected);
+    }
+
+    session->close();
+  } while (switch_proto());
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
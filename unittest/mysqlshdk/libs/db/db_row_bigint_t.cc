@@ -19,6 +19,10 @@
  along with this program; if not, write to the Free Software Foundation, Inc.,
  51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
 
+#include <limits>
+#include <string>
+
+#include "mysqlshdk/libs/db/mysql/row.h"
 #include "unittest/mysqlshdk/libs/db/db_common.h"
 
 namespace mysqlshdk {
@@ -68,5 +72,86 @@ TEST_F(Db_tests, row_getters_bigint) {
   } while (switch_proto());
 }
 
+TEST_F(Db_tests, row_getters_bigint_limits) {
+  // values are parsed from the text protocol, classic only
+  ASSERT_NO_THROW(session->connect(Connection_options(uri())));
+
+  auto result = session->query(
+      "select -9223372036854775808, 9223372036854775807, "
+      "18446744073709551615, 9223372036854775808, -9223372036854775809, "
+      "18446744073709551616, -1, cast(-1 as decimal), 0");
+  auto row = result->fetch_one();
+  ASSERT_TRUE(row);
+
+  EXPECT_EQ((std::numeric_limits<int64_t>::min)(), row->get_int(0));
+  EXPECT_THROW(row->get_uint(0), std::invalid_argument);
+  EXPECT_EQ((std::numeric_limits<int64_t>::max)(), row->get_int(1));
+  EXPECT_EQ(9223372036854775807ULL, row->get_uint(1));
+  EXPECT_EQ((std::numeric_limits<uint64_t>::max)(), row->get_uint(2));
+  EXPECT_THROW(row->get_int(2), std::invalid_argument);
+
+  // out of range by one
+  EXPECT_EQ(9223372036854775808ULL, row->get_uint(3));
+  EXPECT_THROW(row->get_int(3), std::invalid_argument);
+  EXPECT_THROW(row->get_int(4), std::invalid_argument);
+  EXPECT_THROW(row->get_uint(4), std::invalid_argument);
+  EXPECT_THROW(row->get_uint(5), std::invalid_argument);
+  EXPECT_THROW(row->get_int(5), std::invalid_argument);
+
+  // negative values cannot be read as unsigned
+  EXPECT_EQ(-1, row->get_int(6));
+  EXPECT_THROW(row->get_uint(6), std::invalid_argument);
+  EXPECT_EQ(-1, row->get_int(7));
+  EXPECT_THROW(row->get_uint(7), std::invalid_argument);
+
+  EXPECT_EQ(0, row->get_int(8));
+  EXPECT_EQ(0u, row->get_uint(8));
+
+  session->close();
+}
+
+TEST(Db_mysql_row, parse_digits) {
+  const auto parse = [](const std::string &s, uint64_t *out) {
+    return mysql::internal::parse_digits(s.data(), s.length(), out);
+  };
+  uint64_t value = 0;
+
+  EXPECT_TRUE(parse("0", &value));
+  EXPECT_EQ(0u, value);
+  EXPECT_TRUE(parse("9223372036854775808", &value));
+  EXPECT_EQ(9223372036854775808ULL, value);
+  EXPECT_TRUE(parse("9999999999999999999", &value));
+  EXPECT_EQ(9999999999999999999ULL, value);
+  EXPECT_TRUE(parse("18446744073709551615", &value));
+  EXPECT_EQ((std::numeric_limits<uint64_t>::max)(), value);
+  EXPECT_TRUE(parse("00000000000000000001", &value));
+  EXPECT_EQ(1u, value);
+
+  // value is not modified on failure
+  value = 42;
+
+  // overflow
+  EXPECT_FALSE(parse("18446744073709551616", &value));
+  EXPECT_FALSE(parse("18446744073709551620", &value));
+  EXPECT_FALSE(parse("99999999999999999999", &value));
+  EXPECT_FALSE(parse("100000000000000000000", &value));
+
+  // sign is handled by the caller
+  EXPECT_FALSE(parse("-1", &value));
+  EXPECT_FALSE(parse("+1", &value));
+  EXPECT_FALSE(parse("-9223372036854775808", &value));
+
+  // empty or non-digit input
+  EXPECT_FALSE(parse("", &value));
+  EXPECT_FALSE(parse("-", &value));
+  EXPECT_FALSE(parse(" 1", &value));
+  EXPECT_FALSE(parse("1 ", &value));
+  EXPECT_FALSE(parse("12a", &value));
+  EXPECT_FALSE(parse("1.5", &value));
+  EXPECT_FALSE(parse("1844674407370955161x", &value));
+
+  EXPECT_EQ(42u, value);
+}
+
 }  // namespace db
 }  // namespace mysqlshdk
@@ -19,9 +19,16 @@
  along with this program; if not, write to the Free Software Foundation, Inc.,
  51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
 
+#include "modules/mod_mysql_resultset.h"
+#include "modules/mod_mysql_session.h"
+#include "mysqlshdk/libs/db/mysql/async_query_loop.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/mysql/session_pool.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
+#include "mysqlshdk/libs/db/replay/setup.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "unittest/mysqlshdk/libs/db/db_common.h"
 #include "unittest/test_utils.h"
 
@@ -230,5 +237,581 @@ TEST_F(Db_tests, auto_close) {
   } while (switch_proto());
 }
 
+TEST_F(Db_tests, session_pool) {
+  auto pool = std::make_shared<mysqlshdk::db::mysql::Session_pool>();
+  const auto connection_options = shcore::get_connection_options(uri());
+  uint64_t id = 0;
+
+  {
+    auto pooled = pool->open_session(connection_options);
+    id = pooled->get_connection_id();
+    pooled->execute("set @pool_test = 1");
+    EXPECT_EQ(0, pool->idle_sessions());
+  }
+
+  // session was returned to the pool
+  EXPECT_EQ(1, pool->idle_sessions());
+
+  {
+    auto pooled = pool->open_session(connection_options);
+    EXPECT_EQ(0, pool->idle_sessions());
+
+    // same connection, but its state was reset
+    EXPECT_EQ(id, pooled->get_connection_id());
+    EXPECT_TRUE(pooled->query("select @pool_test")->fetch_one()->is_null(0));
+
+    // different credentials never share a session
+    auto other_options = connection_options;
+    other_options.clear_password();
+    other_options.set_password("fake_pwd");
+    EXPECT_THROW(pool->open_session(other_options), std::exception);
+
+    // closed sessions are not returned to the pool
+    pooled->close();
+  }
+
+  EXPECT_EQ(0, pool->idle_sessions());
+
+  {
+    auto pooled = pool->open_session(connection_options);
+    EXPECT_NE(id, pooled->get_connection_id());
+    id = pooled->get_connection_id();
+  }
+
+  // killed sessions are detected when they're reused
+  session->connect(connection_options);
+  session->execute("kill " + std::to_string(id));
+
+  {
+    auto pooled = pool->open_session(connection_options);
+    EXPECT_NE(id, pooled->get_connection_id());
+  }
+
+  // expired sessions are closed
+  EXPECT_EQ(1, pool->idle_sessions());
+  shcore::sleep_ms(10);
+  pool->set_idle_timeout(std::chrono::milliseconds(5));
+  EXPECT_EQ(0, pool->idle_sessions());
+
+  pool->set_idle_timeout(std::chrono::seconds(60));
+  { auto pooled = pool->open_session(connection_options); }
+  EXPECT_EQ(1, pool->idle_sessions());
+  pool->clear();
+  EXPECT_EQ(0, pool->idle_sessions());
+
+  session->close();
+}
+
+TEST_F(Db_tests, session_pool_record_replay) {
+  namespace replay = mysqlshdk::db::replay;
+
+  auto pool = std::make_shared<mysqlshdk::db::mysql::Session_pool>();
+  const auto connection_options = shcore::get_connection_options(uri());
+  const std::string old_prefix = replay::g_recording_path_prefix;
+  const auto old_mode = replay::g_replay_mode;
+  const auto tracedir =
+      shcore::path::join_path(getenv("TMPDIR"), "session_pool_traces");
+
+  shcore::ensure_dir_exists(tracedir);
+  replay::set_recording_path_prefix(tracedir + "/");
+
+  const auto run = [&](replay::Mode mode) {
+    replay::set_mode(mode, 0);
+    replay::begin_recording_context("session_pool");
+
+    std::vector<uint64_t> ids;
+
+    for (int i = 0; i < 3; ++i) {
+      auto pooled = pool->open_session(connection_options);
+      ids.push_back(
+          pooled->query("select connection_id()")->fetch_one()->get_uint(0));
+    }
+
+    // sessions are not pooled
+    EXPECT_EQ(0, pool->idle_sessions());
+
+    replay::end_recording_context();
+    return ids;
+  };
+
+  const auto recorded = run(replay::Mode::Record);
+  ASSERT_EQ(3, recorded.size());
+  EXPECT_NE(recorded[0], recorded[1]);
+  EXPECT_NE(recorded[1], recorded[2]);
+
+  // each session has its own trace
+  for (int i = 1; i <= 3; ++i) {
+    EXPECT_TRUE(shcore::is_file(shcore::path::join_path(
+        tracedir, "session_pool." + std::to_string(i) + ".mysql_trace")));
+  }
+
+  EXPECT_EQ(recorded, run(replay::Mode::Replay));
+
+  replay::set_recording_path_prefix(old_prefix);
+  replay::set_mode(old_mode, 0);
+  shcore::remove_directory(tracedir, true);
+}
+
+TEST_F(Db_tests, query_prepared_zerofill) {
+  using mysqlshdk::db::mysql::Stmt_param;
+
+  auto classic = mysqlshdk::db::mysql::Session::create();
+  classic->connect(shcore::get_connection_options(uri()));
+
+  classic->execute("drop schema if exists prepared_test");
+  classic->execute("create schema prepared_test");
+  classic->execute(
+      "create table prepared_test.z (id int primary key, "
+      "i int(4) unsigned zerofill, b bigint(8) zerofill, y year)");
+  classic->execute(
+      "insert into prepared_test.z values (1, 5, 42, 0), "
+      "(2, 12345, 123456789, 2019), (3, 0, 0, NULL)");
+
+  const std::string query = "select i, b, y from prepared_test.z where id = ?";
+
+  // values are formatted the same way as in the text protocol
+  for (int64_t id = 1; id <= 3; ++id) {
+    SCOPED_TRACE(id);
+
+    auto text = classic->queryf(query, id);
+    auto binary = classic->query_prepared(query, {Stmt_param(id)});
+
+    auto text_row = text->fetch_one();
+    auto binary_row = binary->fetch_one();
+    ASSERT_NE(nullptr, text_row);
+    ASSERT_NE(nullptr, binary_row);
+
+    for (uint32_t i = 0; i < 3; ++i) {
+      EXPECT_EQ(text_row->get_as_string(i), binary_row->get_as_string(i));
+    }
+  }
+
+  auto row = classic->query_prepared(query, {Stmt_param(int64_t(1))})
+                 ->fetch_one();
+  ASSERT_NE(nullptr, row);
+  EXPECT_EQ("0005", row->get_as_string(0));
+  EXPECT_EQ(5, row->get_int(0));
+  EXPECT_EQ("00000042", row->get_as_string(1));
+  EXPECT_EQ("0000", row->get_as_string(2));
+  EXPECT_EQ(0, row->get_int(2));
+
+  // values wider than the display width are not truncated
+  row = classic->query_prepared(query, {Stmt_param(int64_t(2))})->fetch_one();
+  ASSERT_NE(nullptr, row);
+  EXPECT_EQ("12345", row->get_as_string(0));
+  EXPECT_EQ("123456789", row->get_as_string(1));
+  EXPECT_EQ("2019", row->get_as_string(2));
+
+  classic->execute("drop schema prepared_test");
+}
+
+TEST_F(Db_tests, query_prepared) {
+  using mysqlshdk::db::mysql::Stmt_param;
+
+  auto classic = mysqlshdk::db::mysql::Session::create();
+  classic->connect(shcore::get_connection_options(uri()));
+  classic->set_statement_cache_size(2);
+
+  classic->execute("drop schema if exists prepared_test");
+  classic->execute("create schema prepared_test");
+  classic->execute(
+      "create table prepared_test.t (id int unsigned primary key, "
+      "name varchar(300), price decimal(10,2), ratio double, "
+      "created datetime(3), flags bit(12))");
+
+  const std::string insert = "insert into prepared_test.t values (?, ?, ?, ?, "
+                             "'2019-01-02 03:04:05.678', b'101')";
+  for (uint64_t i = 1; i <= 3; ++i) {
+    auto result = classic->query_prepared(
+        insert, {Stmt_param(i), Stmt_param(std::string(i * 100, 'x')),
+                 Stmt_param(std::string("12.34")), Stmt_param(i * 1.5)});
+    EXPECT_EQ(1, result->get_affected_row_count());
+  }
+
+  // statement is prepared once
+  EXPECT_EQ(1, classic->get_cached_statement_count());
+
+  {
+    auto result = classic->query_prepared(
+        "select id, name, price, ratio, created, flags, ? from prepared_test.t "
+        "where id >= ? order by id",
+        {Stmt_param(), Stmt_param(int64_t(2))});
+    ASSERT_TRUE(result->has_resultset());
+
+    auto row = result->fetch_one();
+    ASSERT_NE(nullptr, row);
+    EXPECT_EQ(Type::UInteger, row->get_type(0));
+    EXPECT_EQ(2, row->get_int(0));
+    // longer than the initial buffer
+    EXPECT_EQ(std::string(200, 'x'), row->get_string(1));
+    EXPECT_EQ("12.34", row->get_as_string(2));
+    EXPECT_DOUBLE_EQ(12.34, row->get_double(2));
+    EXPECT_DOUBLE_EQ(3.0, row->get_double(3));
+    EXPECT_EQ("3", row->get_as_string(3));
+    EXPECT_EQ("2019-01-02 03:04:05.678", row->get_string(4));
+    EXPECT_EQ(5, row->get_bit(5));
+    EXPECT_TRUE(row->is_null(6));
+
+    row = result->fetch_one();
+    ASSERT_NE(nullptr, row);
+    EXPECT_EQ(3, row->get_uint(0));
+    EXPECT_EQ(std::string(300, 'x'), row->get_string(1));
+
+    EXPECT_EQ(nullptr, result->fetch_one());
+  }
+
+  EXPECT_EQ(2, classic->get_cached_statement_count());
+
+  // unread rows are discarded by the next statement
+  classic->query_prepared("select id from prepared_test.t where id > ?",
+                          {Stmt_param(int64_t(0))});
+  EXPECT_EQ(3, classic->query("select count(*) from prepared_test.t")
+                   ->fetch_one()
+                   ->get_int(0));
+
+  // least recently used statement was closed
+  EXPECT_EQ(2, classic->get_cached_statement_count());
+
+  // buffered results can be rewound
+  {
+    auto result = classic->query_prepared(
+        "select id from prepared_test.t where id <> ?",
+        {Stmt_param(std::string("1"))}, true);
+    EXPECT_EQ(2, result->fetch_one()->get_int(0));
+    EXPECT_EQ(3, result->fetch_one()->get_int(0));
+    EXPECT_EQ(nullptr, result->fetch_one());
+    result->rewind();
+    EXPECT_EQ(2, result->fetch_one()->get_int(0));
+  }
+
+  EXPECT_THROW(classic->query_prepared("select ?, ?", {Stmt_param()}),
+               std::invalid_argument);
+  EXPECT_THROW(classic->query_prepared("select 1", {Stmt_param()}),
+               std::invalid_argument);
+
+  try {
+    classic->query_prepared("select * from prepared_test.unknown where 1 = ?",
+                            {Stmt_param(int64_t(1))});
+    ADD_FAILURE() << "Expected exception";
+  } catch (const mysqlshdk::db::Error &e) {
+    EXPECT_EQ(ER_NO_SUCH_TABLE, e.code());
+  }
+
+  // server deallocates statements when session is reset
+  classic->reset();
+  EXPECT_EQ(0, classic->get_cached_statement_count());
+  EXPECT_EQ(3, classic
+                   ->query_prepared("select count(*) from prepared_test.t "
+                                    "where ratio > ?",
+                                    {Stmt_param(0.0)})
+                   ->fetch_one()
+                   ->get_int(0));
+
+  classic->set_statement_cache_size(0);
+  EXPECT_EQ(0, classic->get_cached_statement_count());
+
+  classic->execute("drop schema prepared_test");
+  classic->close();
+}
+
+TEST_F(Db_tests, classic_session_placeholders) {
+  auto session = std::make_shared<mysqlsh::mysql::ClassicSession>();
+  session->connect(shcore::get_connection_options(uri()));
+
+  session->execute_sql("drop schema if exists placeholder_test", {});
+  session->execute_sql("create schema placeholder_test", {});
+  session->execute_sql("create table placeholder_test.t (id int)", {});
+  session->execute_sql("insert into placeholder_test.t values (1), (2)", {});
+
+  const auto args = [](std::initializer_list<shcore::Value> values) {
+    return std::make_shared<shcore::Value::Array_type>(values);
+  };
+  const auto fetch_count = [&session](const std::string &query,
+                                      const shcore::Array_t &args) {
+    const auto result = session->execute_sql(query, args)
+                            .as_object<mysqlsh::mysql::ClassicResult>();
+    const auto row = result->fetch_one();
+    return row ? row->get_int(0) : -1;
+  };
+
+  // identifier placeholders are substituted on the client
+  EXPECT_EQ(2, fetch_count("select count(*) from !.!",
+                           args({shcore::Value("placeholder_test"),
+                                 shcore::Value("t")})));
+  EXPECT_EQ(1, fetch_count("select count(*) from placeholder_test.! "
+                           "where id > ?",
+                           args({shcore::Value("t"), shcore::Value(1)})));
+
+  // ! within a string literal is not a placeholder
+  EXPECT_EQ(1, fetch_count("select count(*) from placeholder_test.t "
+                           "where '!' = ? and id = ?",
+                           args({shcore::Value("!"), shcore::Value(2)})));
+
+  session->execute_sql("drop schema placeholder_test", {});
+  session->close();
+}
+
+TEST_F(Db_tests, async_query_loop) {
+  using mysqlshdk::db::mysql::Async_query_loop;
+
+  std::vector<std::shared_ptr<mysqlshdk::db::mysql::Session>> sessions;
+  for (int i = 0; i < 3; ++i) {
+    sessions.emplace_back(mysqlshdk::db::mysql::Session::create());
+    sessions.back()->connect(shcore::get_connection_options(uri()));
+  }
+
+  Async_query_loop loop;
+  std::vector<int64_t> values;
+  int chained = 0;
+
+  for (int i = 0; i < 3; ++i) {
+    loop.add(sessions[i], "select sleep(0.5), " + std::to_string(i),
+             [&values](std::shared_ptr<IResult> result,
+                       std::exception_ptr error) {
+               ASSERT_EQ(nullptr, error);
+               values.push_back(result->fetch_one()->get_int(1));
+             });
+  }
+
+  EXPECT_THROW(loop.add(sessions[0], "select 1", {}), std::logic_error);
+  EXPECT_EQ(3, loop.pending());
+
+  const auto start = std::chrono::steady_clock::now();
+  loop.run();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // queries are executed concurrently
+  EXPECT_LT(elapsed, std::chrono::milliseconds(1200));
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ((std::vector<int64_t>{0, 1, 2}), values);
+  EXPECT_EQ(0, loop.pending());
+
+  // errors are reported to the callback, callback can queue next query
+  loop.add(sessions[0], "select * from mysql.no_such_table",
+           [&](std::shared_ptr<IResult> result, std::exception_ptr error) {
+             EXPECT_EQ(nullptr, result);
+             try {
+               std::rethrow_exception(error);
+             } catch (const mysqlshdk::db::Error &e) {
+               EXPECT_EQ(ER_NO_SUCH_TABLE, e.code());
+             }
+
+             loop.add(sessions[0], "select 1",
+                      [&chained](std::shared_ptr<IResult> result,
+                                 std::exception_ptr error) {
+                        ASSERT_EQ(nullptr, error);
+                        chained = result->fetch_one()->get_int(0);
+                      });
+           });
+
+  // query which takes too long is aborted, session is closed
+  const auto timed_out_id = sessions[1]->get_connection_id();
+  loop.add(sessions[1], "select sleep(10)",
+           [](std::shared_ptr<IResult> result, std::exception_ptr error) {
+             EXPECT_EQ(nullptr, result);
+             try {
+               std::rethrow_exception(error);
+             } catch (const mysqlshdk::db::Error &e) {
+               EXPECT_EQ(ER_QUERY_TIMEOUT, e.code());
+             }
+           },
+           std::chrono::milliseconds(200));
+
+  loop.run();
+
+  EXPECT_EQ(1, chained);
+  EXPECT_TRUE(sessions[0]->is_open());
+  EXPECT_FALSE(sessions[1]->is_open());
+  EXPECT_THROW(loop.add(sessions[1], "select 1", {}), std::runtime_error);
+
+  // query was killed on the server
+  const auto running = [&sessions](uint64_t id) {
+    return sessions[0]
+        ->queryf(
+            "select count(*) from information_schema.processlist where id = ? "
+            "and info like 'select %'",
+            id)
+        ->fetch_one()
+        ->get_uint(0);
+  };
+
+  for (int i = 0; i < 10 && running(timed_out_id) > 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  EXPECT_EQ(0, running(timed_out_id));
+
+  // server stops sending the result after the first row, read is interrupted
+  // once deadline passes
+  const auto stalled_id = sessions[2]->get_connection_id();
+  bool timed_out = false;
+  loop.add(sessions[2],
+           "select if(n = 2, sleep(10), repeat('x', 65536)) from (select 1 as "
+           "n union all select 2) as t",
+           [&timed_out](std::shared_ptr<IResult> result,
+                        std::exception_ptr error) {
+             EXPECT_EQ(nullptr, result);
+             try {
+               std::rethrow_exception(error);
+             } catch (const mysqlshdk::db::Error &e) {
+               EXPECT_EQ(ER_QUERY_TIMEOUT, e.code());
+               timed_out = true;
+             }
+           },
+           std::chrono::milliseconds(500));
+
+  const auto stalled_start = std::chrono::steady_clock::now();
+  loop.run();
+
+  EXPECT_LT(std::chrono::steady_clock::now() - stalled_start,
+            std::chrono::seconds(5));
+  EXPECT_TRUE(timed_out);
+  EXPECT_FALSE(sessions[2]->is_open());
+
+  for (int i = 0; i < 10 && running(stalled_id) > 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  EXPECT_EQ(0, running(stalled_id));
+
+  for (const auto &s : sessions) s->close();
+}
+
+TEST_F(Db_tests, async_query_loop_cancel) {
+  using mysqlshdk::db::mysql::Async_query_loop;
+
+  std::vector<std::shared_ptr<mysqlshdk::db::mysql::Session>> sessions;
+  for (int i = 0; i < 3; ++i) {
+    sessions.emplace_back(mysqlshdk::db::mysql::Session::create());
+    sessions.back()->connect(shcore::get_connection_options(uri()));
+  }
+
+  std::vector<int> interrupted;
+  const auto expect_interrupted = [&interrupted](int id) {
+    return [&interrupted, id](std::shared_ptr<IResult> result,
+                              std::exception_ptr error) {
+      EXPECT_EQ(nullptr, result);
+      ASSERT_NE(nullptr, error);
+      try {
+        std::rethrow_exception(error);
+      } catch (const mysqlshdk::db::Error &e) {
+        EXPECT_EQ(ER_QUERY_INTERRUPTED, e.code());
+        interrupted.push_back(id);
+      }
+    };
+  };
+
+  {
+    Async_query_loop loop;
+
+    // pending queries fail, including the ones added by their callbacks
+    loop.add(sessions[0], "select 1",
+             [&](std::shared_ptr<IResult>, std::exception_ptr error) {
+               ASSERT_EQ(nullptr, error);
+               loop.cancel();
+               loop.add(sessions[0], "select 2", expect_interrupted(0));
+             });
+    loop.add(sessions[1], "select sleep(10)", expect_interrupted(1));
+
+    const auto start = std::chrono::steady_clock::now();
+    loop.run();
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start,
+              std::chrono::seconds(5));
+    EXPECT_EQ((std::vector<int>{1, 0}), interrupted);
+    EXPECT_EQ(0, loop.pending());
+
+    // query in flight was aborted, session is closed
+    EXPECT_TRUE(sessions[0]->is_open());
+    EXPECT_FALSE(sessions[1]->is_open());
+
+    // loop can be used after it was cancelled
+    int64_t value = 0;
+    loop.add(sessions[0], "select 3",
+             [&value](std::shared_ptr<IResult> result,
+                      std::exception_ptr error) {
+               ASSERT_EQ(nullptr, error);
+               value = result->fetch_one()->get_int(0);
+             });
+    loop.run();
+    EXPECT_EQ(3, value);
+
+    // queries added before cancel() was called fail
+    loop.add(sessions[0], "select 4", expect_interrupted(2));
+    loop.cancel();
+    loop.run();
+    EXPECT_EQ((std::vector<int>{1, 0, 2}), interrupted);
+  }
+
+  {
+    // queries which were not executed fail once loop is destroyed
+    Async_query_loop loop;
+    loop.add(sessions[2], "select 1", expect_interrupted(3));
+  }
+
+  EXPECT_EQ((std::vector<int>{1, 0, 2, 3}), interrupted);
+  EXPECT_TRUE(sessions[2]->is_open());
+
+  for (const auto &s : sessions) s->close();
+}
+
+TEST_F(Db_tests, async_query_loop_record_replay) {
+  namespace replay = mysqlshdk::db::replay;
+  using mysqlshdk::db::mysql::Async_query_loop;
+
+  const auto connection_options = shcore::get_connection_options(uri());
+  const std::string old_prefix = replay::g_recording_path_prefix;
+  const auto old_mode = replay::g_replay_mode;
+  const auto tracedir =
+      shcore::path::join_path(getenv("TMPDIR"), "async_query_loop_traces");
+
+  shcore::ensure_dir_exists(tracedir);
+  replay::set_recording_path_prefix(tracedir + "/");
+
+  const auto run = [&](replay::Mode mode) {
+    replay::set_mode(mode, 0);
+    replay::begin_recording_context("async_query_loop");
+
+    std::vector<std::shared_ptr<mysqlshdk::db::mysql::Session>> sessions;
+    std::vector<uint64_t> ids(3);
+    Async_query_loop loop;
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+      sessions.emplace_back(mysqlshdk::db::mysql::Session::create());
+      sessions.back()->connect(connection_options);
+
+      // queries are executed through the recording/replaying session
+      loop.add(sessions.back(), "select connection_id()",
+               [&ids, i](std::shared_ptr<IResult> result,
+                         std::exception_ptr error) {
+                 ASSERT_EQ(nullptr, error);
+                 ids[i] = result->fetch_one()->get_uint(0);
+               });
+    }
+
+    loop.run();
+
+    for (const auto &s : sessions) s->close();
+
+    replay::end_recording_context();
+    return ids;
+  };
+
+  const auto recorded = run(replay::Mode::Record);
+  EXPECT_NE(recorded[0], recorded[1]);
+  EXPECT_NE(recorded[1], recorded[2]);
+
+  for (int i = 1; i <= 3; ++i) {
+    EXPECT_TRUE(shcore::is_file(shcore::path::join_path(
+        tracedir, "async_query_loop." + std::to_string(i) + ".mysql_trace")));
+  }
+
+  EXPECT_EQ(recorded, run(replay::Mode::Replay));
+
+  replay::set_recording_path_prefix(old_prefix);
+  replay::set_mode(old_mode, 0);
+  shcore::remove_directory(tracedir, true);
+}
+
 }  // namespace db
 }  // namespace mysqlshdk
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/libs/db/replay/binary_trace.h"
+#include "mysqlshdk/libs/db/replay/trace.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils/shell_test_env.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace replay {
+
+class Replay_trace : public ::testing::Test {
+ protected:
+  static std::string tmp_file(const char *name) {
+    return shcore::path::join_path(getenv("TMPDIR"), name);
+  }
+
+  void TearDown() override {
+    for (const auto &f : m_files) shcore::delete_file(f);
+  }
+
+  std::string add_file(const char *name) {
+    m_files.push_back(tmp_file(name));
+    return m_files.back();
+  }
+
+  static void write_session(const std::string &path, Trace_format format) {
+    std::unique_ptr<Trace_writer> writer(
+        Trace_writer::create(path, 0, format));
+    writer->serialize_connect(Connection_options("root@localhost:3306"),
+                              "classic");
+    writer->serialize_connect_ok({{"server_version", "8.0.16"}});
+    writer->serialize_query("select 1");
+    writer->serialize_ok();
+    writer->serialize_query("select * from bogus");
+    writer->serialize_error(
+        db::Error("Table 'bogus' doesn't exist", 1146, "42S02"));
+    writer->serialize_close();
+  }
+
+  static void check_session(const std::string &path) {
+    Trace trace(path, 0);
+    auto copts = trace.expected_connect();
+    EXPECT_EQ("localhost", copts.get_host());
+    EXPECT_EQ(3306, copts.get_port());
+
+    std::map<std::string, std::string> info;
+    trace.expected_connect_status(&info);
+    EXPECT_EQ("8.0.16", info["server_version"]);
+
+    EXPECT_EQ("select 1", trace.expected_query("select 1"));
+    EXPECT_NO_THROW(trace.expected_status());
+
+    EXPECT_EQ("select * from bogus",
+              trace.expected_query("select * from bogus"));
+    try {
+      trace.expected_status();
+      ADD_FAILURE() << "Expected error";
+    } catch (const db::Error &e) {
+      EXPECT_EQ(1146, e.code());
+      EXPECT_STREQ("42S02", e.sqlstate());
+    }
+
+    trace.expected_close();
+    EXPECT_EQ(7u, trace.trace_index());
+  }
+
+  std::vector<std::string> m_files;
+};
+
+TEST_F(Replay_trace, binary_values) {
+  const auto path = add_file("binary_values.trace");
+
+  rapidjson::Document doc;
+  doc.SetObject();
+  auto &a = doc.GetAllocator();
+  doc.AddMember("null", rapidjson::Value(), a);
+  doc.AddMember("true", true, a);
+  doc.AddMember("false", false, a);
+  doc.AddMember("int", int64_t(-1234567890123), a);
+  doc.AddMember("uint", uint64_t(18446744073709551615ULL), a);
+  doc.AddMember("double", 3.25, a);
+  doc.AddMember("string", rapidjson::Value("a\0b", 3, a), a);
+  rapidjson::Value array(rapidjson::kArrayType);
+  array.PushBack(1, a).PushBack("two", a).PushBack(rapidjson::Value(), a);
+  doc.AddMember("array", array, a);
+
+  {
+    Binary_trace_writer writer(path);
+    writer.write(doc);
+    writer.write(doc);
+    EXPECT_EQ(2u, writer.count());
+  }
+
+  EXPECT_TRUE(is_binary_trace(path));
+
+  Binary_trace_reader reader(path);
+  for (int i = 0; i < 2; ++i) {
+    rapidjson::Document entry;
+    ASSERT_TRUE(reader.next(&entry));
+    EXPECT_TRUE(entry == doc);
+    EXPECT_EQ(3u, entry["string"].GetStringLength());
+    EXPECT_TRUE(entry["int"].IsInt64());
+    EXPECT_TRUE(entry["uint"].IsUint64());
+    EXPECT_TRUE(entry["double"].IsDouble());
+  }
+  rapidjson::Document entry;
+  EXPECT_FALSE(reader.next(&entry));
+}
+
+TEST_F(Replay_trace, replay_json_and_binary) {
+  const auto json = add_file("session.json_trace");
+  const auto binary = add_file("session.binary_trace");
+
+  write_session(json, Trace_format::Json);
+  write_session(binary, Trace_format::Binary);
+
+  EXPECT_FALSE(is_binary_trace(json));
+  EXPECT_TRUE(is_binary_trace(binary));
+
+  check_session(json);
+  check_session(binary);
+}
+
+TEST_F(Replay_trace, convert) {
+  const auto json = add_file("convert.json_trace");
+  const auto binary = add_file("convert.binary_trace");
+  const auto json2 = add_file("convert2.json_trace");
+
+  write_session(json, Trace_format::Json);
+
+  EXPECT_EQ(7u, convert_trace(json, binary, Trace_format::Binary));
+  EXPECT_TRUE(is_binary_trace(binary));
+  check_session(binary);
+
+  EXPECT_EQ(7u, convert_trace(binary, json2, Trace_format::Json));
+  EXPECT_FALSE(is_binary_trace(json2));
+  check_session(json2);
+
+  std::string original;
+  std::string converted;
+  ASSERT_TRUE(shcore::load_text_file(json, original));
+  ASSERT_TRUE(shcore::load_text_file(json2, converted));
+  EXPECT_EQ(original, converted);
+}
+
+TEST_F(Replay_trace, truncated_binary) {
+  const auto binary = add_file("truncated.binary_trace");
+  write_session(binary, Trace_format::Binary);
+
+  std::string data;
+  {
+    std::ifstream in(binary, std::ios::binary);
+    data.assign(std::istreambuf_iterator<char>(in),
+                std::istreambuf_iterator<char>());
+  }
+  {
+    // cut the last entry in half
+    std::ofstream out(binary, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), data.size() - 3);
+  }
+
+  Trace trace(binary, 0);
+  trace.expected_connect();
+  std::map<std::string, std::string> info;
+  trace.expected_connect_status(&info);
+  trace.expected_query("select 1");
+  trace.expected_status();
+  trace.expected_query("select * from bogus");
+  EXPECT_THROW(trace.expected_status(), db::Error);
+  EXPECT_THROW_LIKE(trace.expected_close(), std::logic_error,
+                    "corrupted binary trace");
+}
+
+TEST_F(Replay_trace, truncated_binary_length) {
+  const auto binary = add_file("truncated_length.binary_trace");
+
+  {
+    // complete record, followed by a partial length prefix
+    std::ofstream out(binary, std::ios::binary | std::ios::trunc);
+    out.write(k_binary_trace_magic, k_binary_trace_magic_length);
+    out.write("\x01N\x80", 3);
+  }
+
+  Binary_trace_reader reader(binary);
+  rapidjson::Document entry;
+  EXPECT_TRUE(reader.next(&entry));
+  EXPECT_TRUE(entry.IsNull());
+  EXPECT_THROW_LIKE(reader.next(&entry), std::logic_error,
+                    "corrupted binary trace");
+}
+
+TEST_F(Replay_trace, truncated_binary_payload) {
+  const auto binary = add_file("truncated_payload.binary_trace");
+
+  {
+    // record which is shorter than its length, but fits in the file size
+    // check: two records, the second one claims the bytes of the first one
+    std::ofstream out(binary, std::ios::binary | std::ios::trunc);
+    out.write(k_binary_trace_magic, k_binary_trace_magic_length);
+    out.write("\x01N\x02s", 4);
+  }
+
+  Binary_trace_reader reader(binary);
+  rapidjson::Document entry;
+  EXPECT_TRUE(reader.next(&entry));
+  EXPECT_THROW_LIKE(reader.next(&entry), std::logic_error,
+                    "corrupted binary trace");
+
+  // end of a complete trace is not an error
+  const auto complete = add_file("complete.binary_trace");
+  write_session(complete, Trace_format::Binary);
+  Binary_trace_reader complete_reader(complete);
+  int entries = 0;
+  while (complete_reader.next(&entry)) ++entries;
+  EXPECT_EQ(7, entries);
+}
+
+#ifdef __linux__
+TEST_F(Replay_trace, binary_write_error) {
+  // writes to /dev/full fail with ENOSPC
+  EXPECT_THROW_LIKE(Binary_trace_writer("/dev/full"), std::logic_error,
+                    "/dev/full: No space left on device");
+  EXPECT_THROW_LIKE(Trace_writer::create("/dev/full", 0, Trace_format::Binary),
+                    std::logic_error, "/dev/full: No space left on device");
+}
+#endif  // __linux__
+
+TEST_F(Replay_trace, corrupted_binary_length) {
+  const auto binary = add_file("corrupted_length.binary_trace");
+
+  {
+    // record which claims to be much larger than the file
+    std::ofstream out(binary, std::ios::binary | std::ios::trunc);
+    out.write(k_binary_trace_magic, k_binary_trace_magic_length);
+    out.write("\xff\xff\xff\xff\xff\xff\xff\x7f", 8);
+    out.write("N", 1);
+  }
+
+  Binary_trace_reader reader(binary);
+  rapidjson::Document entry;
+  EXPECT_THROW_LIKE(reader.next(&entry), std::logic_error,
+                    "corrupted binary trace");
+}
+
+TEST_F(Replay_trace, corrupted_binary_count) {
+  const auto binary = add_file("corrupted_count.binary_trace");
+
+  {
+    // array with a huge number of elements in a 3 byte record
+    std::ofstream out(binary, std::ios::binary | std::ios::trunc);
+    out.write(k_binary_trace_magic, k_binary_trace_magic_length);
+    out.write("\x03a\xff\x7f", 4);
+  }
+
+  Binary_trace_reader reader(binary);
+  rapidjson::Document entry;
+  EXPECT_THROW_LIKE(reader.next(&entry), std::logic_error,
+                    "corrupted binary trace");
+}
+
+TEST_F(Replay_trace, corrupted_binary_depth) {
+  const auto binary = add_file("corrupted_depth.binary_trace");
+
+  {
+    // deeply nested single element arrays
+    std::string payload;
+    for (int i = 0; i < 10000; ++i) payload += "a\x01";
+    payload += "N";
+
+    std::string length;
+    for (size_t l = payload.size(); l > 0; l >>= 7)
+      length.push_back(static_cast<char>((l & 0x7f) | (l >= 0x80 ? 0x80 : 0)));
+
+    std::ofstream out(binary, std::ios::binary | std::ios::trunc);
+    out.write(k_binary_trace_magic, k_binary_trace_magic_length);
+    out.write(length.data(), length.size());
+    out.write(payload.data(), payload.size());
+  }
+
+  Binary_trace_reader reader(binary);
+  rapidjson::Document entry;
+  EXPECT_THROW_LIKE(reader.next(&entry), std::logic_error,
+                    "corrupted binary trace");
+}
+
+}  // namespace replay
+}  // namespace db
+}  // namespace mysqlshdk
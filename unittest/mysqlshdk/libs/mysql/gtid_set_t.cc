@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/mysql/gtid_set.h"
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils.h"
+
+namespace mysqlshdk {
+namespace mysql {
+
+namespace {
+
+constexpr const char k_uuid1[] = "3e11fa47-71ca-11e1-9e33-c80aa9429562";
+constexpr const char k_uuid2[] = "4b2c0b5c-71ca-11e1-9e33-c80aa9429562";
+
+Gtid_set gtids(const std::string &uuid1, const std::string &uuid2 = "") {
+  std::string set;
+  if (!uuid1.empty()) set = k_uuid1 + (":" + uuid1);
+  if (!uuid2.empty()) set += std::string(",") + k_uuid2 + ":" + uuid2;
+  return Gtid_set::from_string(set);
+}
+
+}  // namespace
+
+TEST(Gtid_set, parse) {
+  EXPECT_TRUE(Gtid_set::from_string("").empty());
+  EXPECT_TRUE(Gtid_set::from_string(" ,\n").empty());
+
+  // normalized the same way as by the server
+  auto set = Gtid_set::from_string(
+      "4B2C0B5C71CA11E19E33C80AA9429562:30:10-20,\n"
+      " 3e11fa47-71ca-11e1-9e33-c80aa9429562:7:1-5:6 ");
+  EXPECT_EQ(std::string(k_uuid1) + ":1-7,\n" + k_uuid2 + ":10-20:30",
+            set.str());
+  EXPECT_EQ(19, set.count());
+  EXPECT_EQ((std::vector<std::string>{k_uuid1, k_uuid2}), set.uuids());
+  EXPECT_EQ((Gtid_set::Intervals{{10, 20}, {30, 30}}),
+            set.intervals("4B2C0B5C-71CA-11E1-9E33-C80AA9429562"));
+  EXPECT_TRUE(set.intervals("unknown").empty());
+
+  EXPECT_EQ(gtids("1-9"), gtids("1-5:4-9"));
+  EXPECT_EQ(gtids("1-9223372036854775807"), gtids("1-9223372036854775807"));
+
+  for (const auto &invalid :
+       {"x:1", "3e11fa47-71ca-11e1-9e33-c80aa942956:1",
+        "3e11fa47-71ca-11e1-9e33-c80aa9429562",
+        "3e11fa47-71ca-11e1-9e33-c80aa9429562:",
+        "3e11fa47-71ca-11e1-9e33-c80aa9429562::1",
+        "3e11fa47-71ca-11e1-9e33-c80aa9429562:0",
+        "3e11fa47-71ca-11e1-9e33-c80aa9429562:5-3",
+        "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-",
+        "3e11fa47-71ca-11e1-9e33-c80aa9429562:a",
+        "3e11fa47-71ca-11e1-9e33-c80aa9429562:9223372036854775808"}) {
+    SCOPED_TRACE(invalid);
+    EXPECT_THROW_LIKE(Gtid_set::from_string(invalid), shcore::Exception,
+                      "Malformed GTID set specification");
+  }
+}
+
+TEST(Gtid_set, add) {
+  EXPECT_EQ(gtids("1-40", "1"), gtids("1-10:21-30") + gtids("5-25:31-40", "1"));
+  EXPECT_EQ(gtids("1-10"), gtids("1-10") + Gtid_set());
+  EXPECT_EQ(gtids("1-10"), Gtid_set() + gtids("1-10"));
+}
+
+TEST(Gtid_set, subtract) {
+  EXPECT_EQ(gtids("1-2:5-7", "10-14"),
+            gtids("1-7", "10-20:30") - gtids("3-4", "15-40"));
+  EXPECT_EQ(gtids("", "1"), gtids("1-10", "1") - gtids("1-20"));
+  EXPECT_EQ(gtids("1:10"), gtids("1-10") - gtids("2-9"));
+  EXPECT_EQ(gtids("1-3:9"), gtids("1-5:7-9") - gtids("4-8"));
+  EXPECT_TRUE((gtids("1-10") - gtids("1-10")).empty());
+  EXPECT_TRUE((Gtid_set() - gtids("1-10")).empty());
+}
+
+TEST(Gtid_set, intersect) {
+  EXPECT_EQ(gtids("3-4", "15-20:30"),
+            gtids("1-7", "10-20:30").intersect(gtids("3-4", "15-40")));
+  EXPECT_EQ(gtids("2-3:5:7-8"),
+            gtids("1-3:5-8").intersect(gtids("2-5:7-10")));
+  EXPECT_TRUE(gtids("1-10").intersect(gtids("", "1-10")).empty());
+}
+
+TEST(Gtid_set, is_subset) {
+  EXPECT_TRUE(Gtid_set().is_subset(Gtid_set()));
+  EXPECT_TRUE(Gtid_set().is_subset(gtids("1")));
+  EXPECT_TRUE(gtids("2-3:7").is_subset(gtids("1-5:7-9")));
+  EXPECT_TRUE(gtids("1-10").is_subset(gtids("1-10", "1")));
+  EXPECT_FALSE(gtids("1").is_subset(Gtid_set()));
+  EXPECT_FALSE(gtids("4-7").is_subset(gtids("1-5:7-9")));
+  EXPECT_FALSE(gtids("1-10", "1").is_subset(gtids("1-10")));
+}
+
+}  // namespace mysql
+}  // namespace mysqlshdk
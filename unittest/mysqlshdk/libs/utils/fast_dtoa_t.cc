@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/fast_dtoa.h"
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+namespace {
+
+std::string gcvt(double value, my_gcvt_arg_type type, int width) {
+  char buffer[128];
+  const auto len = my_gcvt(value, type, width, buffer, nullptr);
+  return std::string(buffer, len);
+}
+
+std::string fast(double value, my_gcvt_arg_type type, int width) {
+  char buffer[128];
+  const auto len = fast_gcvt(value, type, width, buffer, nullptr);
+  EXPECT_EQ(len, strlen(buffer));
+  return std::string(buffer, len);
+}
+
+void check_compatibility(double value) {
+  SCOPED_TRACE(std::to_string(value));
+
+  for (int width : {31, 99, 18, 17, 16, 10}) {
+    SCOPED_TRACE(width);
+
+    EXPECT_EQ(gcvt(value, MY_GCVT_ARG_DOUBLE, width),
+              fast(value, MY_GCVT_ARG_DOUBLE, width));
+    EXPECT_EQ(gcvt(value, MY_GCVT_ARG_FLOAT, width),
+              fast(value, MY_GCVT_ARG_FLOAT, width));
+  }
+}
+
+}  // namespace
+
+TEST(Fast_dtoa, shortest) {
+  char digits[17];
+  int length = 0;
+  int decpt = 0;
+
+  ASSERT_TRUE(fast_dtoa_shortest(0.1, digits, &length, &decpt));
+  EXPECT_EQ("1", std::string(digits, length));
+  EXPECT_EQ(0, decpt);
+
+  ASSERT_TRUE(fast_dtoa_shortest(123.456, digits, &length, &decpt));
+  EXPECT_EQ("123456", std::string(digits, length));
+  EXPECT_EQ(3, decpt);
+
+  ASSERT_TRUE(fast_dtoa_shortest(1e22, digits, &length, &decpt));
+  EXPECT_EQ("1", std::string(digits, length));
+  EXPECT_EQ(23, decpt);
+
+  ASSERT_TRUE(fast_dtoa_shortest(DBL_MAX, digits, &length, &decpt));
+  EXPECT_EQ("17976931348623157", std::string(digits, length));
+  EXPECT_EQ(309, decpt);
+
+  ASSERT_TRUE(fast_dtoa_shortest(std::numeric_limits<double>::denorm_min(),
+                                 digits, &length, &decpt));
+  EXPECT_EQ("5", std::string(digits, length));
+  EXPECT_EQ(-323, decpt);
+}
+
+TEST(Fast_dtoa, format) {
+  EXPECT_EQ("0", fast(0.0, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("-0", fast(-0.0, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("0.1", fast(0.1, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("-1.5", fast(-1.5, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("100", fast(100.0, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("0.30000000000000004", fast(0.1 + 0.2, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("1e15", fast(1e15, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("1.2345678901234568e17",
+            fast(123456789012345678.0, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("0.000000000000001", fast(1e-15, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("1e-16", fast(1e-16, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("1.7976931348623157e308", fast(DBL_MAX, MY_GCVT_ARG_DOUBLE, 31));
+  EXPECT_EQ("0.1", fast(0.1f, MY_GCVT_ARG_FLOAT, 31));
+}
+
+TEST(Fast_dtoa, my_gcvt_compatibility) {
+  const std::vector<double> values = {
+      0.0,
+      -0.0,
+      1.0,
+      0.1,
+      0.5,
+      1.5e-14,
+      1.2345678901234567e-14,
+      123456789012345678.0,
+      9007199254740993.0,
+      DBL_MAX,
+      DBL_MIN,
+      std::numeric_limits<double>::denorm_min(),
+      std::numeric_limits<double>::infinity(),
+      std::numeric_limits<double>::quiet_NaN()};
+
+  for (const auto v : values) {
+    check_compatibility(v);
+    check_compatibility(-v);
+  }
+
+  // powers of two and their neighbours, lower boundary is closer for some of
+  // them
+  for (int e = -1074; e <= 1023; e += 7) {
+    const double v = std::ldexp(1.0, e);
+    check_compatibility(v);
+    check_compatibility(std::nextafter(v, 0.0));
+    check_compatibility(std::nextafter(v, DBL_MAX));
+  }
+
+  // powers of ten
+  for (int e = -320; e <= 308; e += 3) {
+    check_compatibility(std::pow(10.0, e));
+  }
+
+  std::mt19937_64 random(2019);
+
+  // random bit patterns
+  for (int i = 0; i < 20000; ++i) {
+    const uint64_t bits = random();
+    double v;
+    std::memcpy(&v, &bits, sizeof(v));
+    check_compatibility(v);
+  }
+
+  // values typical to DECIMAL-like data
+  for (int i = 0; i < 20000; ++i) {
+    check_compatibility(static_cast<double>(random() % 100000000) / 1000);
+  }
+}
+
+}  // namespace shcore
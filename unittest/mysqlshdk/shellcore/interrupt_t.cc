@@ -22,7 +22,10 @@
 #include <gtest_clean.h>
 #include <cstdio>
 #include <cstdlib>
+#include <atomic>
 #include <fstream>
+#include <mutex>
+#include <set>
 #include <string>
 #include <thread>
 
@@ -37,8 +40,10 @@
 #include "modules/devapi/mod_mysqlx_session.h"
 #include "modules/mod_mysql_resultset.h"
 #include "modules/mod_mysql_session.h"
+#include "mysqlshdk/libs/db/replay/setup.h"
 #include "shellcore/base_session.h"
 #include "shellcore/shell_core.h"
+#include "shellcore/shell_init.h"
 #include "shellcore/shell_jscript.h"
 #include "shellcore/shell_python.h"
 #include "shellcore/shell_sql.h"
@@ -298,22 +303,6 @@ class Interrupt_mysqlx : public Interrupt_mysql {
   }
 };
 
-namespace {
-
-class Mysql_thread final {
- public:
-  Mysql_thread() { mysql_thread_init(); }
-  Mysql_thread(const Mysql_thread &other) = delete;
-  Mysql_thread(Mysql_thread &&other) = delete;
-
-  Mysql_thread &operator=(const Mysql_thread &other) = delete;
-  Mysql_thread &operator=(Mysql_thread &&other) = delete;
-
-  ~Mysql_thread() { mysql_thread_end(); }
-};
-
-}  // namespace
-
 TEST_F(Interrupt_mysql, sql_classic) {
   // Test case for FR2
   std::shared_ptr<mysqlsh::ShellBaseSession> session;
@@ -1185,4 +1174,83 @@ TEST_F(Interrupt_mysqlx, js_x_crud_resultset) {
 }
 #endif
 
+TEST(Worker_threads, interrupts) {
+  class Tester : public shcore::Interrupt_helper {
+   public:
+    void setup() override {}
+
+    void block() override {
+      std::lock_guard<std::mutex> lock(mutex);
+      blocked.insert(std::this_thread::get_id());
+    }
+
+    void unblock(bool) override {
+      std::lock_guard<std::mutex> lock(mutex);
+      unblocked.insert(std::this_thread::get_id());
+    }
+
+    std::mutex mutex;
+    std::set<std::thread::id> blocked;
+    std::set<std::thread::id> unblocked;
+  };
+
+  Tester tester;
+  shcore::Interrupts::init(&tester);
+
+  std::mutex mutex;
+  std::set<std::thread::id> workers;
+
+  {
+    Worker_threads threads;
+
+    for (int i = 0; i < 3; ++i) {
+      threads.start([&mutex, &workers]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        workers.insert(std::this_thread::get_id());
+      });
+    }
+
+    threads.join();
+  }
+
+  shcore::Interrupts::init(nullptr);
+
+  // ^C is blocked in each of the workers, but not in the calling thread
+  EXPECT_EQ(3u, workers.size());
+  EXPECT_EQ(workers, tester.blocked);
+  EXPECT_EQ(workers, tester.unblocked);
+}
+
+TEST(Worker_threads, errors) {
+  Worker_threads threads;
+  std::atomic<int> finished{0};
+
+  threads.start([]() { throw std::runtime_error("worker failed"); });
+  threads.start([&finished]() { ++finished; });
+
+  // other workers are not affected, error is reported once
+  EXPECT_THROW(threads.join(), std::runtime_error);
+  EXPECT_EQ(1, finished);
+  EXPECT_NO_THROW(threads.join());
+}
+
+TEST(Worker_threads, count) {
+  namespace replay = mysqlshdk::db::replay;
+
+  EXPECT_EQ(1u, worker_thread_count(4, 0));
+  EXPECT_EQ(1u, worker_thread_count(0, 10));
+  EXPECT_EQ(2u, worker_thread_count(4, 2));
+  EXPECT_EQ(4u, worker_thread_count(4, 10));
+
+  // sessions are used by a single thread when recording or replaying
+  const auto old_mode = replay::g_replay_mode;
+
+  for (const auto mode : {replay::Mode::Record, replay::Mode::Replay}) {
+    replay::set_mode(mode, 0);
+    EXPECT_EQ(1u, worker_thread_count(4, 10));
+  }
+
+  replay::set_mode(old_mode, 0);
+}
+
 }  // namespace mysqlsh
@@ -288,6 +288,9 @@ shell.registerReport('invalid_report', 'print', function (){}, {'options' : [{'n
 //@ WL11263_TSF9_9 - Option duplicates --nocls
 shell.registerReport('invalid_report', 'print', function (){}, {'options' : [{'name': 'nocls'}]})
 
+//@ WL11263_TSF9_9 - Option duplicates --timing
+shell.registerReport('invalid_report', 'print', function (){}, {'options' : [{'name': 'timing'}]})
+
 //@ WL11263_TSF9_9 - Option duplicates --vertical in a 'list' type report
 shell.registerReport('invalid_report', 'list', function (){}, {'options' : [{'name': 'vertical'}]})
 
@@ -379,6 +379,11 @@ DESCRIPTION
       - --interval=float, -i float - Number of seconds to wait between
         refreshes. Default 2. Allowed values are in range [0.1, 86400].
       - --nocls - Don't clear the screen between refreshes.
+      - --timing - Display the execution time of the report below its output.
+
+      Refreshes are scheduled at a fixed rate. Built-in reports are executed in
+      the background, and only the lines which have changed since the previous
+      refresh are redrawn.
 
       If executed without the report name, lists available reports.
 
@@ -247,8 +247,10 @@
 //@<OUT> List all the options using \option
  autocomplete.nameCache          true
  batchContinueOnError            false
+ credentialStore.cacheTtl        0
  credentialStore.excludeFilters  []
  credentialStore.helper          default
+ credentialStore.persistent      false
  credentialStore.savePasswords   prompt
  dba.gtidWaitTimeout             60
  defaultCompress                 false
@@ -271,8 +273,10 @@
 //@<OUT> List all the options using \option and show-origin
  autocomplete.nameCache          true (Compiled default)
  batchContinueOnError            false (Compiled default)
+ credentialStore.cacheTtl        0 (Compiled default)
  credentialStore.excludeFilters  [] (Compiled default)
  credentialStore.helper          default (Compiled default)
+ credentialStore.persistent      false (Compiled default)
  credentialStore.savePasswords   prompt (Compiled default)
  dba.gtidWaitTimeout             60 (Compiled default)
  defaultCompress                 false (Compiled default)
@@ -326,8 +330,10 @@
 //@<OUT> List all the options using \option for SQL mode
  autocomplete.nameCache          true
  batchContinueOnError            false
+ credentialStore.cacheTtl        0
  credentialStore.excludeFilters  []
  credentialStore.helper          default
+ credentialStore.persistent      false
  credentialStore.savePasswords   prompt
  dba.gtidWaitTimeout             60
  defaultCompress                 false
@@ -351,8 +357,10 @@
  Switching to SQL mode... Commands end with ;
  autocomplete.nameCache          true (Compiled default)
  batchContinueOnError            false (Compiled default)
+ credentialStore.cacheTtl        0 (Compiled default)
  credentialStore.excludeFilters  [] (Compiled default)
  credentialStore.helper          default (Compiled default)
+ credentialStore.persistent      false (Compiled default)
  credentialStore.savePasswords   prompt (Compiled default)
  dba.gtidWaitTimeout             60 (Compiled default)
  defaultCompress                 false (Compiled default)
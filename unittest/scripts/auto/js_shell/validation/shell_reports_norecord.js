@@ -195,6 +195,9 @@
 //@ WL11263_TSF9_9 - Option duplicates --nocls
 ||Shell.registerReport: Report already has an option named: 'nocls'. (ArgumentError)
 
+//@ WL11263_TSF9_9 - Option duplicates --timing
+||Shell.registerReport: Report already has an option named: 'timing'. (ArgumentError)
+
 //@ WL11263_TSF9_9 - Option duplicates --vertical in a 'list' type report
 ||Shell.registerReport: Report already has an option named: 'vertical'. (ArgumentError)
 
@@ -42,6 +42,9 @@ FUNCTIONS
       log(level, message)
             Logs an entry to the shell's log file.
 
+      parallel(jobs[, options])
+            Executes SQL statements on multiple sessions concurrently.
+
       parse_uri(uri)
             Utility function to parse a URI string.
 
@@ -318,12 +321,16 @@ DESCRIPTION
         enabled. The \rehash command can be used for manual refresh
       - batchContinueOnError: read-only, boolean value to indicate if the
         execution of an SQL script in batch mode shall continue if errors occur
+      - credentialStore.cacheTtl: number of seconds the passwords fetched from
+        the credential helper are kept in memory, 0 disables the cache
       - credentialStore.excludeFilters: array of URLs for which automatic
         password storage is disabled, supports glob characters '*' and '?'
       - credentialStore.helper: name of the credential helper to use to
         fetch/store passwords; a special value "default" is supported to use
         platform default helper; a special value "<disabled>" is supported to
         disable the credential store
+      - credentialStore.persistent: true to keep the credential helper running
+        between the requests, instead of starting it for each of them
       - credentialStore.savePasswords: controls automatic password storage,
         allowed values: "always", "prompt" or "never"
       - dba.gtidWaitTimeout: timeout value in seconds to wait for GTIDs to be
@@ -342,6 +349,8 @@ DESCRIPTION
         running in interactive mode
       - logLevel: current log level
       - resultFormat: controls the type of output produced for SQL results.
+      - resultPrefetchRows: number of rows of a query result to read ahead in a
+        background thread, 0 to disable
       - pager: string which specifies the external command which is going to be
         used to display the paged output
       - passwordsFromStdin: boolean value that indicates if the shell should
@@ -1571,4 +1571,84 @@ TEST_F(Shell_history, migrate_old_history) {
 #endif
 }
 
+TEST_F(Shell_history, save_appends_new_entries) {
+  const std::string hist_file = "history_journal_test";
+  shcore::delete_file(hist_file);
+
+  History history;
+  history.set_limit(3);
+  EXPECT_TRUE(history.load(hist_file));
+
+  std::string hdata;
+
+  history.add("1");
+  history.add("2");
+  EXPECT_TRUE(history.save(hist_file));
+  shcore::load_text_file(hist_file, hdata);
+  EXPECT_EQ("1\n2\n", hdata);
+
+  // temporary entries are never stored
+  history.add("3");
+  history.add_temporary("secret");
+  EXPECT_TRUE(history.save(hist_file));
+  shcore::load_text_file(hist_file, hdata);
+  EXPECT_EQ("1\n2\n3\n", hdata);
+
+  // entries dropped from history are kept in the file...
+  history.add("4");
+  history.add("5");
+  history.add("6");
+  EXPECT_TRUE(history.save(hist_file));
+  shcore::load_text_file(hist_file, hdata);
+  EXPECT_EQ("1\n2\n3\n4\n5\n6\n", hdata);
+
+  // ...until it holds twice as many entries as the limit
+  history.add("7");
+  EXPECT_TRUE(history.save(hist_file));
+  shcore::load_text_file(hist_file, hdata);
+  EXPECT_EQ("5\n6\n7\n", hdata);
+
+  // deleted entries are removed from the file
+  history.del(history.first_entry(), history.first_entry());
+  EXPECT_TRUE(history.save(hist_file));
+  shcore::load_text_file(hist_file, hdata);
+  EXPECT_EQ("6\n7\n", hdata);
+
+  // only the last entries are loaded
+  history.add("8");
+  history.add("9");
+  EXPECT_TRUE(history.save(hist_file));
+  EXPECT_TRUE(history.load(hist_file));
+  EXPECT_EQ(3, history.size());
+  EXPECT_STREQ("7", linenoiseHistoryLine(0));
+  EXPECT_STREQ("9", linenoiseHistoryLine(2));
+
+  shcore::delete_file(hist_file);
+}
+
+TEST_F(Shell_history, load_counts_file_entries) {
+  const std::string hist_file = "history_journal_test";
+  shcore::create_file(hist_file, "1\n2\n3\n4\n5\n");
+
+  History history;
+  history.set_limit(3);
+  EXPECT_TRUE(history.load(hist_file));
+  EXPECT_EQ(3, history.size());
+
+  std::string hdata;
+
+  // entries which were not loaded still count towards the size of the file
+  history.add("6");
+  EXPECT_TRUE(history.save(hist_file));
+  shcore::load_text_file(hist_file, hdata);
+  EXPECT_EQ("1\n2\n3\n4\n5\n6\n", hdata);
+
+  history.add("7");
+  EXPECT_TRUE(history.save(hist_file));
+  shcore::load_text_file(hist_file, hdata);
+  EXPECT_EQ("5\n6\n7\n", hdata);
+
+  shcore::delete_file(hist_file);
+}
+
 }  // namespace mysqlsh
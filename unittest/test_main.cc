@@ -610,6 +610,7 @@ int main(int argc, char **argv) {
   // Reset these environment vars to start with a clean environment
   putenv(const_cast<char *>("MYSQLSH_RECORDER_PREFIX="));
   putenv(const_cast<char *>("MYSQLSH_RECORDER_MODE="));
+  putenv(const_cast<char *>("MYSQLSH_RECORDER_FORMAT="));
 
   bool listing_tests = false;
   bool show_all_skipped = false;
@@ -638,6 +639,9 @@ int main(int argc, char **argv) {
       if (p) {
         target = p + 1;
       }
+    } else if (strcmp(argv[index], "--trace-format=binary") == 0) {
+      mysqlshdk::db::replay::set_trace_format(
+          mysqlshdk::db::replay::Trace_format::Binary);
     } else if (shcore::str_beginswith(argv[index], "--tracedir")) {
       char *p = strchr(argv[index], '=');
       if (!p) {
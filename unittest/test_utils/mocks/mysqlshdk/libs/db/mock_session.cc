@@ -58,17 +58,22 @@ void Mock_session::then_throw() {
 std::shared_ptr<mysqlshdk::db::IResult> Mock_session::querys(
     const char *sql, size_t length, bool /*buffered*/) {
   std::string s(sql, length);
+
+  if (_queries.empty()) {
+    ADD_FAILURE() << "Unexpected query: " << s;
+    throw std::logic_error("Unexpected query: " + s);
+  }
+
   // Ensures the expected query got received
   EXPECT_EQ(s, _queries[0]);
 
   // Removes the query
   _queries.erase(_queries.begin());
+  const bool do_throw = _throws[0];
+  _throws.erase(_throws.begin());
 
   // Throws if that's the plan
-  if (_throws[0]) {
-    _throws.erase(_throws.begin());
-    throw std::runtime_error("Error executing session.query");
-  }
+  if (do_throw) throw std::runtime_error("Error executing session.query");
 
   // Returns the assigned result if that's the plan
   return _results[s];
@@ -2485,9 +2485,15 @@ namespace {
 void setup_recorder_environment() {
   static char mode[512];
   static char prefix[512];
+  static char format[512];
 
   snprintf(mode, sizeof(mode), "MYSQLSH_RECORDER_MODE=");
   snprintf(prefix, sizeof(prefix), "MYSQLSH_RECORDER_PREFIX=");
+  snprintf(format, sizeof(format), "MYSQLSH_RECORDER_FORMAT=%s",
+           mysqlshdk::db::replay::g_trace_format ==
+                   mysqlshdk::db::replay::Trace_format::Binary
+               ? "binary"
+               : "");
 
   // If session recording is wanted, we need to append a mysqlprovision specific
   // suffix to the output path, which also has to be different for each call
@@ -2504,6 +2510,7 @@ void setup_recorder_environment() {
   }
   putenv(mode);
   putenv(prefix);
+  putenv(format);
 }
 }  // namespace
 
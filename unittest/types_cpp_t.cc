@@ -93,6 +93,14 @@ class Test_object : public Cpp_object_bridge {
     expose("throw_argument", &Test_object::f_throw_argument);
   }
 
+  void do_expose_names() {
+    expose("camelCase", &Test_object::f_i_v);
+    expose("customName|other_name", &Test_object::f_s_i, "iarg");
+    add_varargs_method("legacyMethod", [](const shcore::Argument_list &args) {
+      return shcore::Value(static_cast<int>(args.size()));
+    });
+  }
+
   void do_expose_overloaded() {
     expose("overload", &Test_object::f_overload);
     expose<int, int>("overload", &Test_object::f_overload, "i");
@@ -449,4 +457,59 @@ TEST_F(Types_cpp, arg_check_overload_ambiguous) {
   EXPECT_EQ(obj.f_overload(11), obj.call("overload", make_args(11)).as_int());
   EXPECT_EQ(obj.f_overload(0), obj.call("overload", make_args()).as_int());
 }
+TEST_F(Types_cpp, lookup_naming_style) {
+  obj.do_expose_names();
+
+  EXPECT_TRUE(obj.has_method_advanced("camelCase", LowerCamelCase));
+  EXPECT_TRUE(obj.has_method_advanced("camel_case", LowerCaseUnderscores));
+  EXPECT_FALSE(obj.has_method_advanced("camelCase", LowerCaseUnderscores));
+  EXPECT_FALSE(obj.has_method_advanced("camel_case", LowerCamelCase));
+
+  // names which cannot be converted between the styles
+  EXPECT_TRUE(obj.has_method_advanced("customName", LowerCamelCase));
+  EXPECT_TRUE(obj.has_method_advanced("other_name", LowerCaseUnderscores));
+  EXPECT_FALSE(obj.has_method_advanced("custom_name", LowerCaseUnderscores));
+  EXPECT_FALSE(obj.has_method_advanced("otherName", LowerCamelCase));
+
+  EXPECT_TRUE(obj.has_method_advanced("legacy_method", LowerCaseUnderscores));
+  EXPECT_TRUE(obj.has_method_advanced("help", LowerCaseUnderscores));
+
+  EXPECT_EQ(obj.f_i_v(),
+            obj.call_advanced("camel_case", make_args(), LowerCaseUnderscores)
+                .as_int());
+  EXPECT_EQ(obj.f_s_i(7),
+            obj.call_advanced("other_name", make_args(7), LowerCaseUnderscores)
+                .get_string());
+  EXPECT_EQ(2, obj.call_advanced("legacy_method", make_args(1, 2),
+                                 LowerCaseUnderscores)
+                   .as_int());
+
+  try {
+    obj.call_advanced("other_name", make_args(shcore::make_array()),
+                      LowerCaseUnderscores);
+    FAIL() << "Expected exception but didn't get one";
+  } catch (const shcore::Exception &e) {
+    EXPECT_STREQ("Test_object.other_name: Argument #1 is expected to be an "
+                 "integer",
+                 e.what());
+  }
+
+  EXPECT_THROW(obj.call_advanced("customName", make_args(1),
+                                 LowerCaseUnderscores),
+               shcore::Exception);
+}
+
+TEST_F(Types_cpp, legacy_metadata_is_shared) {
+  Test_object other;
+  obj.do_expose_names();
+  other.do_expose_names();
+
+  const auto signature = [](const Test_object &o, const std::string &name) {
+    return &o.get_member(name).as_function()->signature();
+  };
+
+  EXPECT_EQ(signature(obj, "legacyMethod"), signature(other, "legacyMethod"));
+  EXPECT_EQ(signature(obj, "help"), signature(other, "help"));
+}
+
 }  // namespace shcore
@@ -291,6 +291,159 @@ TEST(ValueTests, ArrayCompare) {
   EXPECT_TRUE(arr1 == arr2);
 }
 
+TEST(ValueTests, Move) {
+  const std::string long_string(100, 'x');
+
+  {
+    Value v1(long_string);
+    const char *data = v1.get_string().data();
+    Value v2(std::move(v1));
+
+    EXPECT_EQ(Undefined, v1.type);
+    EXPECT_EQ(String, v2.type);
+    EXPECT_EQ(long_string, v2.get_string());
+    // buffer was not copied
+    EXPECT_EQ(data, v2.get_string().data());
+
+    v1 = std::move(v2);
+    EXPECT_EQ(Undefined, v2.type);
+    EXPECT_EQ(long_string, v1.get_string());
+    EXPECT_EQ(data, v1.get_string().data());
+  }
+
+  {
+    auto array = make_array();
+    Value v1(array);
+    EXPECT_EQ(2, array.use_count());
+
+    Value v2(std::move(v1));
+    EXPECT_EQ(2, array.use_count());
+    EXPECT_EQ(array, v2.as_array());
+
+    Value v3(Value::new_map());
+    v3 = std::move(v2);
+    EXPECT_EQ(2, array.use_count());
+    EXPECT_EQ(Array, v3.type);
+    EXPECT_EQ(Undefined, v2.type);
+  }
+
+  {
+    // value being assigned is owned by the target
+    Value v(Value::new_array());
+    v.as_array()->push_back(Value("short"));
+    v = v.as_array()->at(0);
+    EXPECT_EQ("short", v.get_string());
+
+    v = Value::new_array();
+    v.as_array()->push_back(Value(long_string));
+    v = std::move(v.as_array()->at(0));
+    EXPECT_EQ(long_string, v.get_string());
+  }
+
+  {
+    // self assignment
+    Value v(long_string);
+    Value &ref = v;
+    v = ref;
+    EXPECT_EQ(long_string, v.get_string());
+    v = std::move(ref);
+    EXPECT_EQ(long_string, v.get_string());
+  }
+}
+
+TEST(ValueTests, Copy) {
+  Value v1("short");
+  Value v2(v1);
+  EXPECT_EQ(v1, v2);
+
+  v1 = Value(1);
+  v2 = v1;
+  EXPECT_EQ(Integer, v2.type);
+  EXPECT_EQ(1, v2.as_int());
+
+  auto map = make_dict();
+  v1 = Value(map);
+  v2 = v1;
+  EXPECT_EQ(3, map.use_count());
+  v2 = Value::Null();
+  EXPECT_EQ(2, map.use_count());
+}
+
+TEST(ValueTests, MapOrder) {
+  Value::Map_type map;
+
+  map["c"] = Value(3);
+  map["a"] = Value(1);
+  map.set("d", Value(4));
+  map.emplace("b", 2);
+  map.emplace("a", 100);
+
+  ASSERT_EQ(4, map.size());
+  EXPECT_EQ(1, map.at("a").as_int());
+  EXPECT_EQ(2, map.at("b").as_int());
+
+  // iteration is ordered by key, regardless of the order of insertion
+  std::string keys;
+  for (const auto &entry : map) keys += entry.first;
+  EXPECT_EQ("abcd", keys);
+
+  EXPECT_TRUE(map.has_key("c"));
+  map.erase("c");
+  EXPECT_FALSE(map.has_key("c"));
+  EXPECT_EQ(0, map.count("c"));
+  EXPECT_EQ(map.end(), map.find("c"));
+  map.erase("c");
+  EXPECT_EQ(3, map.size());
+
+  EXPECT_THROW(map.at("c"), std::out_of_range);
+
+  // value being set is an entry of the same map
+  map.set("0", map.at("d"));
+  EXPECT_EQ(4, map.at("0").as_int());
+  EXPECT_EQ(4, map.at("d").as_int());
+
+  Value::Map_type other;
+  other.reserve(4);
+  for (const auto &key : {"0", "a", "b", "d"}) other[key] = map.at(key);
+  EXPECT_TRUE(map == other);
+
+  EXPECT_EQ("{\"0\": 4, \"a\": 1, \"b\": 2, \"d\": 4}",
+            Value(std::make_shared<Value::Map_type>(map)).descr());
+}
+
+TEST(ValueTests, MapAssign) {
+  Value::Map_type::container_type entries;
+  entries.emplace_back("c", Value(3));
+  entries.emplace_back("a", Value(1));
+  entries.emplace_back("b", Value(2));
+  entries.emplace_back("a", Value(10));
+  entries.emplace_back("c", Value(30));
+  entries.emplace_back("c", Value(300));
+
+  Value::Map_type map;
+  map.set("z", Value(0));
+  map.assign(std::move(entries));
+
+  // previous contents are replaced, the last value of a repeated key is kept
+  EXPECT_EQ("{\"a\": 10, \"b\": 2, \"c\": 300}",
+            Value(std::make_shared<Value::Map_type>(map)).descr());
+
+  // large maps built from keys in arbitrary order
+  const int k_count = 100000;
+  const auto key = [](int i) { return std::to_string((i * 7919) % k_count); };
+  Value::Map_type::container_type many;
+  for (int i = 0; i < k_count; ++i) many.emplace_back(key(i), Value(i));
+  Value::Map_type built;
+  built.assign(std::move(many));
+  ASSERT_EQ(static_cast<size_t>(k_count), built.size());
+  for (int i = 0; i < k_count; ++i) EXPECT_EQ(i, built.at(key(i)).as_int());
+  EXPECT_TRUE(std::is_sorted(built.begin(), built.end(),
+                             [](const Value::Map_type::value_type &l,
+                                const Value::Map_type::value_type &r) {
+                               return l.first < r.first;
+                             }));
+}
+
 static Value do_test(const Argument_list &args) {
   args.ensure_count(1, 2, "do_test");
 
@@ -567,6 +720,50 @@ TEST(Parsing, Array) {
   EXPECT_EQ(array2->size(), 0);
 }
 
+TEST(Parsing, Json) {
+  const std::string json =
+      "{\"b\": [1, -2, 3.5, 18446744073709551615, \"\\u00e9\\ud83d\\ude00\"],"
+      " \"a\": {\"x\": null, \"y\": true, \"z\": \"a\\/b\\n\"}, \"a\": {}}";
+
+  for (const bool lenient : {true, false}) {
+    SCOPED_TRACE(lenient);
+    const auto v = Value::parse(json, lenient);
+
+    ASSERT_EQ(Map, v.type);
+    const auto map = v.as_map();
+    // last occurrence of a key wins
+    EXPECT_EQ(0, map->get_map("a")->size());
+
+    const auto array = map->get_array("b");
+    ASSERT_EQ(5, array->size());
+    EXPECT_EQ(Integer, (*array)[0].type);
+    EXPECT_EQ(1, (*array)[0].as_int());
+    EXPECT_EQ(-2, (*array)[1].as_int());
+    EXPECT_EQ(Float, (*array)[2].type);
+    EXPECT_EQ(3.5, (*array)[2].as_double());
+    EXPECT_EQ(UInteger, (*array)[3].type);
+    EXPECT_EQ(18446744073709551615ULL, (*array)[3].as_uint());
+    EXPECT_EQ("\xc3\xa9\xf0\x9f\x98\x80", (*array)[4].get_string());
+  }
+
+  EXPECT_EQ("a/b\n", Value::parse("{\"z\": \"a\\/b\\n\"}", false)
+                         .as_map()
+                         ->get_string("z"));
+  EXPECT_EQ(std::string("a\0b", 3), Value::parse("\"a\\u0000b\"").get_string());
+
+  // the extended syntax is accepted only in lenient mode
+  for (const auto &doc : {"{'a': 1}", "[1,]", "\"\\x41\"", "undefined",
+                          "True", "{\"a\": 1,}"}) {
+    SCOPED_TRACE(doc);
+    EXPECT_NO_THROW(Value::parse(doc));
+    EXPECT_THROW(Value::parse(doc, false), shcore::Exception);
+  }
+
+  EXPECT_THROW(Value::parse(std::string("1\0 2", 4), false), shcore::Exception);
+  EXPECT_THROW(Value::parse("[1, 2", false), shcore::Exception);
+  EXPECT_THROW(Value::parse("", false), shcore::Exception);
+}
+
 TEST(Argument_map, all) {
   {
     Argument_map args;
@@ -29,12 +29,15 @@
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/shellcore/shell_console.h"
 #include "scripting/common.h"
+#include "scripting/jscript_code_cache.h"
 #include "scripting/jscript_context.h"
 #include "scripting/lang_base.h"
 #include "scripting/object_registry.h"
 #include "scripting/types.h"
 #include "scripting/types_cpp.h"
 #include "test_utils.h"
+#include "utils/utils_file.h"
+#include "utils/utils_path.h"
 #include "utils/utils_string.h"
 
 using namespace std::placeholders;
@@ -491,5 +494,42 @@ TEST_F(JavaScript, js_date_object) {
   ASSERT_TRUE(object.as_object()->class_name() == "Date");
   ASSERT_EQ("\"2014-01-01 00:00:00\"", object.repr());
 }
+
+TEST_F(JavaScript, code_cache) {
+  const std::string script =
+      shcore::path::join_path(getenv("TMPDIR"), "code_cache_test.js");
+  const std::string code = "function add(a, b) { return a + b; }\nadd(40, 2);";
+  const std::string code2 = "function add(a, b) { return a + b; }\nadd(40, 3);";
+  ASSERT_TRUE(shcore::create_file(script, code));
+
+  JScript_code_cache cache(JScript_code_cache::default_directory());
+  ASSERT_TRUE(cache.enabled());
+  cache.remove(script);
+
+  // first execution creates the entry, second one consumes it
+  EXPECT_EQ(42, env.js->execute(code, script).first.as_int());
+  std::string data;
+  EXPECT_TRUE(cache.load(script, code, &data));
+  EXPECT_FALSE(data.empty());
+  EXPECT_EQ(42, env.js->execute(code, script).first.as_int());
+
+  // entry is replaced if source changes
+  EXPECT_FALSE(cache.load(script, code2, &data));
+  EXPECT_EQ(43, env.js->execute(code2, script).first.as_int());
+  EXPECT_TRUE(cache.load(script, code2, &data));
+
+  // invalid entry is rejected by V8 and replaced
+  cache.store(script, code2, reinterpret_cast<const uint8_t *>("garbage"), 7);
+  EXPECT_EQ(43, env.js->execute(code2, script).first.as_int());
+  EXPECT_TRUE(cache.load(script, code2, &data));
+  EXPECT_NE("garbage", data);
+
+  // code which does not come from a file is not cached
+  EXPECT_EQ(42, env.js->execute(code, "(command line)").first.as_int());
+  EXPECT_FALSE(shcore::file_exists(cache.entry_path("(command line)")));
+
+  cache.remove(script);
+  shcore::delete_file(script);
+}
 }  // namespace tests
 }  // namespace shcore